@@ -0,0 +1,9 @@
+-- Landmark (ALT) distances for the travel node route heuristic.
+-- Filled by TravelNodeMap::saveNodeStore, negative distances mark unreachable pairs.
+CREATE TABLE IF NOT EXISTS `playerbots_travelnode_landmark` (
+`landmark` tinyint(3) unsigned NOT NULL,
+`node_id` mediumint(8) NOT NULL,
+`distance_from` float NOT NULL,
+`distance_to` float NOT NULL,
+PRIMARY KEY (`landmark`,`node_id`)
+) ENGINE=MyISAM DEFAULT CHARSET=utf8 ROW_FORMAT=FIXED COMMENT='PlayerbotAI Travel Node landmark distances';
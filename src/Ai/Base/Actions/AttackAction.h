@@ -14,7 +14,10 @@ class PlayerbotAI;
 class AttackAction : public MovementAction
 {
 public:
-    AttackAction(PlayerbotAI* botAI, std::string const name) : MovementAction(botAI, name) {}
+    AttackAction(PlayerbotAI* botAI, std::string const name) : MovementAction(botAI, name)
+    {
+        categories |= ACTION_CATEGORY_ATTACK;
+    }
 
     bool Execute(Event event) override;
 
@@ -22,11 +22,11 @@ static void HandleStrategyCommon(PlayerbotAI* botAI, std::string const& text, Bo
             case '+':
             case '-':
             case '~':
-                PlayerbotRepository::instance().Save(botAI);
+                PlayerbotRepository::instance().ScheduleSave(botAI);
                 break;
             case '!':
                 botAI->SelectiveResetStrategies(state);
-                PlayerbotRepository::instance().Save(botAI);
+                PlayerbotRepository::instance().ScheduleSave(botAI);
                 break;
             case '?':
                 break;
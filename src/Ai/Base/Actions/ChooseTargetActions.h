@@ -14,7 +14,10 @@ class PlayerbotAI;
 class DpsAoeAction : public AttackAction
 {
 public:
-    DpsAoeAction(PlayerbotAI* botAI) : AttackAction(botAI, "dps aoe") {}
+    DpsAoeAction(PlayerbotAI* botAI) : AttackAction(botAI, "dps aoe")
+    {
+        categories |= ACTION_CATEGORY_DPS_AOE;
+    }
 
     std::string const GetTargetName() override { return "dps aoe target"; }
 };
@@ -22,7 +25,10 @@ public:
 class DpsAssistAction : public AttackAction
 {
 public:
-    DpsAssistAction(PlayerbotAI* botAI) : AttackAction(botAI, "dps assist") {}
+    DpsAssistAction(PlayerbotAI* botAI) : AttackAction(botAI, "dps assist")
+    {
+        categories |= ACTION_CATEGORY_DPS_ASSIST;
+    }
 
     std::string const GetTargetName() override { return "dps target"; }
     bool isUseful() override;
@@ -31,7 +37,10 @@ public:
 class TankAssistAction : public AttackAction
 {
 public:
-    TankAssistAction(PlayerbotAI* botAI) : AttackAction(botAI, "tank assist") {}
+    TankAssistAction(PlayerbotAI* botAI) : AttackAction(botAI, "tank assist")
+    {
+        categories |= ACTION_CATEGORY_TANK_ASSIST;
+    }
 
     std::string const GetTargetName() override { return "tank target"; }
 };
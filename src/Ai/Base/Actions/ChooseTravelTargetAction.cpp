@@ -6,6 +6,8 @@
 
 #include "ChooseTravelTargetAction.h"
 
+#include <unordered_set>
+
 #include "ChatHelper.h"
 #include "LootObjectStack.h"
 #include "Playerbots.h"
@@ -700,62 +702,36 @@ bool ChooseTravelTargetAction::SetNpcFlagTarget(TravelTarget* target, std::vecto
 {
     WorldPosition botPos(bot);
 
-    std::vector<TravelDestination*> dests;
-
-    for (auto& d : TravelMgr::instance().getRpgTravelDestinations(bot, true, true))
-    {
-        if (!d->getEntry())
-            continue;
-
-        CreatureTemplate const* cInfo = sObjectMgr->GetCreatureTemplate(d->getEntry());
-        if (!cInfo)
-            continue;
+    TravelMgr& travelMgr = TravelMgr::instance();
 
-        bool foundFlag = false;
-        for (auto flag : flags)
-            if (cInfo->npcflag & flag)
-            {
-                foundFlag = true;
-                break;
-            }
+    // Npcs with the flags, name and items come from the inverted indexes, only their faction and distance are
+    // checked here.
+    std::vector<RpgTravelDestination*> npcs = travelMgr.getRpgNpcs(flags, name, items);
 
-        if (!foundFlag)
-            continue;
+    auto isFriendly = [this](TravelDestination* d)
+    {
+        CreatureTemplate const* cInfo = static_cast<RpgTravelDestination*>(d)->GetCreatureTemplate();
+        FactionTemplateEntry const* factionEntry = sFactionTemplateStore.LookupEntry(cInfo->faction);
+        return Unit::GetFactionReactionTo(bot->GetFactionTemplateEntry(), factionEntry) >= REP_NEUTRAL;
+    };
 
-        if (!name.empty() && !strstri(cInfo->Name.c_str(), name.c_str()) &&
-            !strstri(cInfo->SubName.c_str(), name.c_str()))
-            continue;
+    std::vector<TravelDestination*> dests;
 
-        if (!items.empty())
+    if (npcs.size() > 64 && travelMgr.rpgNpcIndex.GetDestinationCount() == travelMgr.rpgNpcs.size())
+    {
+        // Too many to measure one by one, walk out from the bot instead.
+        std::unordered_set<TravelDestination*> candidates(npcs.begin(), npcs.end());
+        dests = travelMgr.rpgNpcIndex.GetNearest(botPos, 5000.0f, 1, [&](TravelDestination* d)
+                                                 { return candidates.count(d) && isFriendly(d); });
+    }
+    else
+    {
+        // Same range as getRpgTravelDestinations.
+        for (RpgTravelDestination* npc : npcs)
         {
-            bool foundItem = false;
-            VendorItemData const* vItems = sObjectMgr->GetNpcVendorItemList(d->getEntry());
-            if (vItems)
-            {
-                for (auto item : items)
-                {
-                    for (auto vitem : vItems->m_items)
-                    {
-                        if (vitem->item == item)
-                        {
-                            foundItem = true;
-                            break;
-                        }
-                    }
-                }
-            }
-
-            if (!foundItem)
-                continue;
+            if (isFriendly(npc) && npc->distanceTo(&botPos) <= 5000.0f)
+                dests.push_back(npc);
         }
-
-        FactionTemplateEntry const* factionEntry = sFactionTemplateStore.LookupEntry(cInfo->faction);
-        ReputationRank reaction = Unit::GetFactionReactionTo(botAI->GetBot()->GetFactionTemplateEntry(), factionEntry);
-
-        if (reaction < REP_NEUTRAL)
-            continue;
-
-        dests.push_back(d);
     }
 
     if (!dests.empty())
@@ -779,30 +755,6 @@ bool ChooseTravelTargetAction::SetNpcFlagTarget(TravelTarget* target, std::vecto
     return false;
 }
 
-std::vector<TravelDestination*> TravelMgr::getBossTravelDestinations(Player* bot, bool ignoreFull, bool ignoreInactive,
-                                                                     float maxDistance)
-{
-    WorldPosition botLocation(bot);
-
-    std::vector<TravelDestination*> retTravelLocations;
-
-    for (auto& dest : bossMobs)
-    {
-        if (!ignoreInactive && !dest->isActive(bot))
-            continue;
-
-        if (dest->isFull(ignoreFull))
-            continue;
-
-        if (maxDistance > 0 && dest->distanceTo(&botLocation) > maxDistance)
-            continue;
-
-        retTravelLocations.push_back(dest);
-    }
-
-    return retTravelLocations;
-}
-
 bool ChooseTravelTargetAction::SetNullTarget(TravelTarget* target)
 {
     target->setTarget(TravelMgr::instance().nullTravelDestination, TravelMgr::instance().nullWorldPosition, true);
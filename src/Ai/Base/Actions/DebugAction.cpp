@@ -246,6 +246,7 @@ bool DebugAction::Execute(Event event)
         for (auto& node : TravelNodeMap::instance().getNodes())
             for (auto& path : *node->getLinks())
                 node->removeLinkTo(path.first, true);
+        TravelNodeMap::instance().clearRouteCache();
         return true;
     }
     else if (text.find("gen node") != std::string::npos)
@@ -14,7 +14,10 @@ class PlayerbotAI;
 class FollowAction : public MovementAction
 {
 public:
-    FollowAction(PlayerbotAI* botAI, std::string const name = "follow") : MovementAction(botAI, name) {}
+    FollowAction(PlayerbotAI* botAI, std::string const name = "follow") : MovementAction(botAI, name)
+    {
+        categories |= ACTION_CATEGORY_FOLLOW;
+    }
 
     bool Execute(Event event) override;
     bool isUseful() override;
@@ -136,7 +136,10 @@ namespace
 }
 
 CastSpellAction::CastSpellAction(PlayerbotAI* botAI, std::string const spell)
-    : Action(botAI, spell), spell(spell), range(botAI->GetRange("spell")) {}
+    : Action(botAI, spell), spell(spell), range(botAI->GetRange("spell"))
+{
+    categories |= ACTION_CATEGORY_SPELL;
+}
 
 bool CastSpellAction::Execute(Event /*event*/)
 {
@@ -376,6 +379,7 @@ CastHealingSpellAction::CastHealingSpellAction(PlayerbotAI* botAI, std::string c
     : CastAuraSpellAction(botAI, spell, isOwner), manaEfficiency(manaEfficiency), estAmount(estAmount)
 {
     range = botAI->GetRange("heal");
+    categories |= ACTION_CATEGORY_HEAL;
 }
 
 bool CastHealingSpellAction::isUseful() { return CastAuraSpellAction::isUseful(); }
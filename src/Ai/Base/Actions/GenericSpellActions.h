@@ -377,7 +377,10 @@ public:
 class CastCrowdControlSpellAction : public CastBuffSpellAction
 {
 public:
-    CastCrowdControlSpellAction(PlayerbotAI* botAI, std::string const spell) : CastBuffSpellAction(botAI, spell) {}
+    CastCrowdControlSpellAction(PlayerbotAI* botAI, std::string const spell) : CastBuffSpellAction(botAI, spell)
+    {
+        categories |= ACTION_CATEGORY_CROWD_CONTROL;
+    }
 
     Value<Unit*>* GetTargetValue() override;
     bool Execute(Event event) override;
@@ -9,6 +9,7 @@
 #include "ChooseRpgTargetAction.h"
 #include "LootObjectStack.h"
 #include "Playerbots.h"
+#include "TravelNode.h"
 
 bool MoveToTravelTargetAction::Execute(Event /*event*/)
 {
@@ -73,6 +74,34 @@ bool MoveToTravelTargetAction::Execute(Event /*event*/)
         }
     }
 
+    // Far away or on another map: follow the node route, planned on the route planner threads.
+    if (TravelNodeMap::instance().hasNodes() && !bot->InBattleground() &&
+        (botLocation.GetMapId() != location.GetMapId() || target->distance(bot) > sPlayerbotAIConfig.reactDistance))
+    {
+        target->requestPath(bot);
+
+        // Still planning: keep moving the direct way below until the path arrives.
+        TravelPath* path = target->isPathPending() ? nullptr : target->getPath();
+        if (path && !path->empty())
+        {
+            TravelNodePathType pathType = TravelNodePathType::walk;
+            uint32 entry = 0;
+            WorldPosition movePosition =
+                path->getNextPoint(botLocation, sPlayerbotAIConfig.reactDistance, pathType, entry);
+
+            // Portals, flights and hearthstone are left to the regular travel actions.
+            if (pathType == TravelNodePathType::walk && movePosition &&
+                movePosition.GetMapId() == botLocation.GetMapId() &&
+                movePosition.distance(botLocation) > sPlayerbotAIConfig.targetPosRecalcDistance &&
+                MoveTo(movePosition.GetMapId(), movePosition.GetPositionX(), movePosition.GetPositionY(),
+                       movePosition.GetPositionZ(), false, false))
+            {
+                target->setRetry(true);
+                return true;
+            }
+        }
+    }
+
     float maxDistance = target->getDestination()->getRadiusMin();
 
     // Spread bots around the target but keep the offset stable per
@@ -89,6 +89,7 @@ public:
     FleeAction(PlayerbotAI* botAI, float distance = sPlayerbotAIConfig.spellDistance)
         : MovementAction(botAI, "flee"), distance(distance)
     {
+        categories |= ACTION_CATEGORY_FLEE;
     }
 
     bool Execute(Event event) override;
@@ -112,6 +113,7 @@ public:
     AvoidAoeAction(PlayerbotAI* botAI, int moveInterval = 1000)
         : MovementAction(botAI, "avoid aoe"), moveInterval(moveInterval)
     {
+        categories |= ACTION_CATEGORY_AVOID_AOE;
     }
 
     bool isUseful() override;
@@ -132,6 +134,7 @@ public:
     CombatFormationMoveAction(PlayerbotAI* botAI, std::string name = "combat formation move", int moveInterval = 1000)
         : MovementAction(botAI, name), moveInterval(moveInterval)
     {
+        categories |= ACTION_CATEGORY_COMBAT_FORMATION_MOVE;
     }
 
     bool isUseful() override;
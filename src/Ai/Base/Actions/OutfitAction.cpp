@@ -34,7 +34,7 @@ bool OutfitAction::Execute(Event event)
         if (!name.empty())
         {
             Save(name, items);
-            PlayerbotRepository::instance().Save(botAI);
+            PlayerbotRepository::instance().ScheduleSave(botAI);
 
             std::ostringstream out;
             botAI->TellMaster(PlayerbotTextMgr::instance().GetBotTextOrDefault(
@@ -98,7 +98,7 @@ bool OutfitAction::Execute(Event event)
                 {{"%name", name}}));
 
             Save(name, ItemIds());
-            PlayerbotRepository::instance().Save(botAI);
+            PlayerbotRepository::instance().ScheduleSave(botAI);
             return true;
         }
         else if (command == "update")
@@ -109,7 +109,7 @@ bool OutfitAction::Execute(Event event)
                 {{"%name", name}}));
 
             Update(name);
-            PlayerbotRepository::instance().Save(botAI);
+            PlayerbotRepository::instance().ScheduleSave(botAI);
             return true;
         }
 
@@ -140,7 +140,7 @@ bool OutfitAction::Execute(Event event)
         }
 
         Save(name, outfit);
-        PlayerbotRepository::instance().Save(botAI);
+        PlayerbotRepository::instance().ScheduleSave(botAI);
     }
 
     return true;
@@ -18,6 +18,7 @@ public:
     ReachTargetAction(PlayerbotAI* botAI, std::string const name, float distance)
         : MovementAction(botAI, name), distance(distance)
     {
+        categories |= ACTION_CATEGORY_REACH_TARGET;
     }
 
     bool Execute(Event event) override;
@@ -34,6 +35,7 @@ public:
     CastReachTargetSpellAction(PlayerbotAI* botAI, std::string const spell, float distance)
         : CastSpellAction(botAI, spell), distance(distance)
     {
+        categories |= ACTION_CATEGORY_REACH_SPELL;
     }
 
     bool isUseful() override;
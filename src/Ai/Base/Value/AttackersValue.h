@@ -7,6 +7,7 @@
 #ifndef PLAYERBOTS_ATTACKERSVALUE_H
 #define PLAYERBOTS_ATTACKERSVALUE_H
 
+#include "Opcodes.h"
 #include "PlayerbotAIConfig.h"
 #include "Value.h"
 
@@ -18,7 +19,11 @@ class Unit;
 class AttackersValue : public ObjectGuidListCalculatedValue
 {
 public:
-    AttackersValue(PlayerbotAI* botAI) : ObjectGuidListCalculatedValue(botAI, "attackers", 1 * 1000) {}
+    AttackersValue(PlayerbotAI* botAI) : ObjectGuidListCalculatedValue(botAI, "attackers", 1 * 1000)
+    {
+        DependsOn(SMSG_ATTACKSTART);
+        DependsOn(SMSG_ATTACKSTOP);
+    }
 
     GuidVector Calculate();
     static bool IsPossibleTarget(Unit* attacker, Player* bot, float range = sPlayerbotAIConfig.sightDistance);
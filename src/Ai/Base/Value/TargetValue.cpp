@@ -9,6 +9,7 @@
 #include "CombatManager.h"
 #include "LastMovementValue.h"
 #include "ObjectGuid.h"
+#include "ObjectMgr.h"
 #include "Playerbots.h"
 #include "RtiTargetValue.h"
 #include "ScriptedCreature.h"
@@ -168,22 +169,65 @@ Unit* FindTargetValue::Calculate()
     {
         return nullptr;
     }
+
+    if (!entries)
+        entries = &GetCreatureEntriesByName(qualifier);
+
     for (auto const& [guid, ref] : bot->GetThreatMgr().GetThreatenedByMeList())
     {
         Unit* unit = ref->GetOwner();
         if (!unit)
             continue;
 
-        std::wstring wnamepart;
-        Utf8toWStr(unit->GetName(), wnamepart);
-        wstrToLower(wnamepart);
-        if (!qualifier.empty() && qualifier.length() == wnamepart.length() && Utf8FitTo(qualifier, wnamepart))
+        if (IsNamed(unit))
             return unit;
     }
 
     return nullptr;
 }
 
+std::vector<uint32> const& FindTargetValue::GetCreatureEntriesByName(std::string const& name)
+{
+    auto toLower = [](std::string const& text)
+    {
+        std::wstring wtext;
+        if (!Utf8toWStr(text, wtext))
+            return text;
+
+        wstrToLower(wtext);
+
+        std::string lower;
+        WStrToUtf8(wtext, lower);
+        return lower;
+    };
+
+    static std::unordered_map<std::string, std::vector<uint32>> const entriesByName = [&toLower]()
+    {
+        std::unordered_map<std::string, std::vector<uint32>> entries;
+        for (auto const& [entry, creatureTemplate] : *sObjectMgr->GetCreatureTemplates())
+            entries[toLower(creatureTemplate.Name)].push_back(entry);
+
+        return entries;
+    }();
+
+    static std::vector<uint32> const none;
+
+    auto const itr = entriesByName.find(toLower(name));
+    return itr != entriesByName.end() ? itr->second : none;
+}
+
+bool FindTargetValue::IsNamed(Unit* unit) const
+{
+    // Creatures carry the name of their entry, anything else is still matched by name.
+    if (Creature* creature = unit->ToCreature())
+        return std::find(entries->begin(), entries->end(), creature->GetEntry()) != entries->end();
+
+    std::wstring wnamepart;
+    Utf8toWStr(unit->GetName(), wnamepart);
+    wstrToLower(wnamepart);
+    return qualifier.length() == wnamepart.length() && Utf8FitTo(qualifier, wnamepart);
+}
+
 void FindBossTargetStrategy::CheckAttacker(Unit* attacker, ThreatManager* /*threatManager*/)
 {
     UnitAI* unitAI = attacker->GetAI();
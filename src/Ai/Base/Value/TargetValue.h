@@ -130,6 +130,8 @@ public:
     }
 };
 
+// Threatened unit named as the qualifier (lowercase). The name is resolved to creature entries on first use,
+// after that only entries are compared.
 class FindTargetValue : public UnitCalculatedValue, public Qualified
 {
 public:
@@ -137,6 +139,13 @@ public:
 
 public:
     Unit* Calculate();
+
+private:
+    // Entries of all creature templates with this lowercase name, from a table built once for all bots.
+    static std::vector<uint32> const& GetCreatureEntriesByName(std::string const& name);
+    bool IsNamed(Unit* unit) const;
+
+    std::vector<uint32> const* entries = nullptr;
 };
 
 class FindBossTargetStrategy : public FindTargetStrategy
@@ -41,7 +41,10 @@ public:
 class CastDarkCommandAction : public CastSpellAction
 {
 public:
-    CastDarkCommandAction(PlayerbotAI* botAI) : CastSpellAction(botAI, "dark command") {}
+    CastDarkCommandAction(PlayerbotAI* botAI) : CastSpellAction(botAI, "dark command")
+    {
+        categories |= ACTION_CATEGORY_TAUNT;
+    }
 };
 
 BEGIN_RANGED_SPELL_ACTION(CastDeathGripAction, "death grip")
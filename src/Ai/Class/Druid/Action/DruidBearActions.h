@@ -21,7 +21,10 @@ public:
 class CastGrowlAction : public CastSpellAction
 {
 public:
-    CastGrowlAction(PlayerbotAI* botAI) : CastSpellAction(botAI, "growl") {}
+    CastGrowlAction(PlayerbotAI* botAI) : CastSpellAction(botAI, "growl")
+    {
+        categories |= ACTION_CATEGORY_TAUNT;
+    }
 };
 
 class CastChallengingRoarAction : public CastMeleeDebuffSpellAction
@@ -263,7 +263,10 @@ public:
 class CastHandOfReckoningAction : public CastSpellAction
 {
 public:
-    CastHandOfReckoningAction(PlayerbotAI* botAI) : CastSpellAction(botAI, "hand of reckoning") {}
+    CastHandOfReckoningAction(PlayerbotAI* botAI) : CastSpellAction(botAI, "hand of reckoning")
+    {
+        categories |= ACTION_CATEGORY_TAUNT;
+    }
 };
 
 class CastRighteousDefenseAction : public CastSpellAction
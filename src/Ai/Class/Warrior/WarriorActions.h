@@ -106,7 +106,17 @@ DEBUFF_ACTION_R(CastPiercingHowlAction, "piercing howl", 8.0f);
 BUFF_ACTION(CastRampageAction, "rampage");
 
 // protection
-MELEE_ACTION_U(CastTauntAction, "taunt", GetTarget() && GetTarget()->GetTarget() != bot->GetGUID());
+class CastTauntAction : public CastMeleeSpellAction
+{
+public:
+    CastTauntAction(PlayerbotAI* botAI) : CastMeleeSpellAction(botAI, "taunt")
+    {
+        categories |= ACTION_CATEGORY_TAUNT;
+    }
+
+    bool isUseful() override { return GetTarget() && GetTarget()->GetTarget() != bot->GetGUID(); }
+};
+
 SNARE_ACTION(CastTauntOnSnareTargetAction, "taunt");
 BUFF_ACTION(CastBloodrageAction, "bloodrage");
 MELEE_ACTION(CastShieldBashAction, "shield bash");
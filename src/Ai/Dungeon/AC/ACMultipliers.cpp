@@ -22,7 +22,7 @@ float ShirrakFleeFocusFireMultiplier::GetValue(Action* action)
     {
         if (flare && flare->IsAlive())
         {
-            if (dynamic_cast<CastReachTargetSpellAction*>(action))
+            if (action->HasCategory(ACTION_CATEGORY_REACH_SPELL))
                 return 0.0f;
 
             float currentDistance = bot->GetDistance2d(flare);
@@ -30,12 +30,10 @@ float ShirrakFleeFocusFireMultiplier::GetValue(Action* action)
             constexpr float buffer = 5.0f;
 
             if (currentDistance < safeDistance + buffer && (
-                dynamic_cast<CombatFormationMoveAction*>(action) ||
+                action->HasCategory(ACTION_CATEGORY_COMBAT_FORMATION_MOVE) ||
                 dynamic_cast<ShirrakRangedKeepDistanceAction*>(action) ||
-                dynamic_cast<FleeAction*>(action) ||
-                dynamic_cast<FollowAction*>(action) ||
-                dynamic_cast<ReachTargetAction*>(action) ||
-                dynamic_cast<AvoidAoeAction*>(action)))
+                action->HasCategory(ACTION_CATEGORY_FLEE | ACTION_CATEGORY_FOLLOW | ACTION_CATEGORY_REACH_TARGET |
+                                    ACTION_CATEGORY_AVOID_AOE)))
             {
                 return 0.0f;
             }
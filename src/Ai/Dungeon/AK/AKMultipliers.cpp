@@ -14,7 +14,7 @@ float ElderNadoxMultiplier::GetValue(Action* action)
     Unit* guardian = AI_VALUE2(Unit*, "find target", "ahn'kahar guardian");
     if (guardian)
     {
-        if (dynamic_cast<DpsAssistAction*>(action))
+        if (action->HasCategory(ACTION_CATEGORY_DPS_ASSIST))
         {
             return 0.0f;
         }
@@ -44,7 +44,7 @@ float JedogaShadowseekerMultiplier::GetValue(Action* action)
 
     if (volunteer)
     {
-        if (dynamic_cast<DpsAssistAction*>(action))
+        if (action->HasCategory(ACTION_CATEGORY_DPS_ASSIST))
         {
             return 0.0f;
         }
@@ -59,7 +59,7 @@ float ForgottenOneMultiplier::GetValue(Action* action)
 
     if (bot->isMoving())
     {
-        if (dynamic_cast<MovementAction*>(action))
+        if (action->HasCategory(ACTION_CATEGORY_MOVEMENT))
         {
             return 0.0f;
         }
@@ -6,7 +6,7 @@
 class ElderNadoxMultiplier : public Multiplier
 {
     public:
-        ElderNadoxMultiplier(PlayerbotAI* ai) : Multiplier(ai, "elder nadox") {}
+        ElderNadoxMultiplier(PlayerbotAI* ai) : Multiplier(ai, "elder nadox", ACTION_CATEGORY_DPS_ASSIST) {}
 
     public:
         virtual float GetValue(Action* action);
@@ -15,7 +15,10 @@ class ElderNadoxMultiplier : public Multiplier
 class JedogaShadowseekerMultiplier : public Multiplier
 {
     public:
-        JedogaShadowseekerMultiplier(PlayerbotAI* ai) : Multiplier(ai, "jedoga shadowseeker") {}
+        JedogaShadowseekerMultiplier(PlayerbotAI* ai)
+            : Multiplier(ai, "jedoga shadowseeker", ACTION_CATEGORY_DPS_ASSIST)
+        {
+        }
 
     public:
         virtual float GetValue(Action* action);
@@ -24,7 +27,7 @@ class JedogaShadowseekerMultiplier : public Multiplier
 class ForgottenOneMultiplier : public Multiplier
 {
     public:
-        ForgottenOneMultiplier(PlayerbotAI* ai) : Multiplier(ai, "forgotten one") {}
+        ForgottenOneMultiplier(PlayerbotAI* ai) : Multiplier(ai, "forgotten one", ACTION_CATEGORY_MOVEMENT) {}
 
     public:
         virtual float GetValue(Action* action);
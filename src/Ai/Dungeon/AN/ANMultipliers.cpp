@@ -40,7 +40,7 @@ float KrikthirMultiplier::GetValue(Action* action)
     if (boss && watcher)
     {
         // Do not target swap
-        if (dynamic_cast<DpsAssistAction*>(action))
+        if (action->HasCategory(ACTION_CATEGORY_DPS_ASSIST))
         {
             return 0.0f;
         }
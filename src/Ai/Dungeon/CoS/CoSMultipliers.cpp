@@ -13,7 +13,7 @@ float EpochMultiplier::GetValue(Action* action)
 
     if (bot->getClass() == CLASS_HUNTER) { return 1.0f; }
 
-    if (dynamic_cast<FleeAction*>(action)) { return 0.0f; }
+    if (action->HasCategory(ACTION_CATEGORY_FLEE)) { return 0.0f; }
 
     return 1.0f;
 }
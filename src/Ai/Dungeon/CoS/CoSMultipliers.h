@@ -6,7 +6,7 @@
 class EpochMultiplier : public Multiplier
 {
     public:
-        EpochMultiplier(PlayerbotAI* ai) : Multiplier(ai, "chrono-lord epoch") {}
+        EpochMultiplier(PlayerbotAI* ai) : Multiplier(ai, "chrono-lord epoch", ACTION_CATEGORY_FLEE) {}
 
     public:
         virtual float GetValue(Action* action);
@@ -49,7 +49,10 @@ public:
 class CastTauntAction : public CastSpellAction
 {
 public:
-    CastTauntAction(PlayerbotAI* botAI) : CastSpellAction(botAI, "taunt") {}
+    CastTauntAction(PlayerbotAI* botAI) : CastSpellAction(botAI, "taunt")
+    {
+        categories |= ACTION_CATEGORY_TAUNT;
+    }
 };
 
 class CastBoneArmorAction : public CastSpellAction
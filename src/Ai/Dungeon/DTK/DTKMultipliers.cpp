@@ -13,8 +13,7 @@ float NovosMultiplier::GetValue(Action* action)
 
     if (boss->FindCurrentSpellBySpellId(SPELL_ARCANE_FIELD) && bot->GetTarget())
     {
-        if (dynamic_cast<DpsAssistAction*>(action)
-            || dynamic_cast<TankAssistAction*>(action))
+        if (action->HasCategory(ACTION_CATEGORY_DPS_ASSIST | ACTION_CATEGORY_TANK_ASSIST))
         {
             return 0.0f;
         }
@@ -28,7 +27,7 @@ float TharonjaMultiplier::GetValue(Action* action)
 
     // Suppress all skills that are not enabled in skeleton form.
     // Still allow non-ability actions such as movement
-    if (dynamic_cast<CastSpellAction*>(action)
+    if (action->HasCategory(ACTION_CATEGORY_SPELL)
         && !dynamic_cast<CastSlayingStrikeAction*>(action)
         && !dynamic_cast<CastTauntAction*>(action)
         && !dynamic_cast<CastBoneArmorAction*>(action)
@@ -37,7 +36,7 @@ float TharonjaMultiplier::GetValue(Action* action)
         return 0.0f;
     }
     // Also suppress FleeAction to prevent ranged characters from avoiding melee range
-    if (dynamic_cast<FleeAction*>(action))
+    if (action->HasCategory(ACTION_CATEGORY_FLEE))
     {
         return 0.0f;
     }
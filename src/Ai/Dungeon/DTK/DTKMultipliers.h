@@ -6,7 +6,10 @@
 class NovosMultiplier : public Multiplier
 {
     public:
-        NovosMultiplier(PlayerbotAI* ai) : Multiplier(ai, "novos the summoner") {}
+        NovosMultiplier(PlayerbotAI* ai)
+            : Multiplier(ai, "novos the summoner", ACTION_CATEGORY_DPS_ASSIST | ACTION_CATEGORY_TANK_ASSIST)
+        {
+        }
 
     public:
         virtual float GetValue(Action* action);
@@ -11,12 +11,12 @@ float BronjahmMultiplier::GetValue(Action* action) {
     if (!boss)
         return 1.0f;
 
-    if (dynamic_cast<TankAssistAction*>(action))
+    if (action->HasCategory(ACTION_CATEGORY_TANK_ASSIST))
         return 0.0f;
 
     if (bot->HasAura(SPELL_CORRUPT_SOUL))
     {
-        if (dynamic_cast<MovementAction*>(action) && !dynamic_cast<MoveFromBronjahmAction*>(action))
+        if (action->HasCategory(ACTION_CATEGORY_MOVEMENT) && !dynamic_cast<MoveFromBronjahmAction*>(action))
         {
             return 0.0f;
         }
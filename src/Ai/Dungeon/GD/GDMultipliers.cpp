@@ -13,7 +13,7 @@ float SladranMultiplier::GetValue(Action* action)
 
     if (boss->FindCurrentSpellBySpellId(SPELL_POISON_NOVA))
     {
-        if (dynamic_cast<MovementAction*>(action) && !dynamic_cast<AvoidPoisonNovaAction*>(action))
+        if (action->HasCategory(ACTION_CATEGORY_MOVEMENT) && !dynamic_cast<AvoidPoisonNovaAction*>(action))
         {
             return 0.0f;
         }
@@ -38,7 +38,7 @@ float SladranMultiplier::GetValue(Action* action)
         }
     }
     // Prevent auto-target acquisition during snake wraps
-    if (snakeWrap && dynamic_cast<DpsAssistAction*>(action))
+    if (snakeWrap && action->HasCategory(ACTION_CATEGORY_DPS_ASSIST))
     {
         return 0.0f;
     }
@@ -53,7 +53,7 @@ float GaldarahMultiplier::GetValue(Action* action)
 
     if (boss->HasAura(SPELL_WHIRLING_SLASH))
         {
-            if (dynamic_cast<MovementAction*>(action) && !dynamic_cast<AvoidWhirlingSlashAction*>(action))
+            if (action->HasCategory(ACTION_CATEGORY_MOVEMENT) && !dynamic_cast<AvoidWhirlingSlashAction*>(action))
             {
                 return 0.0f;
             }
@@ -39,7 +39,7 @@ float FactionCommanderMultiplier::GetValue(Action* action)
         boss->FindCurrentSpellBySpellId(SPELL_WHIRLWIND))
     {
         // Prevent movement actions other than flee during a whirlwind, to prevent running back in early.
-        if (dynamic_cast<MovementAction*>(action) && !dynamic_cast<MoveFromWhirlwindAction*>(action))
+        if (action->HasCategory(ACTION_CATEGORY_MOVEMENT) && !dynamic_cast<MoveFromWhirlwindAction*>(action))
         {
             return 0.0f;
         }
@@ -53,7 +53,7 @@ float TelestraMultiplier::GetValue(Action* action)
     if (boss && boss->GetEntry() != NPC_TELESTRA)
     {
         // boss is split into clones, do not auto acquire target
-        if (dynamic_cast<DpsAssistAction*>(action))
+        if (action->HasCategory(ACTION_CATEGORY_DPS_ASSIST))
         {
             return 0.0f;
         }
@@ -66,7 +66,7 @@ float AnomalusMultiplier::GetValue(Action* action)
     Unit* boss = AI_VALUE2(Unit*, "find target", "anomalus");
     if (boss && boss->HasAura(BUFF_RIFT_SHIELD))
     {
-        if (dynamic_cast<DpsAssistAction*>(action))
+        if (action->HasCategory(ACTION_CATEGORY_DPS_ASSIST))
         {
             return 0.0f;
         }
@@ -80,13 +80,13 @@ float OrmorokMultiplier::GetValue(Action* action)
     if (!boss) { return 1.0f; }
 
     // These are used for auto ranged repositioning, need to suppress so ranged dps don't ping-pong
-    if (dynamic_cast<FleeAction*>(action))
+    if (action->HasCategory(ACTION_CATEGORY_FLEE))
     {
         return 0.0f;
     }
     // This boss is annoying and shuffles around a lot. Don't let tank move once fight has started.
     // Extra checks are to allow the tank to close distance and engage the boss initially
-    if (dynamic_cast<MovementAction*>(action) && !dynamic_cast<DodgeSpikesAction*>(action)
+    if (action->HasCategory(ACTION_CATEGORY_MOVEMENT) && !dynamic_cast<DodgeSpikesAction*>(action)
         && botAI->IsTank(bot) && bot->IsWithinMeleeRange(boss)
         && AI_VALUE2(bool, "facing", "current target"))
         {
@@ -15,7 +15,7 @@ class FactionCommanderMultiplier : public Multiplier
 class TelestraMultiplier : public Multiplier
 {
     public:
-        TelestraMultiplier(PlayerbotAI* ai) : Multiplier(ai, "grand magus telestra") {}
+        TelestraMultiplier(PlayerbotAI* ai) : Multiplier(ai, "grand magus telestra", ACTION_CATEGORY_DPS_ASSIST) {}
 
     public:
         virtual float GetValue(Action* action);
@@ -24,7 +24,7 @@ class TelestraMultiplier : public Multiplier
 class AnomalusMultiplier : public Multiplier
 {
     public:
-        AnomalusMultiplier(PlayerbotAI* ai) : Multiplier(ai, "anomalus") {}
+        AnomalusMultiplier(PlayerbotAI* ai) : Multiplier(ai, "anomalus", ACTION_CATEGORY_DPS_ASSIST) {}
 
     public:
         virtual float GetValue(Action* action);
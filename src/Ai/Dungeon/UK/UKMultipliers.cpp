@@ -10,7 +10,7 @@ float PrinceKelesethMultiplier::GetValue(Action* action)
     if (!boss) { return 1.0f; }
 
     // Suppress auto-targeting behaviour only when a tomb is up
-    if (dynamic_cast<DpsAssistAction*>(action))
+    if (action->HasCategory(ACTION_CATEGORY_DPS_ASSIST))
     {
         GuidVector members = AI_VALUE(GuidVector, "group members");
         for (auto& member : members)
@@ -32,7 +32,7 @@ float SkarvaldAndDalronnMultiplier::GetValue(Action* action)
     if (!dalronn) { return 1.0f; }
 
     // Only suppress DpsAssistAction if Dalronn is alive
-    if (dalronn->isTargetableForAttack() && dynamic_cast<DpsAssistAction*>(action))
+    if (dalronn->isTargetableForAttack() && action->HasCategory(ACTION_CATEGORY_DPS_ASSIST))
     {
         return 0.0f;
     }
@@ -46,7 +46,7 @@ float IngvarThePlundererMultiplier::GetValue(Action* action)
     if (!boss) { return 1.0f; }
 
     // Prevent movement actions overriding current movement, we're probably dodging a slam
-    if (isTank && bot->isMoving() && dynamic_cast<MovementAction*>(action))
+    if (isTank && bot->isMoving() && action->HasCategory(ACTION_CATEGORY_MOVEMENT))
     {
         return 0.0f;
     }
@@ -57,7 +57,7 @@ float IngvarThePlundererMultiplier::GetValue(Action* action)
         if (boss->FindCurrentSpellBySpellId(SPELL_STAGGERING_ROAR) ||
             boss->FindCurrentSpellBySpellId(SPELL_DREADFUL_ROAR))
         {
-            if (dynamic_cast<CastSpellAction*>(action))
+            if (action->HasCategory(ACTION_CATEGORY_SPELL))
             {
                 uint32 spellId = AI_VALUE2(uint32, "spell id", action->getName());
                 SpellInfo const* spellInfo = sSpellMgr->GetSpellInfo(spellId);
@@ -79,7 +79,7 @@ float IngvarThePlundererMultiplier::GetValue(Action* action)
         {
             // Prevent movement actions during smash which can mess up boss position.
             // Allow through IngvarDodgeSmashAction only, as well as any non-movement actions.
-            if (dynamic_cast<MovementAction*>(action) && !dynamic_cast<IngvarDodgeSmashAction*>(action))
+            if (action->HasCategory(ACTION_CATEGORY_MOVEMENT) && !dynamic_cast<IngvarDodgeSmashAction*>(action))
             {
                 return 0.0f;
             }
@@ -6,7 +6,7 @@
 class PrinceKelesethMultiplier : public Multiplier
 {
     public:
-        PrinceKelesethMultiplier(PlayerbotAI* ai) : Multiplier(ai, "prince keleseth") {}
+        PrinceKelesethMultiplier(PlayerbotAI* ai) : Multiplier(ai, "prince keleseth", ACTION_CATEGORY_DPS_ASSIST) {}
 
     public:
         virtual float GetValue(Action* action);
@@ -15,7 +15,10 @@ class PrinceKelesethMultiplier : public Multiplier
 class SkarvaldAndDalronnMultiplier : public Multiplier
 {
     public:
-        SkarvaldAndDalronnMultiplier(PlayerbotAI* ai) : Multiplier(ai, "skarvald and dalronn") {}
+        SkarvaldAndDalronnMultiplier(PlayerbotAI* ai)
+            : Multiplier(ai, "skarvald and dalronn", ACTION_CATEGORY_DPS_ASSIST)
+        {
+        }
 
     public:
         virtual float GetValue(Action* action);
@@ -15,7 +15,7 @@ class SkadiMultiplier : public Multiplier
 class YmironMultiplier : public Multiplier
 {
     public:
-        YmironMultiplier(PlayerbotAI* ai) : Multiplier(ai, "king ymiron") {}
+        YmironMultiplier(PlayerbotAI* ai) : Multiplier(ai, "king ymiron", ACTION_CATEGORY_ATTACK) {}
 
     public:
         virtual float GetValue(Action* action);
@@ -11,7 +11,7 @@ float ErekemMultiplier::GetValue(Action* action)
     Unit* boss = AI_VALUE2(Unit*, "find target", "erekem");
     if (!boss || !botAI->IsDps(bot)) { return 1.0f; }
 
-    if (dynamic_cast<DpsAssistAction*>(action))
+    if (action->HasCategory(ACTION_CATEGORY_DPS_ASSIST))
     {
         return 0.0f;
     }
@@ -27,8 +27,7 @@ float IchoronMultiplier::GetValue(Action* action)
     Unit* boss = AI_VALUE2(Unit*, "find target", "ichoron");
     if (!boss) { return 1.0f; }
 
-    if (dynamic_cast<DpsAssistAction*>(action)
-        || dynamic_cast<TankAssistAction*>(action)
+    if (action->HasCategory(ACTION_CATEGORY_DPS_ASSIST | ACTION_CATEGORY_TANK_ASSIST)
         || dynamic_cast<DropTargetAction*>(action))
     {
         return 0.0f;
@@ -43,13 +42,13 @@ float ZuramatMultiplier::GetValue(Action* action)
 
     if (bot->HasAura(SPELL_VOID_SHIFTED))
     {
-        if (dynamic_cast<DpsAssistAction*>(action) || dynamic_cast<TankAssistAction*>(action))
+        if (action->HasCategory(ACTION_CATEGORY_DPS_ASSIST | ACTION_CATEGORY_TANK_ASSIST))
         {
             return 0.0f;
         }
     }
 
-    if (boss->HasAura(SPELL_SHROUD_OF_DARKNESS) && dynamic_cast<AttackAction*>(action))
+    if (boss->HasAura(SPELL_SHROUD_OF_DARKNESS) && action->HasCategory(ACTION_CATEGORY_ATTACK))
     {
         return 0.0f;
     }
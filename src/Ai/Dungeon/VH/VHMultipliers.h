@@ -24,7 +24,7 @@ class IchoronMultiplier : public Multiplier
 class ZuramatMultiplier : public Multiplier
 {
     public:
-        ZuramatMultiplier(PlayerbotAI* ai) : Multiplier(ai, "zuramat the obliterator") {}
+        ZuramatMultiplier(PlayerbotAI* ai) : Multiplier(ai, "zuramat the obliterator", ACTION_CATEGORY_ATTACK) {}
 
     public:
         virtual float GetValue(Action* action);
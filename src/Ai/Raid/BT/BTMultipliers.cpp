@@ -75,7 +75,7 @@ float HighWarlordNajentusDisableCombatFormationMoveMultiplier::GetValue(Action*
     if (!AI_VALUE2(Unit*, "find target", "high warlord naj'entus"))
         return 1.0f;
 
-    if (dynamic_cast<CombatFormationMoveAction*>(action) &&
+    if (action->HasCategory(ACTION_CATEGORY_COMBAT_FORMATION_MOVE) &&
         !dynamic_cast<SetBehindTargetAction*>(action))
     {
         return 0.0f;
@@ -110,7 +110,7 @@ float SupremusFocusOnAvoidanceInPhase2Multiplier::GetValue(Action* action)
         return 1.0f;
     }
 
-    if (dynamic_cast<MovementAction*>(action) &&
+    if (action->HasCategory(ACTION_CATEGORY_MOVEMENT) &&
         !dynamic_cast<SupremusKiteBossAction*>(action) &&
         !dynamic_cast<SupremusMoveAwayFromVolcanosAction*>(action))
     {
@@ -156,21 +156,20 @@ float TeronGorefiendControlMovementMultiplier::GetValue(Action* action)
     if (!AI_VALUE2(Unit*, "find target", "teron gorefiend"))
         return 1.0f;
 
-    if (dynamic_cast<CombatFormationMoveAction*>(action) &&
+    if (action->HasCategory(ACTION_CATEGORY_COMBAT_FORMATION_MOVE) &&
         !dynamic_cast<SetBehindTargetAction*>(action))
     {
         return 0.0f;
     }
 
-    if (dynamic_cast<FollowAction*>(action) ||
-        dynamic_cast<FleeAction*>(action) ||
+    if (action->HasCategory(ACTION_CATEGORY_FOLLOW | ACTION_CATEGORY_FLEE) ||
         dynamic_cast<CastDisengageAction*>(action) ||
         dynamic_cast<CastBlinkBackAction*>(action))
     {
         return 0.0f;
     }
 
-    if (botAI->IsRanged(bot) && dynamic_cast<ReachTargetAction*>(action))
+    if (botAI->IsRanged(bot) && action->HasCategory(ACTION_CATEGORY_REACH_TARGET))
         return 0.0f;
 
     return 1.0f;
@@ -211,7 +210,7 @@ float TeronGorefiendDisableAttackingConstructsMultiplier::GetValue(Action* actio
         return 1.0f;
 
     if (bot->GetVictim() != nullptr &&
-        dynamic_cast<TankAssistAction*>(action))
+        action->HasCategory(ACTION_CATEGORY_TANK_ASSIST))
     {
         return 0.0f;
     }
@@ -251,14 +250,13 @@ float GurtoggBloodboilControlMovementMultiplier::GetValue(Action* action)
     if (!AI_VALUE2(Unit*, "find target", "gurtogg bloodboil"))
         return 1.0f;
 
-    if (dynamic_cast<CombatFormationMoveAction*>(action) &&
+    if (action->HasCategory(ACTION_CATEGORY_COMBAT_FORMATION_MOVE) &&
         !dynamic_cast<SetBehindTargetAction*>(action))
     {
         return 0.0f;
     }
 
-    if (dynamic_cast<FollowAction*>(action) ||
-        dynamic_cast<FleeAction*>(action) ||
+    if (action->HasCategory(ACTION_CATEGORY_FOLLOW | ACTION_CATEGORY_FLEE) ||
         dynamic_cast<CastDisengageAction*>(action) ||
         dynamic_cast<CastBlinkBackAction*>(action))
     {
@@ -266,8 +264,8 @@ float GurtoggBloodboilControlMovementMultiplier::GetValue(Action* action)
     }
 
     if (bot->HasAura(static_cast<uint32>(BlackTempleSpells::SPELL_PLAYER_FEL_RAGE)) &&
-        (dynamic_cast<MovementAction*>(action) &&
-         !dynamic_cast<AttackAction*>(action)))
+        (action->HasCategory(ACTION_CATEGORY_MOVEMENT) &&
+         !action->HasCategory(ACTION_CATEGORY_ATTACK)))
     {
         return 0.0f;
     }
@@ -306,7 +304,7 @@ float ReliquaryOfSoulsDontWasteHealingMultiplier::GetValue(Action* action)
     }
 
     if (dynamic_cast<CastTreeFormAction*>(action) ||
-        dynamic_cast<CastHealingSpellAction*>(action))
+        action->HasCategory(ACTION_CATEGORY_HEAL))
     {
         return 0.0f;
     }
@@ -336,14 +334,13 @@ float MotherShahrazControlMovementMultiplier::GetValue(Action* action)
     if (!AI_VALUE2(Unit*, "find target", "mother shahraz"))
         return 1.0f;
 
-    if (dynamic_cast<CombatFormationMoveAction*>(action) &&
+    if (action->HasCategory(ACTION_CATEGORY_COMBAT_FORMATION_MOVE) &&
         !dynamic_cast<SetBehindTargetAction*>(action))
     {
         return 0.0f;
     }
 
-    if (dynamic_cast<FollowAction*>(action) ||
-        dynamic_cast<FleeAction*>(action) ||
+    if (action->HasCategory(ACTION_CATEGORY_FOLLOW | ACTION_CATEGORY_FLEE) ||
         dynamic_cast<CastDisengageAction*>(action) ||
         dynamic_cast<CastBlinkBackAction*>(action))
     {
@@ -395,18 +392,15 @@ float IllidariCouncilDisableTankActionsMultiplier::GetValue(Action* action)
         return 1.0f;
     }
 
-    if (bot->GetVictim() != nullptr && dynamic_cast<TankAssistAction*>(action))
+    if (bot->GetVictim() != nullptr && action->HasCategory(ACTION_CATEGORY_TANK_ASSIST))
         return 0.0f;
 
-    if (dynamic_cast<CastTauntAction*>(action) ||
+    if (action->HasCategory(ACTION_CATEGORY_TAUNT) ||
         dynamic_cast<CastChallengingShoutAction*>(action) ||
         dynamic_cast<CastShockwaveAction*>(action) ||
         dynamic_cast<CastCleaveAction*>(action) ||
-        dynamic_cast<CastGrowlAction*>(action) ||
         dynamic_cast<CastSwipeAction*>(action) ||
-        dynamic_cast<CastHandOfReckoningAction*>(action) ||
         dynamic_cast<CastRighteousDefenseAction*>(action) ||
-        dynamic_cast<CastDarkCommandAction*>(action) ||
         dynamic_cast<CastDeathAndDecayAction*>(action) ||
         dynamic_cast<CastBloodBoilAction*>(action))
     {
@@ -421,15 +415,14 @@ float IllidariCouncilControlMovementMultiplier::GetValue(Action* action)
     if (!AI_VALUE2(Unit*, "find target", "high nethermancer zerevor"))
         return 1.0f;
 
-    if (dynamic_cast<CombatFormationMoveAction*>(action) &&
+    if (action->HasCategory(ACTION_CATEGORY_COMBAT_FORMATION_MOVE) &&
         !dynamic_cast<SetBehindTargetAction*>(action) &&
         !dynamic_cast<TankFaceAction*>(action))
     {
         return 0.0f;
     }
 
-    if (dynamic_cast<FollowAction*>(action) ||
-        dynamic_cast<FleeAction*>(action) ||
+    if (action->HasCategory(ACTION_CATEGORY_FOLLOW | ACTION_CATEGORY_FLEE) ||
         dynamic_cast<CastDisengageAction*>(action) ||
         dynamic_cast<CastBlinkBackAction*>(action))
     {
@@ -437,7 +430,7 @@ float IllidariCouncilControlMovementMultiplier::GetValue(Action* action)
     }
 
     if (botAI->IsAssistHealOfIndex(bot, 0, true) &&
-        (dynamic_cast<MovementAction*>(action) &&
+        (action->HasCategory(ACTION_CATEGORY_MOVEMENT) &&
          !dynamic_cast<IllidariCouncilPositionMageTankHealerAction*>(action)))
     {
         return 0.0f;
@@ -453,7 +446,7 @@ float IllidariCouncilControlMovementMultiplier::GetValue(Action* action)
          botAI->IsAssistTankOfIndex(bot, 0, false) ||
          botAI->IsAssistTankOfIndex(bot, 1, false) ||
          GetZerevorMageTank(bot) == bot) &&
-        dynamic_cast<AvoidAoeAction*>(action))
+        action->HasCategory(ACTION_CATEGORY_AVOID_AOE))
     {
         return 0.0f;
     }
@@ -532,9 +525,9 @@ float IllidariCouncilWaitForDpsMultiplier::GetValue(Action* action)
     if (it == councilDpsWaitTimer.end() || (now - it->second) >= dpsWaitSeconds)
         return 1.0f;
 
-    if (dynamic_cast<AttackAction*>(action) ||
-        (dynamic_cast<CastSpellAction*>(action) &&
-         !dynamic_cast<CastHealingSpellAction*>(action)))
+    if (action->HasCategory(ACTION_CATEGORY_ATTACK) ||
+        (action->HasCategory(ACTION_CATEGORY_SPELL) &&
+         !action->HasCategory(ACTION_CATEGORY_HEAL)))
     {
         return 0.0f;
     }
@@ -586,14 +579,14 @@ float IllidanStormrageControlTankActionsMultiplier::GetValue(Action* action)
 
     if (botAI->IsMainTank(bot))
     {
-        if (dynamic_cast<MovementAction*>(action) &&
+        if (action->HasCategory(ACTION_CATEGORY_MOVEMENT) &&
             !dynamic_cast<IllidanStormragePositionAboveGrateAction*>(action))
         {
             return 0.0f;
         }
 
         if (dynamic_cast<CastMeleeSpellAction*>(action) ||
-            dynamic_cast<CastReachTargetSpellAction*>(action))
+            action->HasCategory(ACTION_CATEGORY_REACH_SPELL))
         {
             return 0.0f;
         }
@@ -601,13 +594,13 @@ float IllidanStormrageControlTankActionsMultiplier::GetValue(Action* action)
     else if (botAI->IsAssistTankOfIndex(bot, 0, false) ||
              botAI->IsAssistTankOfIndex(bot, 1, false))
     {
-        if (dynamic_cast<MovementAction*>(action) &&
+        if (action->HasCategory(ACTION_CATEGORY_MOVEMENT) &&
             !dynamic_cast<IllidanStormrageAssistTanksHandleFlamesOfAzzinothAction*>(action))
         {
             return 0.0f;
         }
 
-        if (dynamic_cast<CastHealingSpellAction*>(action))
+        if (action->HasCategory(ACTION_CATEGORY_HEAL))
             return 0.0f;
     }
 
@@ -623,12 +616,12 @@ float IllidanStormrageDisableDefaultTargetingMultiplier::GetValue(Action* action
     if (!illidan || illidan->GetHealth() == 1)
         return 1.0f;
 
-    if (dynamic_cast<TankAssistAction*>(action))
+    if (action->HasCategory(ACTION_CATEGORY_TANK_ASSIST))
         return 0.0f;
 
     int phase = GetIllidanPhase(illidan);
 
-    if (phase == 4 && dynamic_cast<DpsAssistAction*>(action))
+    if (phase == 4 && action->HasCategory(ACTION_CATEGORY_DPS_ASSIST))
         return 0.0f;
 
     if (botAI->IsRangedDps(bot))
@@ -636,7 +629,7 @@ float IllidanStormrageDisableDefaultTargetingMultiplier::GetValue(Action* action
         if (phase != 2)
             context->GetValue<bool>("neglect threat")->Set(true);
 
-        if (dynamic_cast<DpsAssistAction*>(action))
+        if (action->HasCategory(ACTION_CATEGORY_DPS_ASSIST))
             return 0.0f;
     }
 
@@ -665,7 +658,7 @@ float IllidanStormrageControlNonTankMovementMultiplier::GetValue(Action* action)
     if (!illidan || illidan->GetHealth() == 1)
         return 1.0f;
 
-    if (dynamic_cast<CombatFormationMoveAction*>(action) &&
+    if (action->HasCategory(ACTION_CATEGORY_COMBAT_FORMATION_MOVE) &&
         !dynamic_cast<SetBehindTargetAction*>(action))
     {
         return 0.0f;
@@ -673,8 +666,7 @@ float IllidanStormrageControlNonTankMovementMultiplier::GetValue(Action* action)
 
     if (dynamic_cast<CastDisengageAction*>(action) ||
         dynamic_cast<CastBlinkBackAction*>(action) ||
-        dynamic_cast<FleeAction*>(action) ||
-        dynamic_cast<FollowAction*>(action))
+        action->HasCategory(ACTION_CATEGORY_FLEE | ACTION_CATEGORY_FOLLOW))
     {
         return 0.0f;
     }
@@ -684,15 +676,13 @@ float IllidanStormrageControlNonTankMovementMultiplier::GetValue(Action* action)
     if (phase == 2 &&
         (dynamic_cast<SetBehindTargetAction*>(action) ||
          dynamic_cast<CastKillingSpreeAction*>(action) ||
-         dynamic_cast<ReachTargetAction*>(action) ||
-         dynamic_cast<CastReachTargetSpellAction*>(action) ||
-         dynamic_cast<AvoidAoeAction*>(action)))
+         action->HasCategory(ACTION_CATEGORY_REACH_TARGET | ACTION_CATEGORY_REACH_SPELL | ACTION_CATEGORY_AVOID_AOE)))
     {
         return 0.0f;
     }
 
     if (phase == 4 && botAI->IsHeal(bot) &&
-        dynamic_cast<ReachTargetAction*>(action))
+        action->HasCategory(ACTION_CATEGORY_REACH_TARGET))
     {
         return 0.0f;
     }
@@ -742,9 +732,9 @@ float IllidanStormrageWaitForDpsMultiplier::GetValue(Action* action)
 
         if ((it == illidanBossDpsWaitTimer.end() ||
              (now - it->second) < humanoidPhaseDpsWaitSeconds) &&
-              (dynamic_cast<AttackAction*>(action) ||
-               (dynamic_cast<CastSpellAction*>(action) &&
-                !dynamic_cast<CastHealingSpellAction*>(action))))
+              (action->HasCategory(ACTION_CATEGORY_ATTACK) ||
+               (action->HasCategory(ACTION_CATEGORY_SPELL) &&
+                !action->HasCategory(ACTION_CATEGORY_HEAL))))
         {
             return 0.0f;
         }
@@ -757,9 +747,9 @@ float IllidanStormrageWaitForDpsMultiplier::GetValue(Action* action)
 
         if ((it == illidanBossDpsWaitTimer.end() ||
              (now - it->second) < demonPhaseDpsWaitSeconds) &&
-              (dynamic_cast<AttackAction*>(action) ||
-               (dynamic_cast<CastSpellAction*>(action) &&
-                !dynamic_cast<CastHealingSpellAction*>(action))))
+              (action->HasCategory(ACTION_CATEGORY_ATTACK) ||
+               (action->HasCategory(ACTION_CATEGORY_SPELL) &&
+                !action->HasCategory(ACTION_CATEGORY_HEAL))))
         {
             return 0.0f;
         }
@@ -774,9 +764,9 @@ float IllidanStormrageWaitForDpsMultiplier::GetValue(Action* action)
 
         if ((it == illidanFlameDpsWaitTimer.end() ||
              (now - it->second) < flamePhaseDpsWaitSeconds) &&
-              (dynamic_cast<AttackAction*>(action) ||
-               (dynamic_cast<CastSpellAction*>(action) &&
-                !dynamic_cast<CastHealingSpellAction*>(action))))
+              (action->HasCategory(ACTION_CATEGORY_ATTACK) ||
+               (action->HasCategory(ACTION_CATEGORY_SPELL) &&
+                !action->HasCategory(ACTION_CATEGORY_HEAL))))
         {
             return 0.0f;
         }
@@ -31,7 +31,7 @@ float RazorgoreTankMultiplier::GetValue(Action* action)
     if (AreRazorgoreEggsAlive(botAI))
     {
         // Off-tank picks up boss, blocks TankAssistAction to avoid changing targets
-        if (IsRazorgoreOffTank(bot) && bot->GetVictim() != nullptr && dynamic_cast<TankAssistAction*>(action))
+        if (IsRazorgoreOffTank(bot) && bot->GetVictim() != nullptr && action->HasCategory(ACTION_CATEGORY_TANK_ASSIST))
             return 0.0f;
         return 1.0f;
     }
@@ -67,7 +67,7 @@ float VaelastraszBurningAdrenalineMultiplier::GetValue(Action* action)
 {
     if (bot->HasAura(static_cast<uint32>(BlackwingLairSpells::SPELL_BURNING_ADRENALINE)))
     {
-        if (dynamic_cast<MovementAction*>(action))
+        if (action->HasCategory(ACTION_CATEGORY_MOVEMENT))
         {
             if (dynamic_cast<BwlVaelastraszMoveAwayAction*>(action))
             {
@@ -83,7 +83,7 @@ float VaelastraszBurningAdrenalineMultiplier::GetValue(Action* action)
                 return 0.0f;
         }
         // Also block charge actions
-        if (dynamic_cast<CastReachTargetSpellAction*>(action))
+        if (action->HasCategory(ACTION_CATEGORY_REACH_SPELL))
             return 0.0f;
     }
 
@@ -24,12 +24,12 @@ float MalygosMultiplier::GetValue(Action* action)
 
     if (phase == 1)
     {
-        if (dynamic_cast<FollowAction*>(action))
+        if (action->HasCategory(ACTION_CATEGORY_FOLLOW))
         {
             return 0.0f;
         }
 
-        if (botAI->IsDps(bot) && dynamic_cast<DpsAssistAction*>(action))
+        if (botAI->IsDps(bot) && action->HasCategory(ACTION_CATEGORY_DPS_ASSIST))
         {
             return 0.0f;
         }
@@ -39,29 +39,29 @@ float MalygosMultiplier::GetValue(Action* action)
             return 0.0f;
         }
 
-        if (!botAI->IsMainTank(bot) && dynamic_cast<TankAssistAction*>(action))
+        if (!botAI->IsMainTank(bot) && action->HasCategory(ACTION_CATEGORY_TANK_ASSIST))
         {
             return 0.0f;
         }
 
-        // if (dynamic_cast<MovementAction*>(action) && !dynamic_cast<MalygosPositionAction*>(action))
+        // if (action->HasCategory(ACTION_CATEGORY_MOVEMENT) && !dynamic_cast<MalygosPositionAction*>(action))
         // {
         //     return 0.0f;
         // }
     }
     else if (phase == 2)
     {
-        if (botAI->IsDps(bot) && dynamic_cast<DpsAssistAction*>(action))
+        if (botAI->IsDps(bot) && action->HasCategory(ACTION_CATEGORY_DPS_ASSIST))
         {
             return 0.0f;
         }
 
-        if (dynamic_cast<FleeAction*>(action))
+        if (action->HasCategory(ACTION_CATEGORY_FLEE))
         {
             return 0.0f;
         }
 
-        if (dynamic_cast<TankAssistAction*>(action))
+        if (action->HasCategory(ACTION_CATEGORY_TANK_ASSIST))
         {
             Unit* target = action->GetTarget();
             if (target && target->GetEntry() == NPC_SCION_OF_ETERNITY)
@@ -71,7 +71,7 @@ float MalygosMultiplier::GetValue(Action* action)
     else if (phase == 3)
     {
         // Suppresses FollowAction as well as some attack-based movements
-        if (dynamic_cast<MovementAction*>(action) && !dynamic_cast<EoEFlyDrakeAction*>(action))
+        if (action->HasCategory(ACTION_CATEGORY_MOVEMENT) && !dynamic_cast<EoEFlyDrakeAction*>(action))
         {
             return 0.0f;
         }
@@ -36,8 +36,8 @@ float HighKingMaulgarControlTankActionsMultiplier::GetValue(Action* action)
     if (!AI_VALUE2(Unit*, "find target", "high king maulgar"))
         return 1.0f;
 
-    if (dynamic_cast<CombatFormationMoveAction*>(action) ||
-        (bot->GetVictim() != nullptr && dynamic_cast<TankAssistAction*>(action)))
+    if (action->HasCategory(ACTION_CATEGORY_COMBAT_FORMATION_MOVE) ||
+        (bot->GetVictim() != nullptr && action->HasCategory(ACTION_CATEGORY_TANK_ASSIST)))
     {
         return 0.0f;
     }
@@ -60,8 +60,8 @@ float HighKingMaulgarAvoidWhirlwindMultiplier::GetValue(Action* action)
     if (botAI->IsMainTank(bot))
         return 1.0f;
 
-    if (dynamic_cast<CastReachTargetSpellAction*>(action) ||
-        (dynamic_cast<MovementAction*>(action) &&
+    if (action->HasCategory(ACTION_CATEGORY_REACH_SPELL) ||
+        (action->HasCategory(ACTION_CATEGORY_MOVEMENT) &&
          !dynamic_cast<HighKingMaulgarRunAwayFromWhirlwindAction*>(action)))
     {
         return 0.0f;
@@ -128,8 +128,7 @@ float GruulTheDragonkillerControlTankMovementMultiplier::GetValue(Action* action
     if (!gruul || gruul->GetVictim() != bot)
         return 1.0f;
 
-    if (dynamic_cast<CombatFormationMoveAction*>(action) ||
-        dynamic_cast<AvoidAoeAction*>(action))
+    if (action->HasCategory(ACTION_CATEGORY_COMBAT_FORMATION_MOVE | ACTION_CATEGORY_AVOID_AOE))
     {
         return 0.0f;
     }
@@ -145,8 +144,8 @@ float GruulTheDragonkillerStaySpreadForShatterMultiplier::GetValue(Action* actio
         return 1.0f;
     }
 
-    if (dynamic_cast<CastReachTargetSpellAction*>(action) ||
-        (dynamic_cast<MovementAction*>(action) &&
+    if (action->HasCategory(ACTION_CATEGORY_REACH_SPELL) ||
+        (action->HasCategory(ACTION_CATEGORY_MOVEMENT) &&
          !dynamic_cast<GruulTheDragonkillerShatterSpreadAction*>(action)))
     {
          return 0.0f;
@@ -15,7 +15,8 @@ class HighKingMaulgarControlTankActionsMultiplier : public Multiplier
 {
 public:
     HighKingMaulgarControlTankActionsMultiplier(
-        PlayerbotAI* botAI) : Multiplier(botAI, "high king maulgar control tank actions multiplier") {}
+        PlayerbotAI* botAI) : Multiplier(botAI, "high king maulgar control tank actions multiplier",
+            ACTION_CATEGORY_COMBAT_FORMATION_MOVE | ACTION_CATEGORY_TANK_ASSIST) {}
     float GetValue(Action* action) override;
 };
 
@@ -55,7 +56,8 @@ class GruulTheDragonkillerControlTankMovementMultiplier : public Multiplier
 {
 public:
     GruulTheDragonkillerControlTankMovementMultiplier(
-        PlayerbotAI* botAI) : Multiplier(botAI, "gruul the dragonkiller control tank movement multiplier") {}
+        PlayerbotAI* botAI) : Multiplier(botAI, "gruul the dragonkiller control tank movement multiplier",
+            ACTION_CATEGORY_COMBAT_FORMATION_MOVE | ACTION_CATEGORY_AVOID_AOE) {}
     float GetValue(Action* action) override;
 };
 
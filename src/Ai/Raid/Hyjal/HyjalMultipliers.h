@@ -41,7 +41,8 @@ class AnetheronDisableTankActionsMultiplier : public Multiplier
 {
 public:
     AnetheronDisableTankActionsMultiplier(
-        PlayerbotAI* botAI) : Multiplier(botAI, "anetheron disable tank actions multiplier") {}
+        PlayerbotAI* botAI) : Multiplier(botAI, "anetheron disable tank actions multiplier",
+            ACTION_CATEGORY_AVOID_AOE | ACTION_CATEGORY_TANK_ASSIST) {}
     virtual float GetValue(Action* action);
 };
 
@@ -36,7 +36,8 @@ float IccLadyDeathwhisperMultiplier::GetValue(Action* action)
     if (!boss)
         return 1.0f;
 
-    if (dynamic_cast<FleeAction*>(action) || dynamic_cast<CastBlinkBackAction*>(action) || dynamic_cast<FollowAction*>(action) || dynamic_cast<CombatFormationMoveAction*>(action))
+    if (action->HasCategory(ACTION_CATEGORY_FLEE) || dynamic_cast<CastBlinkBackAction*>(action) ||
+        action->HasCategory(ACTION_CATEGORY_FOLLOW | ACTION_CATEGORY_COMBAT_FORMATION_MOVE))
         return 0.0f;
 
     static constexpr uint32 VENGEFUL_SHADE_ID = NPC_SHADE;
@@ -71,12 +72,12 @@ float IccAddsDbsMultiplier::GetValue(Action* action)
     if (!boss)
         return 1.0f;
 
-    if (dynamic_cast<DpsAoeAction*>(action) || dynamic_cast<CastHurricaneAction*>(action) ||
+    if (action->HasCategory(ACTION_CATEGORY_DPS_AOE) || dynamic_cast<CastHurricaneAction*>(action) ||
         dynamic_cast<CastVolleyAction*>(action) || dynamic_cast<CastBlizzardAction*>(action) ||
         dynamic_cast<CastStarfallAction*>(action) || dynamic_cast<FanOfKnivesAction*>(action) ||
         dynamic_cast<CastWhirlwindAction*>(action) || dynamic_cast<CastMindSearAction*>(action) ||
-        dynamic_cast<CombatFormationMoveAction*>(action) || dynamic_cast<FollowAction*>(action) ||
-        dynamic_cast<FleeAction*>(action) || dynamic_cast<CastArmyOfTheDeadAction*>(action))
+        action->HasCategory(ACTION_CATEGORY_COMBAT_FORMATION_MOVE | ACTION_CATEGORY_FOLLOW | ACTION_CATEGORY_FLEE) ||
+        dynamic_cast<CastArmyOfTheDeadAction*>(action))
         return 0.0f;
 
     if (botAI->IsRanged(bot))
@@ -88,13 +89,10 @@ float IccAddsDbsMultiplier::GetValue(Action* action)
         Aura* aura = botAI->GetAura("rune of blood", bot);
         if (aura)
         {
-            if (dynamic_cast<CastTauntAction*>(action) ||
-                dynamic_cast<CastDarkCommandAction*>(action) ||
-                dynamic_cast<CastHandOfReckoningAction*>(action) ||
-                dynamic_cast<CastGrowlAction*>(action))
+            if (action->HasCategory(ACTION_CATEGORY_TAUNT))
                 return 0.0f;
 
-            if (dynamic_cast<MovementAction*>(action))
+            if (action->HasCategory(ACTION_CATEGORY_MOVEMENT))
                 return 1.0f;
 
             return 0.0f;
@@ -115,7 +113,7 @@ float IccGunshipMultiplier::GetValue(Action* action)
     if (!inGunship)
         return 1.0f;
 
-    if (dynamic_cast<CombatFormationMoveAction*>(action) || dynamic_cast<FollowAction*>(action))
+    if (action->HasCategory(ACTION_CATEGORY_COMBAT_FORMATION_MOVE | ACTION_CATEGORY_FOLLOW))
         return 0.0f;
 
     // Main tank is locked to captain via IccGunshipRocketJumpAction — block RTI targeting
@@ -157,20 +155,17 @@ float IccDogsMultiplier::GetValue(Action* action)
         Aura* aura = botAI->GetAura("mortal wound", bot, false, true);
         if (aura && aura->GetStackAmount() >= 8)
         {
-            if (dynamic_cast<MovementAction*>(action))
+            if (action->HasCategory(ACTION_CATEGORY_MOVEMENT))
                 return 1.0f;
 
-            if (dynamic_cast<CastTauntAction*>(action) ||
-                dynamic_cast<CastDarkCommandAction*>(action) ||
-                dynamic_cast<CastHandOfReckoningAction*>(action) ||
-                dynamic_cast<CastGrowlAction*>(action))
+            if (action->HasCategory(ACTION_CATEGORY_TAUNT))
                 return 0.0f;
 
             return 0.0f;
         }
     }
 
-    if (dynamic_cast<CombatFormationMoveAction*>(action) || dynamic_cast<FollowAction*>(action))
+    if (action->HasCategory(ACTION_CATEGORY_COMBAT_FORMATION_MOVE | ACTION_CATEGORY_FOLLOW))
         return 0.0f;
 
     return 1.0f;
@@ -183,10 +178,10 @@ float IccFestergutMultiplier::GetValue(Action* action)
     if (!boss)
         return 1.0f;
 
-    if (dynamic_cast<CombatFormationMoveAction*>(action) || dynamic_cast<FollowAction*>(action))
+    if (action->HasCategory(ACTION_CATEGORY_COMBAT_FORMATION_MOVE | ACTION_CATEGORY_FOLLOW))
         return 0.0f;
 
-    if (dynamic_cast<FleeAction*>(action))
+    if (action->HasCategory(ACTION_CATEGORY_FLEE))
         return 0.0f;
 
     if (dynamic_cast<CastDisengageAction*>(action) || dynamic_cast<CastBlinkBackAction*>(action))
@@ -197,13 +192,10 @@ float IccFestergutMultiplier::GetValue(Action* action)
         Aura* aura = botAI->GetAura("gastric bloat", bot, false, true);
         if (aura && aura->GetStackAmount() >= 6)
         {
-            if (dynamic_cast<CastTauntAction*>(action) ||
-                dynamic_cast<CastDarkCommandAction*>(action) ||
-                dynamic_cast<CastHandOfReckoningAction*>(action) ||
-                dynamic_cast<CastGrowlAction*>(action))
+            if (action->HasCategory(ACTION_CATEGORY_TAUNT))
                 return 0.0f;
 
-            if (dynamic_cast<MovementAction*>(action))
+            if (action->HasCategory(ACTION_CATEGORY_MOVEMENT))
                 return 1.0f;
 
             return 0.0f;
@@ -215,7 +207,7 @@ float IccFestergutMultiplier::GetValue(Action* action)
 
     if (bot->HasAura(SPELL_GAS_SPORE))
     {
-        if (dynamic_cast<MovementAction*>(action) || dynamic_cast<FleeAction*>(action) ||
+        if (action->HasCategory(ACTION_CATEGORY_MOVEMENT | ACTION_CATEGORY_FLEE) ||
             dynamic_cast<ReachSpellAction*>(action))
             return 0.0f;
     }
@@ -231,7 +223,7 @@ float IccFestergutMultiplier::GetValue(Action* action)
             if (dynamic_cast<IccFestergutAvoidMalleableGooAction*>(action))
                 return 1.0f;
 
-            if (dynamic_cast<MovementAction*>(action))
+            if (action->HasCategory(ACTION_CATEGORY_MOVEMENT))
                 return 0.0f;
         }
     }
@@ -261,7 +253,7 @@ float IccRotfaceMultiplier::GetValue(Action* action)
         {
             if (dynamic_cast<IccRotfaceAvoidVileGasAction*>(action))
                 return 1.0f;
-            if (dynamic_cast<MovementAction*>(action))
+            if (action->HasCategory(ACTION_CATEGORY_MOVEMENT))
                 return 0.0f;
         }
     }
@@ -269,22 +261,21 @@ float IccRotfaceMultiplier::GetValue(Action* action)
     if (botAI->HasAura("Vile Gas", bot))
         return 0.0f;
 
-    if (botAI->IsTank(bot) && dynamic_cast<TankAssistAction*>(action))
+    if (botAI->IsTank(bot) && action->HasCategory(ACTION_CATEGORY_TANK_ASSIST))
         return 0.0f;
 
-    if (dynamic_cast<CombatFormationMoveAction*>(action) || dynamic_cast<AvoidAoeAction*>(action))
+    if (action->HasCategory(ACTION_CATEGORY_COMBAT_FORMATION_MOVE | ACTION_CATEGORY_AVOID_AOE))
         return 0.0f;
 
-    if (dynamic_cast<FleeAction*>(action) && !(bot->getClass() == CLASS_HUNTER))
+    if (action->HasCategory(ACTION_CATEGORY_FLEE) && !(bot->getClass() == CLASS_HUNTER))
         return 0.0f;
 
     if (dynamic_cast<CastBlinkBackAction*>(action) || dynamic_cast<CastArmyOfTheDeadAction*>(action))
         return 0.0f;
 
     if (botAI->IsAssistTank(bot) &&
-        (dynamic_cast<AttackRtiTargetAction*>(action) || dynamic_cast<TankAssistAction*>(action) ||
-         dynamic_cast<CastTauntAction*>(action) || dynamic_cast<CastDarkCommandAction*>(action) ||
-         dynamic_cast<CastHandOfReckoningAction*>(action) || dynamic_cast<CastGrowlAction*>(action)))
+        (dynamic_cast<AttackRtiTargetAction*>(action) ||
+        action->HasCategory(ACTION_CATEGORY_TANK_ASSIST | ACTION_CATEGORY_TAUNT)))
         return 0.0f;
 
     if (botAI->IsAssistTank(bot) && boss1 && bot->GetVictim() == boss1)
@@ -305,7 +296,8 @@ float IccRotfaceMultiplier::GetValue(Action* action)
         bool castingNow = bigOoze && bigOoze->IsAlive() &&
             bigOoze->HasUnitState(UNIT_STATE_CASTING) && bigOoze->FindCurrentSpellBySpellId(SPELL_UNSTABLE_OOZE_EXPLOSION);
 
-        if (castingNow && (dynamic_cast<MovementAction*>(action) || dynamic_cast<IccRotfaceGroupPositionAction*>(action)) &&
+        if (castingNow && (action->HasCategory(ACTION_CATEGORY_MOVEMENT) ||
+            dynamic_cast<IccRotfaceGroupPositionAction*>(action)) &&
             !dynamic_cast<IccRotfaceMoveAwayFromExplosionAction*>(action))
             return 0.0f;
     }
@@ -343,16 +335,16 @@ float IccAddsPutricideMultiplier::GetValue(Action* action)
     if (botAI->IsTank(bot) &&
         bot->GetMotionMaster()->GetCurrentMovementGeneratorType() == FOLLOW_MOTION_TYPE)
     {
-        if (dynamic_cast<FollowAction*>(action) ||
+        if (action->HasCategory(ACTION_CATEGORY_FOLLOW) ||
             dynamic_cast<IccPutricideAvoidMalleableGooAction*>(action))
             return 1.0f;
         return 0.0f;
     }
 
-    if (!(bot->getClass() == CLASS_HUNTER) && dynamic_cast<FleeAction*>(action))
+    if (!(bot->getClass() == CLASS_HUNTER) && action->HasCategory(ACTION_CATEGORY_FLEE))
         return 0.0f;
 
-    if (dynamic_cast<CombatFormationMoveAction*>(action))
+    if (action->HasCategory(ACTION_CATEGORY_COMBAT_FORMATION_MOVE))
         return 0.0f;
 
     if (dynamic_cast<CastDisengageAction*>(action))
@@ -398,13 +390,10 @@ float IccAddsPutricideMultiplier::GetValue(Action* action)
 
         if (anotherTankHasFewer)
         {
-            if (dynamic_cast<CastTauntAction*>(action) ||
-                dynamic_cast<CastDarkCommandAction*>(action) ||
-                dynamic_cast<CastHandOfReckoningAction*>(action) ||
-                dynamic_cast<CastGrowlAction*>(action))
+            if (action->HasCategory(ACTION_CATEGORY_TAUNT))
                 return 0.0f;
 
-            if (dynamic_cast<MovementAction*>(action))
+            if (action->HasCategory(ACTION_CATEGORY_MOVEMENT))
                 return 1.0f;
 
             if (dynamic_cast<IccPutricideMutatedPlagueAction*>(action))
@@ -454,7 +443,7 @@ float IccBpcAssistMultiplier::GetValue(Action* action)
     if (!keleseth)
         return 1.0f;
 
-    if (keleseth && (dynamic_cast<DpsAoeAction*>(action) || dynamic_cast<CastHurricaneAction*>(action) ||
+    if (keleseth && (action->HasCategory(ACTION_CATEGORY_DPS_AOE) || dynamic_cast<CastHurricaneAction*>(action) ||
         dynamic_cast<CastVolleyAction*>(action) || dynamic_cast<CastBlizzardAction*>(action) ||
         dynamic_cast<CastStarfallAction*>(action) || dynamic_cast<FanOfKnivesAction*>(action) ||
         dynamic_cast<CastWhirlwindAction*>(action) || dynamic_cast<CastMindSearAction*>(action) ||
@@ -551,13 +540,13 @@ float IccBpcAssistMultiplier::GetValue(Action* action)
     // Bomb-assigned bot: block target switching and non-bomb BPC actions, allow combat rotation
     if (botAssignedToBomb)
     {
-        if (dynamic_cast<IccBpcKineticBombAction*>(action) || dynamic_cast<AvoidAoeAction*>(action))
+        if (dynamic_cast<IccBpcKineticBombAction*>(action) || action->HasCategory(ACTION_CATEGORY_AVOID_AOE))
             return 1.0f;
 
-        if (dynamic_cast<DpsAssistAction*>(action) || dynamic_cast<TankAssistAction*>(action) ||
+        if (action->HasCategory(ACTION_CATEGORY_DPS_ASSIST | ACTION_CATEGORY_TANK_ASSIST) ||
             dynamic_cast<AttackRtiTargetAction*>(action) || dynamic_cast<IccBpcEmpoweredVortexAction*>(action) ||
-            dynamic_cast<IccBpcBallOfFlameAction*>(action) || dynamic_cast<CombatFormationMoveAction*>(action) ||
-            dynamic_cast<FollowAction*>(action))
+            dynamic_cast<IccBpcBallOfFlameAction*>(action) ||
+            action->HasCategory(ACTION_CATEGORY_COMBAT_FORMATION_MOVE | ACTION_CATEGORY_FOLLOW))
             return 0.0f;
     }
 
@@ -566,13 +555,13 @@ float IccBpcAssistMultiplier::GetValue(Action* action)
     {
         if (aura->GetStackAmount() > 18 && botAI->IsTank(bot))
         {
-            if (dynamic_cast<MovementAction*>(action))
+            if (action->HasCategory(ACTION_CATEGORY_MOVEMENT))
                 return 0.0f;
         }
 
         if (aura->GetStackAmount() > 12 && !botAI->IsTank(bot))
         {
-            if (dynamic_cast<MovementAction*>(action))
+            if (action->HasCategory(ACTION_CATEGORY_MOVEMENT))
                 return 0.0f;
         }
     }
@@ -587,7 +576,7 @@ float IccBpcAssistMultiplier::GetValue(Action* action)
          valanar->FindCurrentSpellBySpellId(SPELL_EMPOWERED_SHOCK_VORTEX3) ||
          valanar->FindCurrentSpellBySpellId(SPELL_EMPOWERED_SHOCK_VORTEX4)))
     {
-        if (dynamic_cast<AvoidAoeAction*>(action) || dynamic_cast<IccBpcEmpoweredVortexAction*>(action))
+        if (action->HasCategory(ACTION_CATEGORY_AVOID_AOE) || dynamic_cast<IccBpcEmpoweredVortexAction*>(action))
             return 1.0f;
         else
             return 0.0f;
@@ -600,7 +589,7 @@ float IccBpcAssistMultiplier::GetValue(Action* action)
 
     if (flame2)
     {
-        if (dynamic_cast<AvoidAoeAction*>(action) || dynamic_cast<IccBpcKineticBombAction*>(action))
+        if (action->HasCategory(ACTION_CATEGORY_AVOID_AOE) || dynamic_cast<IccBpcKineticBombAction*>(action))
             return 0.0f;
 
         if (dynamic_cast<IccBpcBallOfFlameAction*>(action))
@@ -623,8 +612,7 @@ float IccBpcAssistMultiplier::GetValue(Action* action)
             return 1.0f;
 
         // Disable normal assist behavior (allow RTI targeting)
-        if (dynamic_cast<TankAssistAction*>(action) ||
-            dynamic_cast<FleeAction*>(action) ||
+        if (action->HasCategory(ACTION_CATEGORY_TANK_ASSIST | ACTION_CATEGORY_FLEE) ||
             dynamic_cast<CastConsecrationAction*>(action))
             return 0.0f;
     }
@@ -643,8 +631,8 @@ float IccBqlMultiplier::GetValue(Action* action)
     Aura* aura = botAI->GetAura("Frenzied Bloodthirst", bot);
 
     if (botAI->IsRanged(bot))
-        if (dynamic_cast<AvoidAoeAction*>(action) || dynamic_cast<FleeAction*>(action) ||
-            dynamic_cast<CombatFormationMoveAction*>(action) || dynamic_cast<CastDisengageAction*>(action))
+        if (action->HasCategory(ACTION_CATEGORY_AVOID_AOE | ACTION_CATEGORY_FLEE |
+                                ACTION_CATEGORY_COMBAT_FORMATION_MOVE) || dynamic_cast<CastDisengageAction*>(action))
             return 0.0f;
 
     // If bot has Pact of Darkfallen aura, return 0 for all other actions
@@ -659,9 +647,9 @@ float IccBqlMultiplier::GetValue(Action* action)
     // Air phase: block movement/chase actions, allow combat rotation (attacks/heals)
     if (((boss->GetPositionZ() - ICC_BQL_CENTER_POSITION.GetPositionZ()) > 5.0f) && !aura)
     {
-        if (dynamic_cast<AvoidAoeAction*>(action) || dynamic_cast<FleeAction*>(action) ||
-            dynamic_cast<CombatFormationMoveAction*>(action) || dynamic_cast<CastDisengageAction*>(action) ||
-            dynamic_cast<ReachMeleeAction*>(action) || dynamic_cast<ReachTargetAction*>(action))
+        if (action->HasCategory(ACTION_CATEGORY_AVOID_AOE | ACTION_CATEGORY_FLEE |
+                                ACTION_CATEGORY_COMBAT_FORMATION_MOVE) || dynamic_cast<CastDisengageAction*>(action) ||
+            dynamic_cast<ReachMeleeAction*>(action) || action->HasCategory(ACTION_CATEGORY_REACH_TARGET))
             return 0.0f;
     }
 
@@ -685,7 +673,7 @@ float IccBqlMultiplier::GetValue(Action* action)
     if ((boss->GetExactDist2d(ICC_BQL_TANK_POSITION.GetPositionX(), ICC_BQL_TANK_POSITION.GetPositionY()) > 10.0f) &&
         botAI->IsRanged(bot) && !((boss->GetPositionZ() - bot->GetPositionZ()) > 5.0f))
     {
-        if (dynamic_cast<FleeAction*>(action) || dynamic_cast<CombatFormationMoveAction*>(action))
+        if (action->HasCategory(ACTION_CATEGORY_FLEE | ACTION_CATEGORY_COMBAT_FORMATION_MOVE))
             return 0.0f;
     }
 
@@ -703,7 +691,7 @@ float IccValithriaDreamCloudMultiplier::GetValue(Action* action)
     if (!boss && !bot->HasAura(SPELL_DREAM_STATE))
         return 1.0f;
 
-    if (dynamic_cast<FollowAction*>(action) || dynamic_cast<CombatFormationMoveAction*>(action))
+    if (action->HasCategory(ACTION_CATEGORY_FOLLOW | ACTION_CATEGORY_COMBAT_FORMATION_MOVE))
         return 0.0f;
 
     // Zombie victim: only the kite action runs. Blocks combat/movement so bot
@@ -739,7 +727,7 @@ float IccValithriaDreamCloudMultiplier::GetValue(Action* action)
         // Non-tanks must strictly follow RTI marks. Block generic assist actions
         // so bots never attack unmarked adds; AttackRtiTargetAction drives them to
         // skull/cross targets set by HandleMarkingLogic.
-        if (dynamic_cast<TankAssistAction*>(action))
+        if (action->HasCategory(ACTION_CATEGORY_TANK_ASSIST))
             return 0.0f;
 
         // Melee bots must not engage Blistering Zombies (one-shot melee swing).
@@ -765,14 +753,14 @@ float IccValithriaDreamCloudMultiplier::GetValue(Action* action)
             if (victimIsZombie || rtiIsZombie)
             {
                 if (dynamic_cast<AttackRtiTargetAction*>(action) ||
-                    dynamic_cast<DpsAssistAction*>(action))
+                    action->HasCategory(ACTION_CATEGORY_DPS_ASSIST))
                     return 0.0f;
             }
         }
     }
 
     if (botAI->IsHeal(bot) && (twistedNightmares || emeraldVigor))
-        if (dynamic_cast<DpsAssistAction*>(action) || dynamic_cast<AttackRtiTargetAction*>(action))
+        if (action->HasCategory(ACTION_CATEGORY_DPS_ASSIST) || dynamic_cast<AttackRtiTargetAction*>(action))
             return 0.0f;
 
     if (bot->HasAura(SPELL_DREAM_STATE) && !bot->HealthBelowPct(50))
@@ -807,15 +795,15 @@ float IccSindragosaMultiplier::GetValue(Action* action)
 
     if (boss->HealthBelowPct(95))
     {
-        if (dynamic_cast<CombatFormationMoveAction*>(action) || dynamic_cast<FleeAction*>(action) ||
-            dynamic_cast<FollowAction*>(action) || dynamic_cast<CastStarfallAction*>(action))
+        if (action->HasCategory(ACTION_CATEGORY_COMBAT_FORMATION_MOVE | ACTION_CATEGORY_FLEE |
+                                ACTION_CATEGORY_FOLLOW) || dynamic_cast<CastStarfallAction*>(action))
             return 0.0f;
     }
 
     if (aura && (diff == RAID_DIFFICULTY_10MAN_HEROIC || diff == RAID_DIFFICULTY_25MAN_HEROIC) &&
         !dynamic_cast<IccSindragosaFrostBombAction*>(action))
     {
-        if (dynamic_cast<MovementAction*>(action) || dynamic_cast<IccSindragosaUnchainedMagicAction*>(action))
+        if (action->HasCategory(ACTION_CATEGORY_MOVEMENT) || dynamic_cast<IccSindragosaUnchainedMagicAction*>(action))
             return 1.0f;
         else
             return 0.0f;
@@ -838,7 +826,7 @@ float IccSindragosaMultiplier::GetValue(Action* action)
         bool const safe = bot->GetExactDist2d(boss) >= 33.0f;
         if (safe && (botAI->IsRanged(bot) || botAI->IsHeal(bot)))
         {
-            if (dynamic_cast<MovementAction*>(action))
+            if (action->HasCategory(ACTION_CATEGORY_MOVEMENT))
                 return 0.0f;
             return 1.0f;
         }
@@ -895,7 +883,7 @@ float IccSindragosaMultiplier::GetValue(Action* action)
         Aura* aura = botAI->GetAura("mystic buffet", bot, false, true);
         if (aura && aura->GetStackAmount() >= 6)
         {
-            if (dynamic_cast<MovementAction*>(action))
+            if (action->HasCategory(ACTION_CATEGORY_MOVEMENT))
                 return 1.0f;
             else
                 return 0.0f;
@@ -913,7 +901,7 @@ float IccSindragosaMultiplier::GetValue(Action* action)
         if (boss->HealthBelowPct(35))
         {
             if (dynamic_cast<IccSindragosaTankSwapPositionAction*>(action) || dynamic_cast<TankFaceAction*>(action) ||
-                dynamic_cast<AttackAction*>(action) || dynamic_cast<MovementAction*>(action))
+                action->HasCategory(ACTION_CATEGORY_ATTACK | ACTION_CATEGORY_MOVEMENT))
                 return 1.0f;
             else
                 return 0.0f;
@@ -925,12 +913,14 @@ float IccSindragosaMultiplier::GetValue(Action* action)
         if (dynamic_cast<IccSindragosaFrostBombAction*>(action))
             return 1.0f;
 
-        if (dynamic_cast<FollowAction*>(action) || dynamic_cast<IccSindragosaBlisteringColdAction*>(action) ||
+        if (action->HasCategory(ACTION_CATEGORY_FOLLOW) || dynamic_cast<IccSindragosaBlisteringColdAction*>(action) ||
             dynamic_cast<IccSindragosaChilledToTheBoneAction*>(action) || dynamic_cast<IccSindragosaMysticBuffetAction*>(action) ||
             dynamic_cast<IccSindragosaFrostBeaconAction*>(action) || dynamic_cast<IccSindragosaUnchainedMagicAction*>(action) ||
-            dynamic_cast<FleeAction*>(action) || dynamic_cast<CastDisengageAction*>(action) || dynamic_cast<PetAttackAction*>(action) ||
-            dynamic_cast<IccSindragosaGroupPositionAction*>(action) || dynamic_cast<TankAssistAction*>(action) ||
-            dynamic_cast<DpsAoeAction*>(action) || dynamic_cast<CastHurricaneAction*>(action) ||
+            action->HasCategory(ACTION_CATEGORY_FLEE) || dynamic_cast<CastDisengageAction*>(action) ||
+            dynamic_cast<PetAttackAction*>(action) ||
+            dynamic_cast<IccSindragosaGroupPositionAction*>(action) ||
+            action->HasCategory(ACTION_CATEGORY_TANK_ASSIST | ACTION_CATEGORY_DPS_AOE) ||
+            dynamic_cast<CastHurricaneAction*>(action) ||
             dynamic_cast<CastVolleyAction*>(action) || dynamic_cast<CastBlizzardAction*>(action) ||
             dynamic_cast<CastStarfallAction*>(action) || dynamic_cast<FanOfKnivesAction*>(action) ||
             dynamic_cast<CastWhirlwindAction*>(action) || dynamic_cast<CastMindSearAction*>(action) ||
@@ -954,7 +944,7 @@ float IccLichKingAddsMultiplier::GetValue(Action* action)
         // Warlocks and melee stay functional (movement + adds action only)
         if (botAI->IsMelee(bot) || bot->getClass() == CLASS_WARLOCK)
         {
-            if (dynamic_cast<MovementAction*>(action) || dynamic_cast<IccLichKingAddsAction*>(action))
+            if (action->HasCategory(ACTION_CATEGORY_MOVEMENT) || dynamic_cast<IccLichKingAddsAction*>(action))
                 return 1.0f;
             return 0.0f;
         }
@@ -962,15 +952,15 @@ float IccLichKingAddsMultiplier::GetValue(Action* action)
         // Main tank near another tank: suppress movement jitter
         Unit* mainTank = AI_VALUE(Unit*, "main tank");
         if (!botAI->IsMainTank(bot) && mainTank && bot->GetExactDist2d(mainTank) < 2.0f &&
-            dynamic_cast<MovementAction*>(action))
+            action->HasCategory(ACTION_CATEGORY_MOVEMENT))
             return 0.0f;
 
         // Suppress all these regardless of role
-        if (dynamic_cast<CombatFormationMoveAction*>(action) || dynamic_cast<FollowAction*>(action) ||
-            dynamic_cast<FleeAction*>(action) || dynamic_cast<CastBlinkBackAction*>(action) ||
+        if (action->HasCategory(ACTION_CATEGORY_COMBAT_FORMATION_MOVE | ACTION_CATEGORY_FOLLOW |
+                                ACTION_CATEGORY_FLEE) || dynamic_cast<CastBlinkBackAction*>(action) ||
             dynamic_cast<CastDisengageAction*>(action) || dynamic_cast<CastChargeAction*>(action) ||
             dynamic_cast<CastFeralChargeBearAction*>(action) || dynamic_cast<CastIceBlockAction*>(action) ||
-            dynamic_cast<CastRevivePetAction*>(action) || dynamic_cast<TankAssistAction*>(action) ||
+            dynamic_cast<CastRevivePetAction*>(action) || action->HasCategory(ACTION_CATEGORY_TANK_ASSIST) ||
             dynamic_cast<CastArmyOfTheDeadAction*>(action))
             return 0.0f;
 
@@ -1060,12 +1050,12 @@ float IccLichKingAddsMultiplier::GetValue(Action* action)
         return allDelivered ? 1.0f : 0.0f;
     }
 
-    if (dynamic_cast<CombatFormationMoveAction*>(action) || dynamic_cast<FollowAction*>(action) ||
+    if (action->HasCategory(ACTION_CATEGORY_COMBAT_FORMATION_MOVE | ACTION_CATEGORY_FOLLOW) ||
         dynamic_cast<CastBlinkBackAction*>(action) || dynamic_cast<CastDisengageAction*>(action))
         return 0.0f;
 
     // Hunters may flee (kite mechanics); everyone else stays put
-    if (dynamic_cast<FleeAction*>(action) && bot->getClass() != CLASS_HUNTER)
+    if (action->HasCategory(ACTION_CATEGORY_FLEE) && bot->getClass() != CLASS_HUNTER)
         return 0.0f;
 
     if (boss->HealthAbovePct(71))
@@ -1073,14 +1063,14 @@ float IccLichKingAddsMultiplier::GetValue(Action* action)
         // Assist tank targeting is fully managed by HandleAssistTankAddManagement —
         // suppress generic target-switching actions so they don't override it.
         if (botAI->IsAssistTank(bot) &&
-            (dynamic_cast<TankAssistAction*>(action) || dynamic_cast<AttackRtiTargetAction*>(action) ||
-             dynamic_cast<DpsAssistAction*>(action)))
+            (action->HasCategory(ACTION_CATEGORY_TANK_ASSIST) || dynamic_cast<AttackRtiTargetAction*>(action) ||
+             action->HasCategory(ACTION_CATEGORY_DPS_ASSIST)))
             return 0.0f;
 
         if (!botAI->IsTank(bot) && dynamic_cast<CastConsecrationAction*>(action))
             return 0.0f;
 
-        if (dynamic_cast<DpsAoeAction*>(action) || dynamic_cast<CastHurricaneAction*>(action) ||
+        if (action->HasCategory(ACTION_CATEGORY_DPS_AOE) || dynamic_cast<CastHurricaneAction*>(action) ||
             dynamic_cast<CastVolleyAction*>(action) || dynamic_cast<CastBlizzardAction*>(action) ||
             dynamic_cast<CastStarfallAction*>(action) || dynamic_cast<FanOfKnivesAction*>(action) ||
             dynamic_cast<CastWhirlwindAction*>(action) || dynamic_cast<CastMindSearAction*>(action) ||
@@ -1137,7 +1127,7 @@ float IccLichKingAddsMultiplier::GetValue(Action* action)
             return 0.0f;
 
         // Assist tank should not pick up adds independently during winter
-        if (botAI->IsAssistTank(bot) && dynamic_cast<TankAssistAction*>(action))
+        if (botAI->IsAssistTank(bot) && action->HasCategory(ACTION_CATEGORY_TANK_ASSIST))
             return 0.0f;
 
         // Suppress movement/attack toward the boss if we are far away
@@ -1145,8 +1135,9 @@ float IccLichKingAddsMultiplier::GetValue(Action* action)
         if (currentTarget && currentTarget == boss && bot->GetDistance2d(boss) > 50.0f)
         {
             if (dynamic_cast<ReachSpellAction*>(action) ||
-                dynamic_cast<ReachMeleeAction*>(action) || dynamic_cast<ReachTargetAction*>(action) ||
-                dynamic_cast<TankAssistAction*>(action) || dynamic_cast<DpsAssistAction*>(action))
+                dynamic_cast<ReachMeleeAction*>(action) ||
+                action->HasCategory(ACTION_CATEGORY_REACH_TARGET | ACTION_CATEGORY_TANK_ASSIST |
+                                    ACTION_CATEGORY_DPS_ASSIST))
                 return 0.0f;
         }
 
@@ -1158,7 +1149,7 @@ float IccLichKingAddsMultiplier::GetValue(Action* action)
              currentTarget->GetEntry() == NPC_ICE_SPHERE3 || currentTarget->GetEntry() == NPC_ICE_SPHERE4))
         {
             if (dynamic_cast<ReachMeleeAction*>(action) || dynamic_cast<ReachSpellAction*>(action) ||
-                dynamic_cast<ReachTargetAction*>(action) || dynamic_cast<TankAssistAction*>(action))
+                action->HasCategory(ACTION_CATEGORY_REACH_TARGET | ACTION_CATEGORY_TANK_ASSIST))
                 return 0.0f;
         }
     }
@@ -1177,8 +1168,8 @@ float IccLichKingAddsMultiplier::GetValue(Action* action)
             }
         }
 
-        if (defilePresent && (dynamic_cast<CombatFormationMoveAction*>(action) || dynamic_cast<FollowAction*>(action) ||
-                              dynamic_cast<FleeAction*>(action) || dynamic_cast<MoveRandomAction*>(action) ||
+        if (defilePresent && (action->HasCategory(ACTION_CATEGORY_COMBAT_FORMATION_MOVE | ACTION_CATEGORY_FOLLOW |
+                                                  ACTION_CATEGORY_FLEE) || dynamic_cast<MoveRandomAction*>(action) ||
                               dynamic_cast<MoveFromGroupAction*>(action)))
             return 0.0f;
     }
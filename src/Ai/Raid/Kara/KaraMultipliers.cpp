@@ -34,7 +34,7 @@ float AttumenTheHuntsmanDisableTankAssistMultiplier::GetValue(Action* action)
     if (!attumen)
         return 1.0f;
 
-    if (bot->GetVictim() != nullptr && dynamic_cast<TankAssistAction*>(action))
+    if (bot->GetVictim() != nullptr && action->HasCategory(ACTION_CATEGORY_TANK_ASSIST))
         return 0.0f;
 
     return 1.0f;
@@ -49,11 +49,10 @@ float AttumenTheHuntsmanStayStackedMultiplier::GetValue(Action* action)
 
     if (!botAI->IsMainTank(bot) && attumenMounted->GetVictim() != bot)
     {
-        if (dynamic_cast<CombatFormationMoveAction*>(action) ||
-            dynamic_cast<FleeAction*>(action) ||
+        if (action->HasCategory(ACTION_CATEGORY_COMBAT_FORMATION_MOVE | ACTION_CATEGORY_FLEE) ||
             dynamic_cast<CastBlinkBackAction*>(action) ||
             dynamic_cast<CastDisengageAction*>(action) ||
-            dynamic_cast<CastReachTargetSpellAction*>(action))
+            action->HasCategory(ACTION_CATEGORY_REACH_SPELL))
             return 0.0f;
     }
 
@@ -77,8 +76,8 @@ float AttumenTheHuntsmanWaitForDpsMultiplier::GetValue(Action* action)
     {
         if (!botAI->IsMainTank(bot))
         {
-            if (dynamic_cast<AttackAction*>(action) || (dynamic_cast<CastSpellAction*>(action) &&
-                !dynamic_cast<CastHealingSpellAction*>(action)))
+            if (action->HasCategory(ACTION_CATEGORY_ATTACK) || (action->HasCategory(ACTION_CATEGORY_SPELL) &&
+                !action->HasCategory(ACTION_CATEGORY_HEAL)))
                 return 0.0f;
         }
     }
@@ -92,7 +91,7 @@ float MaidenOfVirtueDisableCombatFormationMoveMultiplier::GetValue(Action* actio
     if (!AI_VALUE2(Unit*, "find target", "maiden of virtue"))
         return 1.0f;
 
-    if (dynamic_cast<CombatFormationMoveAction*>(action) &&
+    if (action->HasCategory(ACTION_CATEGORY_COMBAT_FORMATION_MOVE) &&
         !dynamic_cast<SetBehindTargetAction*>(action))
         return 0.0f;
 
@@ -106,7 +105,7 @@ float TheCuratorDisableTankAssistMultiplier::GetValue(Action* action)
     if (!curator)
         return 1.0f;
 
-    if (bot->GetVictim() != nullptr && dynamic_cast<TankAssistAction*>(action))
+    if (bot->GetVictim() != nullptr && action->HasCategory(ACTION_CATEGORY_TANK_ASSIST))
         return 0.0f;
 
     return 1.0f;
@@ -118,7 +117,7 @@ float TheCuratorDisableCombatFormationMoveMultiplier::GetValue(Action* action)
     if (!AI_VALUE2(Unit*, "find target", "the curator"))
         return 1.0f;
 
-    if (dynamic_cast<CombatFormationMoveAction*>(action) &&
+    if (action->HasCategory(ACTION_CATEGORY_COMBAT_FORMATION_MOVE) &&
         !dynamic_cast<SetBehindTargetAction*>(action))
         return 0.0f;
 
@@ -152,16 +151,13 @@ float ShadeOfAranArcaneExplosionDisableChargeMultiplier::GetValue(Action* action
     if (aran->HasUnitState(UNIT_STATE_CASTING) &&
         aran->FindCurrentSpellBySpellId(SPELL_ARCANE_EXPLOSION))
     {
-        if (dynamic_cast<CastReachTargetSpellAction*>(action))
+        if (action->HasCategory(ACTION_CATEGORY_REACH_SPELL))
             return 0.0f;
 
         if (bot->GetDistance2d(aran) >= 20.0f)
         {
-            if (dynamic_cast<CombatFormationMoveAction*>(action) ||
-                dynamic_cast<FleeAction*>(action) ||
-                dynamic_cast<FollowAction*>(action) ||
-                dynamic_cast<ReachTargetAction*>(action) ||
-                dynamic_cast<AvoidAoeAction*>(action))
+            if (action->HasCategory(ACTION_CATEGORY_COMBAT_FORMATION_MOVE | ACTION_CATEGORY_FLEE |
+                                    ACTION_CATEGORY_FOLLOW | ACTION_CATEGORY_REACH_TARGET | ACTION_CATEGORY_AVOID_AOE))
                 return 0.0f;
         }
     }
@@ -178,15 +174,12 @@ float ShadeOfAranFlameWreathDisableMovementMultiplier::GetValue(Action* action)
 
     if (IsFlameWreathActive(botAI, bot))
     {
-        if (dynamic_cast<CombatFormationMoveAction*>(action) ||
-            dynamic_cast<FleeAction*>(action) ||
-            dynamic_cast<FollowAction*>(action) ||
-            dynamic_cast<ReachTargetAction*>(action) ||
-            dynamic_cast<AvoidAoeAction*>(action) ||
+        if (action->HasCategory(ACTION_CATEGORY_COMBAT_FORMATION_MOVE | ACTION_CATEGORY_FLEE |
+                                ACTION_CATEGORY_FOLLOW | ACTION_CATEGORY_REACH_TARGET | ACTION_CATEGORY_AVOID_AOE) ||
             dynamic_cast<CastKillingSpreeAction*>(action) ||
             dynamic_cast<CastBlinkBackAction*>(action) ||
             dynamic_cast<CastDisengageAction*>(action) ||
-            dynamic_cast<CastReachTargetSpellAction*>(action))
+            action->HasCategory(ACTION_CATEGORY_REACH_SPELL))
             return 0.0f;
     }
 
@@ -204,24 +197,22 @@ float NetherspiteKeepBlockingBeamMultiplier::GetValue(Action* action)
 
     if (bot == redBlocker)
     {
-        if (dynamic_cast<CombatFormationMoveAction*>(action))
+        if (action->HasCategory(ACTION_CATEGORY_COMBAT_FORMATION_MOVE))
             return 0.0f;
     }
 
     if (bot == blueBlocker)
     {
-        if (dynamic_cast<CombatFormationMoveAction*>(action) ||
-            dynamic_cast<ReachTargetAction*>(action))
+        if (action->HasCategory(ACTION_CATEGORY_COMBAT_FORMATION_MOVE | ACTION_CATEGORY_REACH_TARGET))
             return 0.0f;
     }
 
     if (bot == greenBlocker)
     {
-        if (dynamic_cast<CombatFormationMoveAction*>(action) ||
-            dynamic_cast<ReachTargetAction*>(action) ||
-            dynamic_cast<FleeAction*>(action) ||
+        if (action->HasCategory(ACTION_CATEGORY_COMBAT_FORMATION_MOVE | ACTION_CATEGORY_REACH_TARGET |
+                                ACTION_CATEGORY_FLEE) ||
             dynamic_cast<CastKillingSpreeAction*>(action) ||
-            dynamic_cast<CastReachTargetSpellAction*>(action))
+            action->HasCategory(ACTION_CATEGORY_REACH_SPELL))
             return 0.0f;
     }
 
@@ -244,8 +235,8 @@ float NetherspiteWaitForDpsMultiplier::GetValue(Action* action)
     {
         if (!botAI->IsTank(bot))
         {
-            if (dynamic_cast<AttackAction*>(action) || (dynamic_cast<CastSpellAction*>(action) &&
-                !dynamic_cast<CastHealingSpellAction*>(action)))
+            if (action->HasCategory(ACTION_CATEGORY_ATTACK) || (action->HasCategory(ACTION_CATEGORY_SPELL) &&
+                !action->HasCategory(ACTION_CATEGORY_HEAL)))
             return 0.0f;
         }
     }
@@ -260,7 +251,7 @@ float PrinceMalchezaarDisableAvoidAoeMultiplier::GetValue(Action* action)
     if (!malchezaar)
         return 1.0f;
 
-    if (dynamic_cast<AvoidAoeAction*>(action))
+    if (action->HasCategory(ACTION_CATEGORY_AVOID_AOE))
         return 0.0f;
 
     return 1.0f;
@@ -275,10 +266,10 @@ float PrinceMalchezaarEnfeebleKeepDistanceMultiplier::GetValue(Action* action)
 
     if (bot->HasAura(SPELL_ENFEEBLE))
     {
-        if (dynamic_cast<CastReachTargetSpellAction*>(action))
+        if (action->HasCategory(ACTION_CATEGORY_REACH_SPELL))
             return 0.0f;
 
-        if (dynamic_cast<MovementAction*>(action) &&
+        if (action->HasCategory(ACTION_CATEGORY_MOVEMENT) &&
             !dynamic_cast<PrinceMalchezaarEnfeebledAvoidHazardAction*>(action))
             return 0.0f;
     }
@@ -346,8 +337,8 @@ float NightbaneWaitForDpsMultiplier::GetValue(Action* action)
     {
         if (!botAI->IsMainTank(bot))
         {
-            if (dynamic_cast<AttackAction*>(action) || (dynamic_cast<CastSpellAction*>(action) &&
-                !dynamic_cast<CastHealingSpellAction*>(action)))
+            if (action->HasCategory(ACTION_CATEGORY_ATTACK) || (action->HasCategory(ACTION_CATEGORY_SPELL) &&
+                !action->HasCategory(ACTION_CATEGORY_HEAL)))
                 return 0.0f;
         }
     }
@@ -366,7 +357,7 @@ float NightbaneDisableAvoidAoeMultiplier::GetValue(Action* action)
 
     if (nightbane->GetPositionZ() > NIGHTBANE_FLIGHT_Z || botAI->IsMainTank(bot))
     {
-        if (dynamic_cast<AvoidAoeAction*>(action))
+        if (action->HasCategory(ACTION_CATEGORY_AVOID_AOE))
             return 0.0f;
     }
 
@@ -382,8 +373,8 @@ float NightbaneDisableMovementMultiplier::GetValue(Action* action)
 
     if (dynamic_cast<CastBlinkBackAction*>(action) ||
         dynamic_cast<CastDisengageAction*>(action) ||
-        dynamic_cast<FleeAction*>(action) ||
-        (dynamic_cast<CombatFormationMoveAction*>(action) &&
+        action->HasCategory(ACTION_CATEGORY_FLEE) ||
+        (action->HasCategory(ACTION_CATEGORY_COMBAT_FORMATION_MOVE) &&
          !dynamic_cast<SetBehindTargetAction*>(action)))
     {
         return 0.0f;
@@ -13,7 +13,8 @@ class AttumenTheHuntsmanDisableTankAssistMultiplier : public Multiplier
 {
 public:
     AttumenTheHuntsmanDisableTankAssistMultiplier(
-        PlayerbotAI* botAI) : Multiplier(botAI, "attumen the huntsman disable tank assist multiplier") {}
+        PlayerbotAI* botAI) : Multiplier(botAI, "attumen the huntsman disable tank assist multiplier",
+            ACTION_CATEGORY_TANK_ASSIST) {}
     virtual float GetValue(Action* action);
 };
 
@@ -29,7 +30,8 @@ class AttumenTheHuntsmanWaitForDpsMultiplier : public Multiplier
 {
 public:
     AttumenTheHuntsmanWaitForDpsMultiplier(
-        PlayerbotAI* botAI) : Multiplier(botAI, "attumen the huntsman wait for dps multiplier") {}
+        PlayerbotAI* botAI) : Multiplier(botAI, "attumen the huntsman wait for dps multiplier",
+            ACTION_CATEGORY_ATTACK | ACTION_CATEGORY_SPELL) {}
     virtual float GetValue(Action* action);
 };
 
@@ -45,7 +47,8 @@ class TheCuratorDisableTankAssistMultiplier : public Multiplier
 {
 public:
     TheCuratorDisableTankAssistMultiplier(
-        PlayerbotAI* botAI) : Multiplier(botAI, "the curator disable tank assist multiplier") {}
+        PlayerbotAI* botAI) : Multiplier(botAI, "the curator disable tank assist multiplier",
+            ACTION_CATEGORY_TANK_ASSIST) {}
     virtual float GetValue(Action* action);
 };
 
@@ -69,7 +72,8 @@ class ShadeOfAranArcaneExplosionDisableChargeMultiplier : public Multiplier
 {
 public:
     ShadeOfAranArcaneExplosionDisableChargeMultiplier(
-        PlayerbotAI* botAI) : Multiplier(botAI, "shade of aran arcane explosion disable charge multiplier") {}
+        PlayerbotAI* botAI) : Multiplier(botAI, "shade of aran arcane explosion disable charge multiplier",
+            ACTION_CATEGORY_REACH_SPELL | ACTION_CATEGORY_MOVEMENT) {}
     virtual float GetValue(Action* action);
 };
 
@@ -93,7 +97,8 @@ class NetherspiteWaitForDpsMultiplier : public Multiplier
 {
 public:
     NetherspiteWaitForDpsMultiplier(
-        PlayerbotAI* botAI) : Multiplier(botAI, "netherspite wait for dps multiplier") {}
+        PlayerbotAI* botAI) : Multiplier(botAI, "netherspite wait for dps multiplier",
+            ACTION_CATEGORY_ATTACK | ACTION_CATEGORY_SPELL) {}
     virtual float GetValue(Action* action);
 };
 
@@ -101,7 +106,8 @@ class PrinceMalchezaarDisableAvoidAoeMultiplier : public Multiplier
 {
 public:
     PrinceMalchezaarDisableAvoidAoeMultiplier(
-        PlayerbotAI* botAI) : Multiplier(botAI, "prince malchezaar disable avoid aoe multiplier") {}
+        PlayerbotAI* botAI) : Multiplier(botAI, "prince malchezaar disable avoid aoe multiplier",
+            ACTION_CATEGORY_AVOID_AOE) {}
     virtual float GetValue(Action* action);
 };
 
@@ -133,7 +139,8 @@ class NightbaneWaitForDpsMultiplier : public Multiplier
 {
 public:
     NightbaneWaitForDpsMultiplier(
-        PlayerbotAI* botAI) : Multiplier(botAI, "nightbane wait for dps multiplier") {}
+        PlayerbotAI* botAI) : Multiplier(botAI, "nightbane wait for dps multiplier",
+            ACTION_CATEGORY_ATTACK | ACTION_CATEGORY_SPELL) {}
     virtual float GetValue(Action* action);
 };
 
@@ -141,7 +148,7 @@ class NightbaneDisableAvoidAoeMultiplier : public Multiplier
 {
 public:
     NightbaneDisableAvoidAoeMultiplier(
-        PlayerbotAI* botAI) : Multiplier(botAI, "nightbane disable avoid aoe multiplier") {}
+        PlayerbotAI* botAI) : Multiplier(botAI, "nightbane disable avoid aoe multiplier", ACTION_CATEGORY_AVOID_AOE) {}
     virtual float GetValue(Action* action);
 };
 
@@ -18,7 +18,7 @@ static bool IsDpsBotWithAoeAction(Player* bot, Action* action)
 {
     if (PlayerbotAI::IsDps(bot))
     {
-        if (dynamic_cast<DpsAoeAction*>(action) || dynamic_cast<CastConsecrationAction*>(action) ||
+        if (action->HasCategory(ACTION_CATEGORY_DPS_AOE) || dynamic_cast<CastConsecrationAction*>(action) ||
             dynamic_cast<CastStarfallAction*>(action) || dynamic_cast<CastWhirlwindAction*>(action) ||
             dynamic_cast<CastMagmaTotemAction*>(action) || dynamic_cast<CastExplosiveTrapAction*>(action) ||
             dynamic_cast<CastDeathAndDecayAction*>(action))
@@ -45,12 +45,12 @@ float GarrDisableDpsAoeMultiplier::GetValue(Action* action)
 
 static bool IsAllowedGeddonMovementAction(Action* action)
 {
-    if (dynamic_cast<MovementAction*>(action) &&
+    if (action->HasCategory(ACTION_CATEGORY_MOVEMENT) &&
                 !dynamic_cast<McMoveFromGroupAction*>(action) &&
                 !dynamic_cast<McMoveFromBaronGeddonAction*>(action))
         return false;
 
-    if (dynamic_cast<CastReachTargetSpellAction*>(action))
+    if (action->HasCategory(ACTION_CATEGORY_REACH_SPELL))
         return false;
 
     return true;
@@ -107,7 +107,7 @@ float GolemaggMultiplier::GetValue(Action* action)
         if (PlayerbotAI::IsAssistTank(bot))
         {
             // The first two assist tanks manage the Core Ragers. The remaining assist tanks attack the boss.
-            if (dynamic_cast<TankAssistAction*>(action))
+            if (action->HasCategory(ACTION_CATEGORY_TANK_ASSIST))
                 return 0.0f;
         }
         if (IsDpsBotWithAoeAction(bot, action))
@@ -43,11 +43,9 @@ float MagtheridonUseManticronCubeMultiplier::GetValue(Action* action)
         return 1.0f;
     }
 
-    if (dynamic_cast<FleeAction*>(action) ||
-        dynamic_cast<FollowAction*>(action) ||
-        dynamic_cast<ReachTargetAction*>(action) ||
+    if (action->HasCategory(ACTION_CATEGORY_FLEE | ACTION_CATEGORY_FOLLOW | ACTION_CATEGORY_REACH_TARGET) ||
         dynamic_cast<CastBlinkBackAction*>(action) ||
-        dynamic_cast<CastReachTargetSpellAction*>(action) ||
+        action->HasCategory(ACTION_CATEGORY_REACH_SPELL) ||
         dynamic_cast<CastDisengageAction*>(action))
     {
         return 0.0f;
@@ -71,8 +69,7 @@ float MagtheridonWaitToAttackMultiplier::GetValue(Action* action)
     if (it != dpsWaitTimer.end() && time(nullptr) - it->second > dpsWaitSeconds)
         return 1.0f;
 
-    if (dynamic_cast<AttackAction*>(action) ||
-        dynamic_cast<CastSpellAction*>(action))
+    if (action->HasCategory(ACTION_CATEGORY_ATTACK | ACTION_CATEGORY_SPELL))
     {
         return 0.0f;
     }
@@ -89,8 +86,7 @@ float MagtheridonControlTankActionsMultiplier::GetValue(Action* action)
     if (!magtheridon)
         return 1.0f;
 
-    if (dynamic_cast<CombatFormationMoveAction*>(action) ||
-        dynamic_cast<TankAssistAction*>(action))
+    if (action->HasCategory(ACTION_CATEGORY_COMBAT_FORMATION_MOVE | ACTION_CATEGORY_TANK_ASSIST))
     {
         return 0.0f;
     }
@@ -98,7 +94,7 @@ float MagtheridonControlTankActionsMultiplier::GetValue(Action* action)
     if (!botAI->IsMainTank(bot) && magtheridon->GetVictim() != bot)
         return 1.0f;
 
-    if (dynamic_cast<AvoidAoeAction*>(action))
+    if (action->HasCategory(ACTION_CATEGORY_AVOID_AOE))
         return 0.0f;
 
     if (IsMagtheridonActive(magtheridon) || GetChanneler(bot, SOUTH_CHANNELER) ||
@@ -107,11 +103,7 @@ float MagtheridonControlTankActionsMultiplier::GetValue(Action* action)
         return 1.0f;
     }
 
-    if (dynamic_cast<CastReachTargetSpellAction*>(action) ||
-        dynamic_cast<CastTauntAction*>(action) ||
-        dynamic_cast<CastGrowlAction*>(action) ||
-        dynamic_cast<CastHandOfReckoningAction*>(action) ||
-        dynamic_cast<CastDarkCommandAction*>(action))
+    if (action->HasCategory(ACTION_CATEGORY_REACH_SPELL | ACTION_CATEGORY_TAUNT))
     {
         return 0.0f;
     }
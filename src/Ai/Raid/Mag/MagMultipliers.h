@@ -21,7 +21,8 @@ class MagtheridonWaitToAttackMultiplier : public Multiplier
 {
 public:
     MagtheridonWaitToAttackMultiplier(
-        PlayerbotAI* botAI) : Multiplier(botAI, "magtheridon wait to attack multiplier") {}
+        PlayerbotAI* botAI) : Multiplier(botAI, "magtheridon wait to attack multiplier",
+            ACTION_CATEGORY_ATTACK | ACTION_CATEGORY_SPELL) {}
     float GetValue(Action* action) override;
 };
 
@@ -29,7 +30,8 @@ class MagtheridonControlTankActionsMultiplier : public Multiplier
 {
 public:
     MagtheridonControlTankActionsMultiplier(
-        PlayerbotAI* botAI) : Multiplier(botAI, "magtheridon control tank actions multiplier") {}
+        PlayerbotAI* botAI) : Multiplier(botAI, "magtheridon control tank actions multiplier",
+            ACTION_CATEGORY_MOVEMENT | ACTION_CATEGORY_REACH_SPELL | ACTION_CATEGORY_TAUNT) {}
     float GetValue(Action* action) override;
 };
 
@@ -28,10 +28,10 @@ float GrobbulusMultiplier::GetValue(Action* action)
     if (!boss)
         return 1.0f;
 
-    if (dynamic_cast<AvoidAoeAction*>(action))
+    if (action->HasCategory(ACTION_CATEGORY_AVOID_AOE))
         return botAI->IsMainTank(bot) ? 0.0f : 1.0f;
 
-    if (dynamic_cast<CombatFormationMoveAction*>(action))
+    if (action->HasCategory(ACTION_CATEGORY_COMBAT_FORMATION_MOVE))
         return 0.0f;
 
     return 1.0f;
@@ -68,7 +68,7 @@ float GrobbulusMultiplier::GetValue(Action* action)
 //            }
 //        }
 //    }
-//    if (dynamic_cast<CombatFormationMoveAction*>(action) ||
+//    if (action->HasCategory(ACTION_CATEGORY_COMBAT_FORMATION_MOVE) ||
 //        dynamic_cast<CastDisengageAction*>(action) ||
 //        dynamic_cast<CastBlinkBackAction*>(action) )
 //    {
@@ -82,7 +82,7 @@ float GrobbulusMultiplier::GetValue(Action* action)
 //    {
 //        return 1.0f;
 //    }
-//    if (dynamic_cast<CastSpellAction*>(action) && !dynamic_cast<CastMeleeSpellAction*>(action))
+//    if (action->HasCategory(ACTION_CATEGORY_SPELL) && !dynamic_cast<CastMeleeSpellAction*>(action))
 //    {
 //        CastSpellAction* spellAction = dynamic_cast<CastSpellAction*>(action);
 //        uint32 spellId = AI_VALUE2(uint32, "spell id", spellAction->getSpell());
@@ -108,13 +108,13 @@ float LoathebGenericMultiplier::GetValue(Action* action)
 
     context->GetValue<bool>("neglect threat")->Set(true);
     if (botAI->GetState() == BOT_STATE_COMBAT &&
-        (dynamic_cast<DpsAssistAction*>(action) || dynamic_cast<TankAssistAction*>(action) ||
-         dynamic_cast<CastDebuffSpellOnAttackerAction*>(action) || dynamic_cast<FleeAction*>(action) ||
-         dynamic_cast<CombatFormationMoveAction*>(action)))
+        (action->HasCategory(ACTION_CATEGORY_DPS_ASSIST | ACTION_CATEGORY_TANK_ASSIST) ||
+         dynamic_cast<CastDebuffSpellOnAttackerAction*>(action) ||
+         action->HasCategory(ACTION_CATEGORY_FLEE | ACTION_CATEGORY_COMBAT_FORMATION_MOVE)))
     {
         return 0.0f;
     }
-    if (!dynamic_cast<CastHealingSpellAction*>(action))
+    if (!action->HasCategory(ACTION_CATEGORY_HEAL))
         return 1.0f;
 
     Aura* aura = NaxxSpellIds::GetAnyAura(bot, {NaxxSpellIds::NecroticAura10});
@@ -134,11 +134,11 @@ float ThaddiusGenericMultiplier::GetValue(Action* action)
     if (!helper.UpdateBossAI())
         return 1.0f;
 
-    if (dynamic_cast<CombatFormationMoveAction*>(action))
+    if (action->HasCategory(ACTION_CATEGORY_COMBAT_FORMATION_MOVE))
         return 0.0f;
     // pet phase
     if (helper.IsPhasePet() &&
-        (dynamic_cast<DpsAssistAction*>(action) || dynamic_cast<TankAssistAction*>(action) ||
+        (action->HasCategory(ACTION_CATEGORY_DPS_ASSIST | ACTION_CATEGORY_TANK_ASSIST) ||
          dynamic_cast<CastDebuffSpellOnAttackerAction*>(action) ||
          dynamic_cast<ReachPartyMemberToHealAction*>(action) || dynamic_cast<BuffOnMainTankAction*>(action)))
     {
@@ -151,22 +151,22 @@ float ThaddiusGenericMultiplier::GetValue(Action* action)
     if (helper.IsPhasePet() && target && feugen && stalagg && target->GetHealthPct() <= 40 &&
         (feugen->GetHealthPct() >= target->GetHealthPct() + 3 || stalagg->GetHealthPct() >= target->GetHealthPct() + 3))
     {
-        if (dynamic_cast<CastSpellAction*>(action) && !dynamic_cast<CastHealingSpellAction*>(action))
+        if (action->HasCategory(ACTION_CATEGORY_SPELL) && !action->HasCategory(ACTION_CATEGORY_HEAL))
             return 0.0f;
     }
     // magnetic pull
     // uint32 curr_timer = eventMap->GetTimer();
-    // // if (curr_phase == 2 && bot->GetPositionZ() > 312.5f && dynamic_cast<MovementAction*>(action))
+    // // if (curr_phase == 2 && bot->GetPositionZ() > 312.5f && action->HasCategory(ACTION_CATEGORY_MOVEMENT))
     // {
     // if (curr_phase == 2 && (curr_timer % 20000 >= 18000 || curr_timer % 20000 <= 2000) &&
-    // dynamic_cast<MovementAction*>(action))
+    // action->HasCategory(ACTION_CATEGORY_MOVEMENT))
     // {
     //     // MotionMaster *mm = bot->GetMotionMaster();
     //     // mm->Clear();
     //     return 0.0f;
     // }
     // thaddius phase
-    // if (curr_phase == 8 && dynamic_cast<FleeAction*>(action))
+    // if (curr_phase == 8 && action->HasCategory(ACTION_CATEGORY_FLEE))
     // {
     //         return 0.0f;
     // }
@@ -178,7 +178,7 @@ float SapphironGenericMultiplier::GetValue(Action* action)
     if (!helper.UpdateBossAI())
         return 1.0f;
 
-    if (dynamic_cast<CastDeathGripAction*>(action) || dynamic_cast<CombatFormationMoveAction*>(action))
+    if (dynamic_cast<CastDeathGripAction*>(action) || action->HasCategory(ACTION_CATEGORY_COMBAT_FORMATION_MOVE))
         return 0.0f;
 
     return 1.0f;
@@ -191,9 +191,7 @@ float InstructorRazuviousGenericMultiplier::GetValue(Action* action)
 
     context->GetValue<bool>("neglect threat")->Set(true);
     if (botAI->GetState() == BOT_STATE_COMBAT &&
-        (dynamic_cast<DpsAssistAction*>(action) || dynamic_cast<TankAssistAction*>(action) ||
-         dynamic_cast<CastTauntAction*>(action) || dynamic_cast<CastDarkCommandAction*>(action) ||
-         dynamic_cast<CastHandOfReckoningAction*>(action) || dynamic_cast<CastGrowlAction*>(action)))
+        (action->HasCategory(ACTION_CATEGORY_DPS_ASSIST | ACTION_CATEGORY_TANK_ASSIST | ACTION_CATEGORY_TAUNT)))
     {
         return 0.0f;
     }
@@ -205,8 +203,8 @@ float KelthuzadGenericMultiplier::GetValue(Action* action)
     if (!helper.UpdateBossAI())
         return 1.0f;
 
-    if ((dynamic_cast<DpsAssistAction*>(action) || dynamic_cast<TankAssistAction*>(action) ||
-         dynamic_cast<CastDebuffSpellOnAttackerAction*>(action) || dynamic_cast<FleeAction*>(action)))
+    if ((action->HasCategory(ACTION_CATEGORY_DPS_ASSIST | ACTION_CATEGORY_TANK_ASSIST) ||
+         dynamic_cast<CastDebuffSpellOnAttackerAction*>(action) || action->HasCategory(ACTION_CATEGORY_FLEE)))
     {
         return 0.0f;
     }
@@ -239,7 +237,7 @@ float AnubrekhanGenericMultiplier::GetValue(Action* action)
             boss, {NaxxSpellIds::LocustSwarm10, NaxxSpellIds::LocustSwarm10Alt, NaxxSpellIds::LocustSwarm25}) ||
         botAI->HasAura("locust swarm", boss))
     {
-        if (dynamic_cast<FleeAction*>(action))
+        if (action->HasCategory(ACTION_CATEGORY_FLEE))
             return 0.0f;
     }
     return 1.0f;
@@ -252,7 +250,7 @@ float FourHorsemenGenericMultiplier::GetValue(Action* action)
         return 1.0f;
 
     context->GetValue<bool>("neglect threat")->Set(true);
-    if ((dynamic_cast<DpsAssistAction*>(action) || dynamic_cast<TankAssistAction*>(action)))
+    if ((action->HasCategory(ACTION_CATEGORY_DPS_ASSIST | ACTION_CATEGORY_TANK_ASSIST)))
         return 0.0f;
 
     return 1.0f;
@@ -268,11 +266,11 @@ float FourHorsemenGenericMultiplier::GetValue(Action* action)
 //     BossAI* boss_ai = dynamic_cast<BossAI*>(boss->GetAI());
 //     EventMap* eventMap = boss_botAI->GetEvents();
 //     uint32 curr_phase = eventMap->GetPhaseMask();
-//     if (curr_phase == 1 && (dynamic_cast<FollowAction*>(action)))
+//     if (curr_phase == 1 && (action->HasCategory(ACTION_CATEGORY_FOLLOW)))
 //     {
 //         return 0.0f;
 //     }
-//     if (curr_phase == 1 && (dynamic_cast<AttackAction*>(action)))
+//     if (curr_phase == 1 && (action->HasCategory(ACTION_CATEGORY_ATTACK)))
 //     {
 //         Unit* target = action->GetTarget();
 //         if (target == boss)
@@ -288,8 +286,8 @@ float GluthGenericMultiplier::GetValue(Action* action)
     if (!helper.UpdateBossAI())
         return 1.0f;
 
-    if ((dynamic_cast<DpsAssistAction*>(action) || dynamic_cast<TankAssistAction*>(action) ||
-         dynamic_cast<FleeAction*>(action) || dynamic_cast<CastDebuffSpellOnAttackerAction*>(action) ||
+    if ((action->HasCategory(ACTION_CATEGORY_DPS_ASSIST | ACTION_CATEGORY_TANK_ASSIST | ACTION_CATEGORY_FLEE) ||
+        dynamic_cast<CastDebuffSpellOnAttackerAction*>(action) ||
          dynamic_cast<CastStarfallAction*>(action)))
     {
         return 0.0f;
@@ -305,8 +303,7 @@ float GluthGenericMultiplier::GetValue(Action* action)
         }
         if (aura && aura->GetStackAmount() >= 5)
         {
-            if (dynamic_cast<CastTauntAction*>(action) || dynamic_cast<CastDarkCommandAction*>(action) ||
-                dynamic_cast<CastHandOfReckoningAction*>(action) || dynamic_cast<CastGrowlAction*>(action))
+            if (action->HasCategory(ACTION_CATEGORY_TAUNT))
             {
                 return 0.0f;
             }
@@ -8,7 +8,10 @@
 class GrobbulusMultiplier : public Multiplier
 {
 public:
-    GrobbulusMultiplier(PlayerbotAI* ai) : Multiplier(ai, "grobbulus") {}
+    GrobbulusMultiplier(PlayerbotAI* ai)
+        : Multiplier(ai, "grobbulus", ACTION_CATEGORY_AVOID_AOE | ACTION_CATEGORY_COMBAT_FORMATION_MOVE)
+    {
+    }
 
 public:
     virtual float GetValue(Action* action);
@@ -78,7 +81,7 @@ private:
 class AnubrekhanGenericMultiplier : public Multiplier
 {
 public:
-    AnubrekhanGenericMultiplier(PlayerbotAI* ai) : Multiplier(ai, "anubrekhan generic") {}
+    AnubrekhanGenericMultiplier(PlayerbotAI* ai) : Multiplier(ai, "anubrekhan generic", ACTION_CATEGORY_FLEE) {}
 
 public:
     virtual float GetValue(Action* action);
@@ -27,21 +27,19 @@ float SartharionMultiplier::GetValue(Action* action)
         // return 0.0f;
     }
 
-    if (botAI->IsDps(bot) && dynamic_cast<DpsAssistAction*>(action))
+    if (botAI->IsDps(bot) && action->HasCategory(ACTION_CATEGORY_DPS_ASSIST))
     {
         return 0.0f;
     }
 
     if (botAI->IsMainTank(bot) && target && target != boss &&
-        (dynamic_cast<TankAssistAction*>(action) || dynamic_cast<CastTauntAction*>(action) || dynamic_cast<CastDarkCommandAction*>(action) ||
-         dynamic_cast<CastHandOfReckoningAction*>(action) || dynamic_cast<CastGrowlAction*>(action)))
+        (action->HasCategory(ACTION_CATEGORY_TANK_ASSIST | ACTION_CATEGORY_TAUNT)))
     {
         return 0.0f;
     }
 
     if (botAI->IsAssistTank(bot) && target && target == boss &&
-        (dynamic_cast<CastTauntAction*>(action) || dynamic_cast<CastDarkCommandAction*>(action) ||
-         dynamic_cast<CastHandOfReckoningAction*>(action) || dynamic_cast<CastGrowlAction*>(action)))
+        (action->HasCategory(ACTION_CATEGORY_TAUNT)))
     {
         return 0.0f;
     }
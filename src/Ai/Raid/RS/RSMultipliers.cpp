@@ -37,7 +37,7 @@ namespace
 {
     bool RsIsAoeDamageAction(Action* action)
     {
-        return dynamic_cast<DpsAoeAction*>(action) || dynamic_cast<CastHurricaneAction*>(action) ||
+        return action->HasCategory(ACTION_CATEGORY_DPS_AOE) || dynamic_cast<CastHurricaneAction*>(action) ||
                dynamic_cast<CastVolleyAction*>(action) || dynamic_cast<CastBlizzardAction*>(action) ||
                dynamic_cast<CastStarfallAction*>(action) || dynamic_cast<FanOfKnivesAction*>(action) ||
                dynamic_cast<CastWhirlwindAction*>(action) || dynamic_cast<CastMindSearAction*>(action) ||
@@ -50,7 +50,7 @@ float RsSavianaBeaconMultiplier::GetValue(Action* action)
     if (!bot->HasAura(SPELL_FLAME_BEACON))
         return 1.0f;
 
-    if (dynamic_cast<MovementAction*>(action) && !dynamic_cast<RsSavianaConflagrationAction*>(action))
+    if (action->HasCategory(ACTION_CATEGORY_MOVEMENT) && !dynamic_cast<RsSavianaConflagrationAction*>(action))
         return 0.0f;
 
     return 1.0f;
@@ -76,7 +76,7 @@ float RsBaltharusBrandSafeMultiplier::GetValue(Action* action)
             return 1.0f;
     }
 
-    if (dynamic_cast<MovementAction*>(action) && !dynamic_cast<RsBaltharusBrandAction*>(action))
+    if (action->HasCategory(ACTION_CATEGORY_MOVEMENT) && !dynamic_cast<RsBaltharusBrandAction*>(action))
         return 0.0f;
 
     return 1.0f;
@@ -94,7 +94,7 @@ float RsSavianaMeleeSpreadMultiplier::GetValue(Action* action)
     if (!boss || !boss->IsLevitating())
         return 1.0f;
 
-    if (dynamic_cast<MovementAction*>(action) && !dynamic_cast<RsSavianaMeleeSpreadAction*>(action))
+    if (action->HasCategory(ACTION_CATEGORY_MOVEMENT) && !dynamic_cast<RsSavianaMeleeSpreadAction*>(action))
         return 0.0f;
 
     return 1.0f;
@@ -112,7 +112,7 @@ float RsZarithrianAddsMultiplier::GetValue(Action* action)
     if (!RsFindTarget(botAI, [](Unit* unit) { return unit->GetEntry() == NPC_ONYX_FLAMECALLER; }))
         return 1.0f;
 
-    if (dynamic_cast<CombatFormationMoveAction*>(action) || dynamic_cast<FollowAction*>(action))
+    if (action->HasCategory(ACTION_CATEGORY_COMBAT_FORMATION_MOVE | ACTION_CATEGORY_FOLLOW))
         return 0.0f;
 
     return 1.0f;
@@ -131,11 +131,10 @@ float RsZarithrianTankSwapMultiplier::GetValue(Action* action)
     if (!aura || aura->GetStackAmount() < RS_ZARITHRIAN_CLEAVE_SWAP_STACKS)
         return 1.0f;
 
-    if (dynamic_cast<CastTauntAction*>(action) || dynamic_cast<CastDarkCommandAction*>(action) ||
-        dynamic_cast<CastHandOfReckoningAction*>(action) || dynamic_cast<CastGrowlAction*>(action))
+    if (action->HasCategory(ACTION_CATEGORY_TAUNT))
         return 0.0f;
 
-    if (dynamic_cast<MovementAction*>(action) || dynamic_cast<RsZarithrianTankAction*>(action))
+    if (action->HasCategory(ACTION_CATEGORY_MOVEMENT) || dynamic_cast<RsZarithrianTankAction*>(action))
         return 1.0f;
 
     return 0.0f;
@@ -160,7 +159,7 @@ float RsHalionCombustionMultiplier::GetValue(Action* action)
     if (RsIsAoeDamageAction(action))
         return 0.0f;
 
-    if (dynamic_cast<MovementAction*>(action) && !dynamic_cast<RsHalionCombustionAction*>(action))
+    if (action->HasCategory(ACTION_CATEGORY_MOVEMENT) && !dynamic_cast<RsHalionCombustionAction*>(action))
         return 0.0f;
 
     return 1.0f;
@@ -184,7 +183,7 @@ float RsHalionMeteorMultiplier::GetValue(Action* action)
     if (!RsHalionMeteorShouldRally(bot))
         return 1.0f;
 
-    if (dynamic_cast<MovementAction*>(action) && !dynamic_cast<RsHalionMeteorAction*>(action) &&
+    if (action->HasCategory(ACTION_CATEGORY_MOVEMENT) && !dynamic_cast<RsHalionMeteorAction*>(action) &&
         !dynamic_cast<RsHalionEnterPortalAction*>(action))
         return 0.0f;
 
@@ -200,18 +199,18 @@ float RsHalionMeleeFlankMultiplier::GetValue(Action* action)
         dynamic_cast<CastFeralChargeCatAction*>(action))
         return 0.0f;
 
-    if (dynamic_cast<AvoidAoeAction*>(action) &&
+    if (action->HasCategory(ACTION_CATEGORY_AVOID_AOE) &&
         (RsHalionEnteringTwilight(botAI, bot) || RsHalionPortalHeldForAdds(botAI)))
         return 1.0f;
 
-    if (botAI->IsTank(bot) && dynamic_cast<AvoidAoeAction*>(action))
+    if (botAI->IsTank(bot) && action->HasCategory(ACTION_CATEGORY_AVOID_AOE))
         return 0.0f;
 
-    if (dynamic_cast<CastDisengageAction*>(action) || dynamic_cast<TankAssistAction*>(action) ||
+    if (dynamic_cast<CastDisengageAction*>(action) || action->HasCategory(ACTION_CATEGORY_TANK_ASSIST) ||
         dynamic_cast<CastBlinkBackAction*>(action))
         return 0.0f;
 
-    if (dynamic_cast<CombatFormationMoveAction*>(action) || dynamic_cast<FollowAction*>(action))
+    if (action->HasCategory(ACTION_CATEGORY_COMBAT_FORMATION_MOVE | ACTION_CATEGORY_FOLLOW))
         return 0.0f;
 
     if (RsHalionHasCombustion(bot) || RsHalionIsCombustionDispeller(botAI) || RsHalionCombustionReturning(bot))
@@ -262,7 +261,7 @@ float RsHalionHpBalanceMultiplier::GetValue(Action* action)
         dynamic_cast<RsHalionHealConsumptionAction*>(action))
         return 1.0f;
 
-    if (dynamic_cast<AttackAction*>(action))
+    if (action->HasCategory(ACTION_CATEGORY_ATTACK))
         return 0.0f;
 
     if (dynamic_cast<PetAttackAction*>(action))
@@ -302,7 +301,7 @@ float RsTrashAddsMultiplier::GetValue(Action* action)
     if (!RsTrashActive(botAI, bot))
         return 1.0f;
 
-    if (dynamic_cast<CombatFormationMoveAction*>(action) || dynamic_cast<FollowAction*>(action))
+    if (action->HasCategory(ACTION_CATEGORY_COMBAT_FORMATION_MOVE | ACTION_CATEGORY_FOLLOW))
         return 0.0f;
 
     return 1.0f;
@@ -330,7 +329,7 @@ float RsHalionP2Multiplier::GetValue(Action* action)
         if (!RsHalionEnteringTwilight(botAI, bot) &&
             !dynamic_cast<RsHalionP2AvoidConesAction*>(action) &&
             !dynamic_cast<RsHalionCutterAction*>(action) &&
-            (dynamic_cast<MovementAction*>(action) || dynamic_cast<AttackAction*>(action)))
+            (action->HasCategory(ACTION_CATEGORY_MOVEMENT | ACTION_CATEGORY_ATTACK)))
             return 0.0f;
 
         return 1.0f;
@@ -345,7 +344,7 @@ float RsHalionP2Multiplier::GetValue(Action* action)
 
     if (bot->HasAura(SPELL_MARK_OF_CONSUMPTION) || bot->HasAura(SPELL_SOUL_CONSUMPTION))
     {
-        if (dynamic_cast<MovementAction*>(action) && !dynamic_cast<RsHalionConsumptionAction*>(action))
+        if (action->HasCategory(ACTION_CATEGORY_MOVEMENT) && !dynamic_cast<RsHalionConsumptionAction*>(action))
             return 0.0f;
         return 1.0f;
     }
@@ -371,7 +370,7 @@ float RsHalionP2Multiplier::GetValue(Action* action)
     if (twilightTank != bot && dynamic_cast<ReachMeleeAction*>(action))
         return 0.0f;
 
-    if (dynamic_cast<CombatFormationMoveAction*>(action) || dynamic_cast<FollowAction*>(action))
+    if (action->HasCategory(ACTION_CATEGORY_COMBAT_FORMATION_MOVE | ACTION_CATEGORY_FOLLOW))
         return 0.0f;
 
     return 1.0f;
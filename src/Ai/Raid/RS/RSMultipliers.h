@@ -33,7 +33,10 @@ public:
 class RsZarithrianAddsMultiplier : public Multiplier
 {
 public:
-    RsZarithrianAddsMultiplier(PlayerbotAI* ai) : Multiplier(ai, "rs zarithrian adds") {}
+    RsZarithrianAddsMultiplier(PlayerbotAI* ai)
+        : Multiplier(ai, "rs zarithrian adds", ACTION_CATEGORY_COMBAT_FORMATION_MOVE | ACTION_CATEGORY_FOLLOW)
+    {
+    }
     virtual float GetValue(Action* action);
 };
 
@@ -89,7 +92,10 @@ public:
 class RsTrashAddsMultiplier : public Multiplier
 {
 public:
-    RsTrashAddsMultiplier(PlayerbotAI* ai) : Multiplier(ai, "rs trash adds") {}
+    RsTrashAddsMultiplier(PlayerbotAI* ai)
+        : Multiplier(ai, "rs trash adds", ACTION_CATEGORY_COMBAT_FORMATION_MOVE | ACTION_CATEGORY_FOLLOW)
+    {
+    }
     virtual float GetValue(Action* action);
 };
 
@@ -1,5 +1,6 @@
 #include "RaidBossHelpers.h"
 #include "Playerbots.h"
+#include "RaidEncounterState.h"
 #include "RtiTargetValue.h"
 
 // Functions to mark targets with raid target icons
@@ -90,91 +91,21 @@ bool IsMechanicTrackerBot(PlayerbotAI* botAI, Player* bot, uint32 mapId, Player*
     if (!botAI->IsDps(bot) || !bot->IsAlive() || bot->GetMapId() != mapId)
         return false;
 
-    Group* group = bot->GetGroup();
-    if (!group)
-        return false;
-
-    for (GroupReference* ref = group->GetFirstMember(); ref; ref = ref->next())
-    {
-        Player* member = ref->GetSource();
-        if (!member || !member->IsAlive() || member->GetMapId() != mapId || member == exclude)
-            continue;
-
-        PlayerbotAI* memberAI = GET_PLAYERBOT_AI(member);
-        if (!memberAI || !memberAI->IsDps(member))
-            continue;
-
-        return member == bot;
-    }
-
-    return false;
+    return sRaidEncounterState.GetMechanicTracker(bot, exclude) == bot;
 }
 
 // Requires the main tank to be alive
 // Note that IsMainTank() will return the player with the main tank flag, even if dead
-Player* GetGroupMainTank(PlayerbotAI* botAI, Player* bot)
+Player* GetGroupMainTank(PlayerbotAI* /*botAI*/, Player* bot)
 {
-    Group* group = bot->GetGroup();
-    if (!group)
-        return nullptr;
-
-    ObjectGuid const mainTankGuid = botAI->GetMainTankGuid(group);
-    if (mainTankGuid.IsEmpty())
-        return nullptr;
-
-    for (GroupReference* ref = group->GetFirstMember(); ref; ref = ref->next())
-    {
-        Player* member = ref->GetSource();
-        if (member && member->IsAlive() && member->GetGUID() == mainTankGuid)
-            return member;
-    }
-
-    return nullptr;
+    return sRaidEncounterState.GetMainTank(bot);
 }
 
 // Returns the alive assist tank of the specified index (0 = first, 1 = second, etc.)
 // Priority: Assistants first, then Non-Assistants.
-Player* GetGroupAssistTank(PlayerbotAI* botAI, Player* bot, uint8 index)
+Player* GetGroupAssistTank(PlayerbotAI* /*botAI*/, Player* bot, uint8 index)
 {
-    Group* group = bot->GetGroup();
-    if (!group)
-        return nullptr;
-
-    ObjectGuid const mainTankGuid = botAI->GetMainTankGuid(group);
-    if (mainTankGuid.IsEmpty())
-        return nullptr;
-
-    uint8 assistantCount = 0;
-    std::vector<Player*> nonAssistantTanks;
-
-    for (GroupReference* ref = group->GetFirstMember(); ref; ref = ref->next())
-    {
-        Player* member = ref->GetSource();
-        if (!member || !member->IsAlive() || !botAI->IsTank(member) ||
-            member->GetGUID() == mainTankGuid)
-        {
-            continue;
-        }
-
-        if (group->IsAssistant(member->GetGUID()))
-        {
-            if (assistantCount == index)
-                return member;
-
-            assistantCount++;
-        }
-        else
-        {
-            nonAssistantTanks.push_back(member);
-        }
-    }
-
-    // If the index wasn't found among assistants, check the non-assistants that were saved
-    uint8 nonAssistantIndex = index - assistantCount;
-    if (nonAssistantIndex < nonAssistantTanks.size())
-        return nonAssistantTanks[nonAssistantIndex];
-
-    return nullptr;
+    return sRaidEncounterState.GetAssistTank(bot, index);
 }
 
 // Return the first matching alive unit from PossibleTargetsValue within sightDistance from config
@@ -0,0 +1,211 @@
+/*
+ * This file is part of the mod-playerbots module for AzerothCore. See AUTHORS file for Copyright
+ * information; released under GNU GPL v2 license, redistribute/modify under version 2 of the License,
+ * or (at your option) any later version.
+ */
+
+#include "RaidEncounterState.h"
+
+#include <mutex>
+
+#include "GameTime.h"
+#include "Group.h"
+#include "ObjectAccessor.h"
+#include "Playerbots.h"
+
+uint32 RaidEncounterState::GetGeneration()
+{
+    // Only changes between world ticks, so it stays the same for every bot of one map update.
+    return static_cast<uint32>(GameTime::GetGameTimeMS().count());
+}
+
+uint64 RaidEncounterState::GetInstanceKey(Player* bot)
+{
+    return (uint64(bot->GetMapId()) << 32) | bot->GetInstanceId();
+}
+
+RaidEncounterState::Encounter& RaidEncounterState::GetEncounter(Player* bot)
+{
+    uint64 const key = GetInstanceKey(bot);
+    uint32 const now = GetGeneration();
+
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex);
+        auto itr = encounters.find(key);
+        if (itr != encounters.end())
+        {
+            // Stamped under the lock so an expiry sweep never drops an encounter that is in use.
+            itr->second->lastUsed.store(now, std::memory_order_relaxed);
+            return *itr->second;
+        }
+    }
+
+    std::unique_lock<std::shared_mutex> lock(mutex);
+
+    // New instances are rare, a good moment to drop the encounters of instances left behind.
+    for (auto itr = encounters.begin(); itr != encounters.end();)
+    {
+        if (itr->first != key && now - itr->second->lastUsed.load(std::memory_order_relaxed) > ENCOUNTER_EXPIRY_MS)
+            itr = encounters.erase(itr);
+        else
+            ++itr;
+    }
+
+    std::unique_ptr<Encounter>& encounter = encounters[key];
+    if (!encounter)
+        encounter = std::make_unique<Encounter>();
+
+    encounter->lastUsed.store(now, std::memory_order_relaxed);
+    return *encounter;
+}
+
+RaidEncounterState::GroupState* RaidEncounterState::GetGroupState(Player* bot, Group* group)
+{
+    if (!group)
+        return nullptr;
+
+    return &GetEncounter(bot).groups[group->GetGUID()];
+}
+
+Player* RaidEncounterState::GetCachedPlayer(CachedPlayer const& cached)
+{
+    if (cached.generation != GetGeneration())
+        return nullptr;
+
+    Player* player = ObjectAccessor::FindPlayer(cached.guid);
+    if (!player || !player->IsAlive())
+        return nullptr;
+
+    return player;
+}
+
+Player* RaidEncounterState::GetMainTank(Player* bot)
+{
+    Group* group = bot->GetGroup();
+    GroupState* state = GetGroupState(bot, group);
+    if (!state)
+        return nullptr;
+
+    if (state->mainTank.generation == GetGeneration() && state->mainTank.guid.IsEmpty())
+        return nullptr;
+
+    if (Player* mainTank = GetCachedPlayer(state->mainTank))
+        return mainTank;
+
+    state->mainTank.generation = GetGeneration();
+    state->mainTank.guid = FindMainTank(group);
+
+    return GetCachedPlayer(state->mainTank);
+}
+
+Player* RaidEncounterState::GetAssistTank(Player* bot, uint8 index)
+{
+    Group* group = bot->GetGroup();
+    GroupState* state = GetGroupState(bot, group);
+    if (!state)
+        return nullptr;
+
+    uint32 const generation = GetGeneration();
+    if (state->assistTanksGeneration != generation)
+    {
+        state->assistTanksGeneration = generation;
+        state->assistTanks.clear();
+
+        ObjectGuid const mainTankGuid = PlayerbotAI::GetMainTankGuid(group);
+        if (!mainTankGuid.IsEmpty())
+            FindAssistTanks(group, mainTankGuid, state->assistTanks);
+    }
+
+    if (index >= state->assistTanks.size())
+        return nullptr;
+
+    Player* assistTank = ObjectAccessor::FindPlayer(state->assistTanks[index]);
+    if (assistTank && assistTank->IsAlive())
+        return assistTank;
+
+    // One of the tanks died during this tick, the order of the ones after it changes.
+    state->assistTanks.clear();
+    FindAssistTanks(group, PlayerbotAI::GetMainTankGuid(group), state->assistTanks);
+
+    if (index >= state->assistTanks.size())
+        return nullptr;
+
+    return ObjectAccessor::FindPlayer(state->assistTanks[index]);
+}
+
+Player* RaidEncounterState::GetMechanicTracker(Player* bot, Player* exclude)
+{
+    Group* group = bot->GetGroup();
+    GroupState* state = GetGroupState(bot, group);
+    if (!state)
+        return nullptr;
+
+    CachedPlayer& tracker = state->mechanicTrackers[exclude ? exclude->GetGUID() : ObjectGuid::Empty];
+    Player* player = GetCachedPlayer(tracker);
+    if (player && player->GetMapId() == bot->GetMapId())
+        return player;
+
+    if (tracker.generation == GetGeneration() && tracker.guid.IsEmpty())
+        return nullptr;
+
+    tracker.generation = GetGeneration();
+    tracker.guid = FindMechanicTracker(group, bot->GetMapId(), exclude);
+
+    return GetCachedPlayer(tracker);
+}
+
+ObjectGuid RaidEncounterState::FindMainTank(Group* group)
+{
+    ObjectGuid const mainTankGuid = PlayerbotAI::GetMainTankGuid(group);
+    if (mainTankGuid.IsEmpty())
+        return ObjectGuid::Empty;
+
+    for (GroupReference* ref = group->GetFirstMember(); ref; ref = ref->next())
+    {
+        Player* member = ref->GetSource();
+        if (member && member->IsAlive() && member->GetGUID() == mainTankGuid)
+            return mainTankGuid;
+    }
+
+    return ObjectGuid::Empty;
+}
+
+// Assistants first, then the other tanks, both in group order.
+void RaidEncounterState::FindAssistTanks(Group* group, ObjectGuid mainTankGuid, std::vector<ObjectGuid>& out)
+{
+    if (mainTankGuid.IsEmpty())
+        return;
+
+    std::vector<ObjectGuid> nonAssistantTanks;
+    for (GroupReference* ref = group->GetFirstMember(); ref; ref = ref->next())
+    {
+        Player* member = ref->GetSource();
+        if (!member || !member->IsAlive() || !PlayerbotAI::IsTank(member) || member->GetGUID() == mainTankGuid)
+            continue;
+
+        if (group->IsAssistant(member->GetGUID()))
+            out.push_back(member->GetGUID());
+        else
+            nonAssistantTanks.push_back(member->GetGUID());
+    }
+
+    out.insert(out.end(), nonAssistantTanks.begin(), nonAssistantTanks.end());
+}
+
+ObjectGuid RaidEncounterState::FindMechanicTracker(Group* group, uint32 mapId, Player* exclude)
+{
+    for (GroupReference* ref = group->GetFirstMember(); ref; ref = ref->next())
+    {
+        Player* member = ref->GetSource();
+        if (!member || !member->IsAlive() || member->GetMapId() != mapId || member == exclude)
+            continue;
+
+        PlayerbotAI* memberAI = GET_PLAYERBOT_AI(member);
+        if (!memberAI || !memberAI->IsDps(member))
+            continue;
+
+        return member->GetGUID();
+    }
+
+    return ObjectGuid::Empty;
+}
@@ -0,0 +1,86 @@
+/*
+ * This file is part of the mod-playerbots module for AzerothCore. See AUTHORS file for Copyright
+ * information; released under GNU GPL v2 license, redistribute/modify under version 2 of the License,
+ * or (at your option) any later version.
+ */
+
+#ifndef PLAYERBOTS_RAIDENCOUNTERSTATE_H
+#define PLAYERBOTS_RAIDENCOUNTERSTATE_H
+
+#include <atomic>
+#include <memory>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "Common.h"
+#include "ObjectGuid.h"
+
+class Group;
+class Player;
+
+// Encounter facts every bot of a raid group asks for on each of its updates (the main tank, the assist
+// tanks and the mechanic tracker), computed once per world tick for the group instead of once per bot.
+// All bots of an instance update on the same map thread, so the state of one instance is only touched by
+// one thread at a time; the registry itself is shared between the map threads.
+// Each fact carries the generation (world tick) it was computed in. A fact from an older generation is
+// recomputed on read, and a cached player that died or left the map since is too.
+class RaidEncounterState
+{
+public:
+    static RaidEncounterState& instance()
+    {
+        static RaidEncounterState instance;
+        return instance;
+    }
+
+    // Same results as GetGroupMainTank, GetGroupAssistTank and IsMechanicTrackerBot in RaidBossHelpers.
+    Player* GetMainTank(Player* bot);
+    Player* GetAssistTank(Player* bot, uint8 index);
+    Player* GetMechanicTracker(Player* bot, Player* exclude);
+
+private:
+    struct CachedPlayer
+    {
+        uint32 generation = 0;
+        ObjectGuid guid;
+    };
+
+    struct GroupState
+    {
+        CachedPlayer mainTank;
+        uint32 assistTanksGeneration = 0;
+        std::vector<ObjectGuid> assistTanks;
+        // Keyed by the guid of the excluded member, empty when nobody is excluded.
+        std::unordered_map<ObjectGuid, CachedPlayer> mechanicTrackers;
+    };
+
+    struct Encounter
+    {
+        std::atomic<uint32> lastUsed{0};
+        std::unordered_map<ObjectGuid, GroupState> groups;
+    };
+
+    // Encounters not used for this long belong to instances no bot is in anymore.
+    static constexpr uint32 ENCOUNTER_EXPIRY_MS = 5 * MINUTE * IN_MILLISECONDS;
+
+    RaidEncounterState() = default;
+
+    static uint32 GetGeneration();
+    static uint64 GetInstanceKey(Player* bot);
+
+    GroupState* GetGroupState(Player* bot, Group* group);
+    Encounter& GetEncounter(Player* bot);
+    static Player* GetCachedPlayer(CachedPlayer const& cached);
+
+    static ObjectGuid FindMainTank(Group* group);
+    static void FindAssistTanks(Group* group, ObjectGuid mainTankGuid, std::vector<ObjectGuid>& out);
+    static ObjectGuid FindMechanicTracker(Group* group, uint32 mapId, Player* exclude);
+
+    std::shared_mutex mutex;
+    std::unordered_map<uint64, std::unique_ptr<Encounter>> encounters;
+};
+
+#define sRaidEncounterState RaidEncounterState::instance()
+
+#endif
@@ -35,7 +35,7 @@ using namespace SerpentShrineCavernHelpers;
 float UnderbogColossusEscapeToxicPoolMultiplier::GetValue(Action* action)
 {
     if (bot->HasAura(SPELL_TOXIC_POOL) &&
-        dynamic_cast<MovementAction*>(action) &&
+        action->HasCategory(ACTION_CATEGORY_MOVEMENT) &&
         !dynamic_cast<UnderbogColossusEscapeToxicPoolAction*>(action))
         return 0.0f;
 
@@ -53,17 +53,15 @@ float HydrossTheUnstableDisableTankActionsMultiplier::GetValue(Action* action)
     if (!hydross)
         return 1.0f;
 
-    if (dynamic_cast<TankAssistAction*>(action) ||
-        dynamic_cast<CombatFormationMoveAction*>(action))
+    if (action->HasCategory(ACTION_CATEGORY_TANK_ASSIST | ACTION_CATEGORY_COMBAT_FORMATION_MOVE))
         return 0.0f;
 
     if ((botAI->IsMainTank(bot) && !hydross->HasAura(SPELL_CORRUPTION)) ||
         (botAI->IsAssistTankOfIndex(bot, 0, true) && hydross->HasAura(SPELL_CORRUPTION)))
         return 1.0f;
 
-    if (dynamic_cast<CastReachTargetSpellAction*>(action) ||
-        dynamic_cast<ReachTargetAction*>(action) ||
-        (dynamic_cast<AttackAction*>(action) &&
+    if (action->HasCategory(ACTION_CATEGORY_REACH_SPELL | ACTION_CATEGORY_REACH_TARGET) ||
+        (action->HasCategory(ACTION_CATEGORY_ATTACK) &&
          !dynamic_cast<HydrossTheUnstablePositionFrostTankAction*>(action) &&
          !dynamic_cast<HydrossTheUnstablePositionNatureTankAction*>(action)))
         return 0.0f;
@@ -104,9 +102,9 @@ float HydrossTheUnstableWaitForDpsMultiplier::GetValue(Action* action)
         if (!justChanged && !aboutToChange)
             return 1.0f;
 
-        if (dynamic_cast<AttackAction*>(action) ||
-            (dynamic_cast<CastSpellAction*>(action) &&
-             !dynamic_cast<CastHealingSpellAction*>(action)))
+        if (action->HasCategory(ACTION_CATEGORY_ATTACK) ||
+            (action->HasCategory(ACTION_CATEGORY_SPELL) &&
+             !action->HasCategory(ACTION_CATEGORY_HEAL)))
             return 0.0f;
     }
 
@@ -123,9 +121,9 @@ float HydrossTheUnstableWaitForDpsMultiplier::GetValue(Action* action)
         if (!justChanged && !aboutToChange)
             return 1.0f;
 
-        if (dynamic_cast<AttackAction*>(action) ||
-            (dynamic_cast<CastSpellAction*>(action) &&
-             !dynamic_cast<CastHealingSpellAction*>(action)))
+        if (action->HasCategory(ACTION_CATEGORY_ATTACK) ||
+            (action->HasCategory(ACTION_CATEGORY_SPELL) &&
+             !action->HasCategory(ACTION_CATEGORY_HEAL)))
             return 0.0f;
     }
 
@@ -157,14 +155,14 @@ float TheLurkerBelowStayAwayFromSpoutMultiplier::GetValue(Action* action)
     auto it = lurkerSpoutTimer.find(lurker->GetMap()->GetInstanceId());
     if (it != lurkerSpoutTimer.end() && it->second > now)
     {
-        if (dynamic_cast<CastReachTargetSpellAction*>(action) ||
+        if (action->HasCategory(ACTION_CATEGORY_REACH_SPELL) ||
             dynamic_cast<CastKillingSpreeAction*>(action) ||
             dynamic_cast<CastBlinkBackAction*>(action) ||
             dynamic_cast<CastDisengageAction*>(action))
             return 0.0f;
 
-        if (dynamic_cast<MovementAction*>(action) &&
-            !dynamic_cast<AttackAction*>(action) &&
+        if (action->HasCategory(ACTION_CATEGORY_MOVEMENT) &&
+            !action->HasCategory(ACTION_CATEGORY_ATTACK) &&
             !dynamic_cast<TheLurkerBelowRunAroundBehindBossAction*>(action))
             return 0.0f;
     }
@@ -180,8 +178,7 @@ float TheLurkerBelowMaintainRangedSpreadMultiplier::GetValue(Action* action)
     if (!AI_VALUE2(Unit*, "find target", "the lurker below"))
         return 1.0f;
 
-    if (dynamic_cast<CombatFormationMoveAction*>(action) ||
-        dynamic_cast<FleeAction*>(action) ||
+    if (action->HasCategory(ACTION_CATEGORY_COMBAT_FORMATION_MOVE | ACTION_CATEGORY_FLEE) ||
         dynamic_cast<CastDisengageAction*>(action) ||
         dynamic_cast<CastBlinkBackAction*>(action))
         return 0.0f;
@@ -220,7 +217,7 @@ float TheLurkerBelowDisableTankAssistMultiplier::GetValue(Action* action)
     if (tankCount < 3)
         return 1.0f;
 
-    if (dynamic_cast<TankAssistAction*>(action))
+    if (action->HasCategory(ACTION_CATEGORY_TANK_ASSIST))
         return 0.0f;
 
     return 1.0f;
@@ -241,11 +238,11 @@ float LeotherasTheBlindAvoidWhirlwindMultiplier::GetValue(Action* action)
         !leotheras->HasAura(SPELL_WHIRLWIND_CHANNEL)))
         return 1.0f;
 
-    if (dynamic_cast<CastReachTargetSpellAction*>(action))
+    if (action->HasCategory(ACTION_CATEGORY_REACH_SPELL))
         return 0.0f;
 
-    if (dynamic_cast<MovementAction*>(action) &&
-        !dynamic_cast<AttackAction*>(action) &&
+    if (action->HasCategory(ACTION_CATEGORY_MOVEMENT) &&
+        !action->HasCategory(ACTION_CATEGORY_ATTACK) &&
         !dynamic_cast<LeotherasTheBlindRunAwayFromWhirlwindAction*>(action))
         return 0.0f;
 
@@ -260,7 +257,7 @@ float LeotherasTheBlindDisableTankActionsMultiplier::GetValue(Action* action)
     if (!AI_VALUE2(Unit*, "find target", "leotheras the blind"))
         return 1.0f;
 
-    if (GetPhase2LeotherasDemon(bot) && dynamic_cast<AttackAction*>(action))
+    if (GetPhase2LeotherasDemon(bot) && action->HasCategory(ACTION_CATEGORY_ATTACK))
         return 0.0f;
 
     if (!GetPhase3LeotherasDemon(bot) && dynamic_cast<CastBerserkAction*>(action))
@@ -274,9 +271,7 @@ float LeotherasTheBlindFocusOnInnerDemonMultiplier::GetValue(Action* action)
     if (!bot->HasAura(SPELL_INSIDIOUS_WHISPER))
         return 1.0f;
 
-    if (dynamic_cast<TankAssistAction*>(action) ||
-        dynamic_cast<DpsAssistAction*>(action) ||
-        dynamic_cast<CastHealingSpellAction*>(action) ||
+    if (action->HasCategory(ACTION_CATEGORY_TANK_ASSIST | ACTION_CATEGORY_DPS_ASSIST | ACTION_CATEGORY_HEAL) ||
         dynamic_cast<CastCureSpellAction*>(action) ||
         dynamic_cast<CurePartyMemberAction*>(action) ||
         dynamic_cast<CastBuffSpellAction*>(action) ||
@@ -302,10 +297,8 @@ float LeotherasTheBlindMeleeDpsAvoidChaosBlastMultiplier::GetValue(Action* actio
     if (!chaosBlast || chaosBlast->GetStackAmount() < 5)
         return 1.0f;
 
-    if (dynamic_cast<AttackAction*>(action) ||
-        dynamic_cast<ReachTargetAction*>(action) ||
-        dynamic_cast<CombatFormationMoveAction*>(action) ||
-        dynamic_cast<CastReachTargetSpellAction*>(action) ||
+    if (action->HasCategory(ACTION_CATEGORY_ATTACK | ACTION_CATEGORY_REACH_TARGET |
+                            ACTION_CATEGORY_COMBAT_FORMATION_MOVE | ACTION_CATEGORY_REACH_SPELL) ||
         dynamic_cast<CastKillingSpreeAction*>(action))
         return 0.0f;
 
@@ -340,9 +333,9 @@ float LeotherasTheBlindWaitForDpsMultiplier::GetValue(Action* action)
         if (it == leotherasHumanFormDpsWaitTimer.end() ||
             (now - it->second) < dpsWaitSecondsPhase1)
         {
-            if (dynamic_cast<AttackAction*>(action) ||
-                (dynamic_cast<CastSpellAction*>(action) &&
-                 !dynamic_cast<CastHealingSpellAction*>(action)))
+            if (action->HasCategory(ACTION_CATEGORY_ATTACK) ||
+                (action->HasCategory(ACTION_CATEGORY_SPELL) &&
+                 !action->HasCategory(ACTION_CATEGORY_HEAL)))
                 return 0.0f;
         }
     }
@@ -362,9 +355,9 @@ float LeotherasTheBlindWaitForDpsMultiplier::GetValue(Action* action)
         if (it == leotherasDemonFormDpsWaitTimer.end() ||
             (now - it->second) < dpsWaitSecondsPhase2)
         {
-            if (dynamic_cast<AttackAction*>(action) ||
-                (dynamic_cast<CastSpellAction*>(action) &&
-                 !dynamic_cast<CastHealingSpellAction*>(action)))
+            if (action->HasCategory(ACTION_CATEGORY_ATTACK) ||
+                (action->HasCategory(ACTION_CATEGORY_SPELL) &&
+                 !action->HasCategory(ACTION_CATEGORY_HEAL)))
                 return 0.0f;
         }
     }
@@ -379,9 +372,9 @@ float LeotherasTheBlindWaitForDpsMultiplier::GetValue(Action* action)
         if (it == leotherasFinalPhaseDpsWaitTimer.end() ||
             (now - it->second) < dpsWaitSecondsPhase3)
         {
-            if (dynamic_cast<AttackAction*>(action) ||
-                (dynamic_cast<CastSpellAction*>(action) &&
-                 !dynamic_cast<CastHealingSpellAction*>(action)))
+            if (action->HasCategory(ACTION_CATEGORY_ATTACK) ||
+                (action->HasCategory(ACTION_CATEGORY_SPELL) &&
+                 !action->HasCategory(ACTION_CATEGORY_HEAL)))
                 return 0.0f;
         }
     }
@@ -416,22 +409,18 @@ float FathomLordKarathressDisableTankActionsMultiplier::GetValue(Action* action)
     if (!AI_VALUE2(Unit*, "find target", "fathom-lord karathress"))
         return 1.0f;
 
-    if (bot->GetVictim() != nullptr && dynamic_cast<TankAssistAction*>(action))
+    if (bot->GetVictim() != nullptr && action->HasCategory(ACTION_CATEGORY_TANK_ASSIST))
         return 0.0f;
 
-    if (dynamic_cast<CombatFormationMoveAction*>(action) ||
-        dynamic_cast<AvoidAoeAction*>(action) ||
-        dynamic_cast<CastTauntAction*>(action) ||
+    if (action->HasCategory(ACTION_CATEGORY_COMBAT_FORMATION_MOVE | ACTION_CATEGORY_AVOID_AOE) ||
+        action->HasCategory(ACTION_CATEGORY_TAUNT) ||
         dynamic_cast<CastChallengingShoutAction*>(action) ||
         dynamic_cast<CastThunderClapAction*>(action) ||
         dynamic_cast<CastShockwaveAction*>(action) ||
         dynamic_cast<CastCleaveAction*>(action) ||
-        dynamic_cast<CastGrowlAction*>(action) ||
         dynamic_cast<CastSwipeAction*>(action) ||
-        dynamic_cast<CastHandOfReckoningAction*>(action) ||
         dynamic_cast<CastAvengersShieldAction*>(action) ||
         dynamic_cast<CastConsecrationAction*>(action) ||
-        dynamic_cast<CastDarkCommandAction*>(action) ||
         dynamic_cast<CastDeathAndDecayAction*>(action) ||
         dynamic_cast<CastPestilenceAction*>(action) ||
         dynamic_cast<CastBloodBoilAction*>(action))
@@ -487,9 +476,9 @@ float FathomLordKarathressWaitForDpsMultiplier::GetValue(Action* action)
     auto it = karathressDpsWaitTimer.find(karathress->GetMap()->GetInstanceId());
     if (it == karathressDpsWaitTimer.end() || (now - it->second) < dpsWaitSeconds)
     {
-        if (dynamic_cast<AttackAction*>(action) ||
-            (dynamic_cast<CastSpellAction*>(action) &&
-             !dynamic_cast<CastHealingSpellAction*>(action)))
+        if (action->HasCategory(ACTION_CATEGORY_ATTACK) ||
+            (action->HasCategory(ACTION_CATEGORY_SPELL) &&
+             !action->HasCategory(ACTION_CATEGORY_HEAL)))
             return 0.0f;
     }
 
@@ -504,8 +493,7 @@ float FathomLordKarathressCaribdisTankHealerMaintainPositionMultiplier::GetValue
     if (!AI_VALUE2(Unit*, "find target", "fathom-guard caribdis"))
         return 1.0f;
 
-    if (dynamic_cast<FleeAction*>(action) ||
-        dynamic_cast<FollowAction*>(action))
+    if (action->HasCategory(ACTION_CATEGORY_FLEE | ACTION_CATEGORY_FOLLOW))
         return 0.0f;
 
     return 1.0f;
@@ -540,7 +528,7 @@ float MorogrimTidewalkerDisableTankActionsMultiplier::GetValue(Action* action)
     if (!AI_VALUE2(Unit*, "find target", "morogrim tidewalker"))
         return 1.0f;
 
-    if (dynamic_cast<CombatFormationMoveAction*>(action))
+    if (action->HasCategory(ACTION_CATEGORY_COMBAT_FORMATION_MOVE))
         return 0.0f;
 
     return 1.0f;
@@ -555,8 +543,7 @@ float MorogrimTidewalkerMaintainPhase2StackingMultiplier::GetValue(Action* actio
     if (!tidewalker || tidewalker->GetHealthPct() > 25.0f)
         return 1.0f;
 
-    if (dynamic_cast<CombatFormationMoveAction*>(action) ||
-        dynamic_cast<FleeAction*>(action) ||
+    if (action->HasCategory(ACTION_CATEGORY_COMBAT_FORMATION_MOVE | ACTION_CATEGORY_FLEE) ||
         dynamic_cast<CastDisengageAction*>(action) ||
         dynamic_cast<CastBlinkBackAction*>(action))
         return 0.0f;
@@ -639,8 +626,7 @@ float LadyVashjMaintainPhase1RangedSpreadMultiplier::GetValue(Action* action)
         !IsLadyVashjInPhase1(botAI))
         return 1.0f;
 
-    if (dynamic_cast<CombatFormationMoveAction*>(action) ||
-        dynamic_cast<FleeAction*>(action) ||
+    if (action->HasCategory(ACTION_CATEGORY_COMBAT_FORMATION_MOVE | ACTION_CATEGORY_FLEE) ||
         dynamic_cast<CastDisengageAction*>(action) ||
         dynamic_cast<CastBlinkBackAction*>(action))
         return 0.0f;
@@ -656,11 +642,10 @@ float LadyVashjStaticChargeStayAwayFromGroupMultiplier::GetValue(Action* action)
     if (!AI_VALUE2(Unit*, "find target", "lady vashj"))
         return 1.0f;
 
-    if (dynamic_cast<CombatFormationMoveAction*>(action) ||
-        dynamic_cast<ReachTargetAction*>(action) ||
-        dynamic_cast<FollowAction*>(action) ||
+    if (action->HasCategory(ACTION_CATEGORY_COMBAT_FORMATION_MOVE | ACTION_CATEGORY_REACH_TARGET |
+                            ACTION_CATEGORY_FOLLOW) ||
         dynamic_cast<CastKillingSpreeAction*>(action) ||
-        dynamic_cast<CastReachTargetSpellAction*>(action))
+        action->HasCategory(ACTION_CATEGORY_REACH_SPELL))
         return 0.0f;
 
     return 1.0f;
@@ -714,13 +699,13 @@ float LadyVashjCorePassersPrioritizePositioningMultiplier::GetValue(Action* acti
     Unit* tainted = AI_VALUE2(Unit*, "find target", "tainted elemental");
     if (tainted && coreHandlers[0]->GetExactDist2d(tainted) < 5.0f &&
         (bot == coreHandlers[1] || bot == coreHandlers[2]) &&
-        (dynamic_cast<MovementAction*>(action) &&
+        (action->HasCategory(ACTION_CATEGORY_MOVEMENT) &&
          !dynamic_cast<LadyVashjPassTheTaintedCoreAction*>(action)))
         return 0.0f;
 
     // If any prior handler (including self) recently had the core, block other movement
     if (AnyRecentCoreInInventory(botAI, bot) &&
-        dynamic_cast<MovementAction*>(action) &&
+        action->HasCategory(ACTION_CATEGORY_MOVEMENT) &&
         !dynamic_cast<LadyVashjPassTheTaintedCoreAction*>(action))
         return 0.0f;
 
@@ -735,21 +720,19 @@ float LadyVashjDisableAutomaticTargetingAndMovementModifier::GetValue(Action *ac
     if (!vashj)
         return 1.0f;
 
-    if (dynamic_cast<AvoidAoeAction*>(action))
+    if (action->HasCategory(ACTION_CATEGORY_AVOID_AOE))
         return 0.0f;
 
     if (IsLadyVashjInPhase2(botAI))
     {
-        if (dynamic_cast<DpsAssistAction*>(action) ||
-            dynamic_cast<TankAssistAction*>(action) ||
-            dynamic_cast<FleeAction*>(action))
+        if (action->HasCategory(ACTION_CATEGORY_DPS_ASSIST | ACTION_CATEGORY_TANK_ASSIST | ACTION_CATEGORY_FLEE))
             return 0.0f;
 
         if (bot->GetExactDist2d(vashj) < 60.0f &&
-            dynamic_cast<FollowAction*>(action))
+            action->HasCategory(ACTION_CATEGORY_FOLLOW))
             return 0.0f;
 
-        if (!botAI->IsHeal(bot) && dynamic_cast<CastHealingSpellAction*>(action))
+        if (!botAI->IsHeal(bot) && action->HasCategory(ACTION_CATEGORY_HEAL))
             return 0.0f;
 
         Unit* enchanted = AI_VALUE2(Unit*, "find target", "enchanted elemental");
@@ -760,8 +743,7 @@ float LadyVashjDisableAutomaticTargetingAndMovementModifier::GetValue(Action *ac
 
     if (IsLadyVashjInPhase3(botAI))
     {
-        if (dynamic_cast<DpsAssistAction*>(action) ||
-            dynamic_cast<TankAssistAction*>(action))
+        if (action->HasCategory(ACTION_CATEGORY_DPS_ASSIST | ACTION_CATEGORY_TANK_ASSIST))
             return 0.0f;
 
         Unit* enchanted = AI_VALUE2(Unit*, "find target", "enchanted elemental");
@@ -769,15 +751,14 @@ float LadyVashjDisableAutomaticTargetingAndMovementModifier::GetValue(Action *ac
         Unit* elite = AI_VALUE2(Unit*, "find target", "coilfang elite");
         if (enchanted || strider || elite)
         {
-            if (dynamic_cast<FollowAction*>(action) ||
-                dynamic_cast<FleeAction*>(action))
+            if (action->HasCategory(ACTION_CATEGORY_FOLLOW | ACTION_CATEGORY_FLEE))
                 return 0.0f;
 
             if (enchanted && AI_VALUE(Unit*, "current target") == enchanted &&
                 dynamic_cast<CastDebuffSpellOnAttackerAction*>(action))
                 return 0.0f;
         }
-        else if (dynamic_cast<CombatFormationMoveAction*>(action))
+        else if (action->HasCategory(ACTION_CATEGORY_COMBAT_FORMATION_MOVE))
             return 0.0f;
     }
 
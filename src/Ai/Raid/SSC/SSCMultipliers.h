@@ -67,7 +67,7 @@ class TheLurkerBelowDisableTankAssistMultiplier : public Multiplier
 {
 public:
     TheLurkerBelowDisableTankAssistMultiplier(
-        PlayerbotAI* botAI) : Multiplier(botAI, "the lurker below disable tank assist") {}
+        PlayerbotAI* botAI) : Multiplier(botAI, "the lurker below disable tank assist", ACTION_CATEGORY_TANK_ASSIST) {}
     virtual float GetValue(Action* action);
 };
 
@@ -159,7 +159,8 @@ class FathomLordKarathressCaribdisTankHealerMaintainPositionMultiplier : public
 {
 public:
     FathomLordKarathressCaribdisTankHealerMaintainPositionMultiplier(
-        PlayerbotAI* botAI) : Multiplier(botAI, "fathom-lord karathress caribdis tank healer maintain position") {}
+        PlayerbotAI* botAI) : Multiplier(botAI, "fathom-lord karathress caribdis tank healer maintain position",
+            ACTION_CATEGORY_FLEE | ACTION_CATEGORY_FOLLOW) {}
     virtual float GetValue(Action* action);
 };
 
@@ -177,7 +178,8 @@ class MorogrimTidewalkerDisableTankActionsMultiplier : public Multiplier
 {
 public:
     MorogrimTidewalkerDisableTankActionsMultiplier(
-        PlayerbotAI* botAI) : Multiplier(botAI, "morogrim tidewalker disable tank actions") {}
+        PlayerbotAI* botAI) : Multiplier(botAI, "morogrim tidewalker disable tank actions",
+            ACTION_CATEGORY_COMBAT_FORMATION_MOVE) {}
     virtual float GetValue(Action* action);
 };
 
@@ -31,7 +31,7 @@ class AlarDisableTankAssistMultiplier : public Multiplier
 {
 public:
     AlarDisableTankAssistMultiplier(
-        PlayerbotAI* botAI) : Multiplier(botAI, "al'ar disable tank assist multiplier") {}
+        PlayerbotAI* botAI) : Multiplier(botAI, "al'ar disable tank assist multiplier", ACTION_CATEGORY_TANK_ASSIST) {}
     virtual float GetValue(Action* action);
 };
 
@@ -47,7 +47,8 @@ class AlarPhase2NoTankingIfArmorMeltedMultiplier : public Multiplier
 {
 public:
     AlarPhase2NoTankingIfArmorMeltedMultiplier(
-        PlayerbotAI* botAI) : Multiplier(botAI, "al'ar phase 2 no tanking if armor melted multiplier") {}
+        PlayerbotAI* botAI) : Multiplier(botAI, "al'ar phase 2 no tanking if armor melted multiplier",
+            ACTION_CATEGORY_TAUNT) {}
     virtual float GetValue(Action* action);
 };
 
@@ -67,7 +68,8 @@ class HighAstromancerSolarianDisableTankAssistMultiplier : public Multiplier
 {
 public:
     HighAstromancerSolarianDisableTankAssistMultiplier(
-        PlayerbotAI* botAI) : Multiplier(botAI, "high astromancer solarian disable tank assist multiplier") {}
+        PlayerbotAI* botAI) : Multiplier(botAI, "high astromancer solarian disable tank assist multiplier",
+            ACTION_CATEGORY_TANK_ASSIST) {}
     virtual float GetValue(Action* action);
 };
 
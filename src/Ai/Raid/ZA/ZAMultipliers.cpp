@@ -33,7 +33,7 @@ float AkilzonDisableCombatFormationMoveMultiplier::GetValue(Action* action)
     if (!AI_VALUE2(Unit*, "find target", "akil'zon"))
         return 1.0f;
 
-    if (dynamic_cast<CombatFormationMoveAction*>(action) &&
+    if (action->HasCategory(ACTION_CATEGORY_COMBAT_FORMATION_MOVE) &&
         !dynamic_cast<SetBehindTargetAction*>(action))
         return 0.0f;
 
@@ -51,14 +51,12 @@ float AkilzonStayInEyeOfTheStormMultiplier::GetValue(Action* action)
         !IsInStormWindow(it->second, std::time(nullptr)))
         return 1.0f;
 
-    if (dynamic_cast<CastReachTargetSpellAction*>(action) ||
+    if (action->HasCategory(ACTION_CATEGORY_REACH_SPELL) ||
         dynamic_cast<CastKillingSpreeAction*>(action) ||
         dynamic_cast<CastBlinkBackAction*>(action) ||
         dynamic_cast<CastDisengageAction*>(action) ||
         dynamic_cast<SetBehindTargetAction*>(action) ||
-        dynamic_cast<FleeAction*>(action) ||
-        dynamic_cast<FollowAction*>(action) ||
-        dynamic_cast<ReachTargetAction*>(action))
+        action->HasCategory(ACTION_CATEGORY_FLEE | ACTION_CATEGORY_FOLLOW | ACTION_CATEGORY_REACH_TARGET))
         return 0.0f;
 
     return 1.0f;
@@ -92,11 +90,7 @@ float NalorakkDisableTankActionsMultiplier::GetValue(Action* action)
         shouldTankBoss = true;
 
     if (!shouldTankBoss &&
-        (dynamic_cast<TankAssistAction*>(action) ||
-         dynamic_cast<CastTauntAction*>(action) ||
-         dynamic_cast<CastGrowlAction*>(action) ||
-         dynamic_cast<CastHandOfReckoningAction*>(action) ||
-         dynamic_cast<CastDarkCommandAction*>(action)))
+        (action->HasCategory(ACTION_CATEGORY_TANK_ASSIST | ACTION_CATEGORY_TAUNT)))
         return 0.0f;
 
     return 1.0f;
@@ -129,13 +123,13 @@ float JanalaiDisableTankActionsMultiplier::GetValue(Action* action)
         return 1.0f;
 
     if (botAI->IsMainTank(bot) &&
-        dynamic_cast<TankAssistAction*>(action))
+        action->HasCategory(ACTION_CATEGORY_TANK_ASSIST))
         return 0.0f;
 
     if (botAI->IsAssistTank(bot) &&
         !GetFirstAliveUnitByEntry(
             botAI, static_cast<uint32>(ZulAmanNPCs::NPC_AMANI_DRAGONHAWK_HATCHLING)) &&
-        dynamic_cast<TankAssistAction*>(action))
+        action->HasCategory(ACTION_CATEGORY_TANK_ASSIST))
         return 0.0f;
 
     return 1.0f;
@@ -146,7 +140,7 @@ float JanalaiDisableCombatFormationMoveMultiplier::GetValue(Action* action)
     if (!AI_VALUE2(Unit*, "find target", "jan'alai"))
         return 1.0f;
 
-    if (dynamic_cast<CombatFormationMoveAction*>(action) &&
+    if (action->HasCategory(ACTION_CATEGORY_COMBAT_FORMATION_MOVE) &&
         !dynamic_cast<SetBehindTargetAction*>(action))
         return 0.0f;
 
@@ -161,13 +155,11 @@ float JanalaiStayAwayFromFireBombsMultiplier::GetValue(Action* action)
     if (!HasFireBombNearby(bot))
         return 1.0f;
 
-    if (dynamic_cast<CastReachTargetSpellAction*>(action) ||
+    if (action->HasCategory(ACTION_CATEGORY_REACH_SPELL) ||
         dynamic_cast<CastKillingSpreeAction*>(action) ||
         dynamic_cast<CastBlinkBackAction*>(action) ||
         dynamic_cast<CastDisengageAction*>(action) ||
-        dynamic_cast<FleeAction*>(action) ||
-        dynamic_cast<FollowAction*>(action) ||
-        dynamic_cast<ReachTargetAction*>(action))
+        action->HasCategory(ACTION_CATEGORY_FLEE | ACTION_CATEGORY_FOLLOW | ACTION_CATEGORY_REACH_TARGET))
         return 0.0f;
 
     return 1.0f;
@@ -215,7 +207,7 @@ float HalazziDisableTankActionsMultiplier::GetValue(Action* action)
         return 0.0f;
 
     if (bot->GetVictim() != nullptr &&
-        dynamic_cast<TankAssistAction*>(action))
+        action->HasCategory(ACTION_CATEGORY_TANK_ASSIST))
         return 0.0f;
 
     return 1.0f;
@@ -245,9 +237,9 @@ float HexLordMalacrassAvoidWhirlwindMultiplier::GetValue(Action* action)
         !malacrass->HasAura(static_cast<uint32>(ZulAmanSpells::SPELL_HEX_LORD_WHIRLWIND)))
         return 1.0f;
 
-    if (dynamic_cast<CastReachTargetSpellAction*>(action) ||
+    if (action->HasCategory(ACTION_CATEGORY_REACH_SPELL) ||
         dynamic_cast<CastKillingSpreeAction*>(action) ||
-        dynamic_cast<ReachTargetAction*>(action))
+        action->HasCategory(ACTION_CATEGORY_REACH_TARGET))
         return 0.0f;
 
     return 1.0f;
@@ -344,9 +336,9 @@ float ZuljinAvoidWhirlwindMultiplier::GetValue(Action* action)
         !zuljin->HasAura(static_cast<uint32>(ZulAmanSpells::SPELL_ZULJIN_WHIRLWIND)))
         return 1.0f;
 
-    if (dynamic_cast<CastReachTargetSpellAction*>(action) ||
+    if (action->HasCategory(ACTION_CATEGORY_REACH_SPELL) ||
         dynamic_cast<CastKillingSpreeAction*>(action) ||
-        dynamic_cast<ReachTargetAction*>(action))
+        action->HasCategory(ACTION_CATEGORY_REACH_TARGET))
         return 0.0f;
 
     return 1.0f;
@@ -359,7 +351,7 @@ float ZuljinDisableAvoidAoeMultiplier::GetValue(Action* action)
         !zuljin->HasAura(static_cast<uint32>(ZulAmanSpells::SPELL_SHAPE_OF_THE_EAGLE)))
         return 1.0f;
 
-    if (dynamic_cast<AvoidAoeAction*>(action))
+    if (action->HasCategory(ACTION_CATEGORY_AVOID_AOE))
         return 0.0f;
 
     return 1.0f;
@@ -153,7 +153,7 @@ class ZuljinDisableAvoidAoeMultiplier : public Multiplier
 {
 public:
     ZuljinDisableAvoidAoeMultiplier(PlayerbotAI* botAI) : Multiplier(
-        botAI, "zul'jin disable avoid aoe") {}
+        botAI, "zul'jin disable avoid aoe", ACTION_CATEGORY_AVOID_AOE) {}
     virtual float GetValue(Action* action);
 };
 
@@ -6,299 +6,472 @@
 
 #include "PerfMonitor.h"
 
+#include <bit>
+#include <cmath>
+#include <memory>
+
 #include "Playerbots.h"
 
-PerfMonitorOperation* PerfMonitor::start(PerformanceMetric metric, std::string const name,
-                                                       PerformanceStack* stack)
+// Series recorded by one thread. The owning thread looks series up without locking; inserts and
+// reads from other threads (merge, reset) take the shard lock.
+class PerfMonitorShard
+{
+public:
+    PerformanceData* Find(uint64 key)
+    {
+        auto itr = data.find(key);
+        return itr != data.end() ? itr->second.get() : nullptr;
+    }
+
+    PerformanceData* Insert(uint64 key)
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        std::unique_ptr<PerformanceData>& pd = data[key];
+        if (!pd)
+            pd = std::make_unique<PerformanceData>();
+
+        return pd.get();
+    }
+
+    std::mutex lock;
+    std::unordered_map<uint64, std::unique_ptr<PerformanceData>> data;
+};
+
+namespace
+{
+    thread_local PerfMonitorShard* localShard = nullptr;
+    thread_local std::vector<std::unique_ptr<PerfMonitorOperation>> freeOperations;
+
+    uint64 MixKey(uint64 key, uint64 value)
+    {
+        return key ^ (value + 0x9e3779b97f4a7c15ULL + (key << 6) + (key >> 2));
+    }
+}
+
+void PerformanceData::Add(uint64_t elapsed)
+{
+    // Read-modify-write steps so a Reset from another thread is never undone by a stale value.
+    if (elapsed > 0)
+    {
+        uint64_t min = minTime.load(std::memory_order_relaxed);
+        while ((!min || min > elapsed) && !minTime.compare_exchange_weak(min, elapsed, std::memory_order_relaxed))
+        {
+        }
+
+        uint64_t max = maxTime.load(std::memory_order_relaxed);
+        while (max < elapsed && !maxTime.compare_exchange_weak(max, elapsed, std::memory_order_relaxed))
+        {
+        }
+
+        totalTime.fetch_add(elapsed, std::memory_order_relaxed);
+    }
+
+    count.fetch_add(1, std::memory_order_relaxed);
+    buckets[GetBucket(elapsed)].fetch_add(1, std::memory_order_relaxed);
+}
+
+void PerformanceData::Clear()
+{
+    minTime = 0;
+    maxTime = 0;
+    totalTime = 0;
+    count = 0;
+    for (std::atomic<uint32_t>& bucket : buckets)
+        bucket = 0;
+}
+
+uint32_t PerformanceData::GetBucket(uint64_t elapsed)
+{
+    if (elapsed < 4)
+        return elapsed;
+
+    uint32_t const msb = std::bit_width(elapsed) - 1;
+    uint32_t const bucket = 4 * (msb - 1) + ((elapsed >> (msb - 2)) & 3);
+    return std::min(bucket, BUCKETS - 1);
+}
+
+uint64_t PerformanceData::GetBucketLimit(uint32_t bucket)
+{
+    if (bucket < 4)
+        return bucket;
+
+    uint32_t const shift = bucket / 4 - 1;
+    return ((uint64_t(4 + bucket % 4) + 1) << shift) - 1;
+}
+
+uint64_t PerformanceCounter::get() const
+{
+    uint64_t value = 0;
+    for (Shard const& shard : shards)
+        value += shard.value.load(std::memory_order_relaxed);
+
+    return value;
+}
+
+void PerformanceCounter::reset()
+{
+    for (Shard& shard : shards)
+        shard.value = 0;
+}
+
+uint64_t PerfMonitor::PerformanceTotals::GetPercentile(float percentile) const
+{
+    uint64_t const target = std::max<uint64_t>(1, std::ceil(count * percentile));
+    uint64_t seen = 0;
+    for (uint32 i = 0; i < PerformanceData::BUCKETS; ++i)
+    {
+        seen += buckets[i];
+        if (seen >= target)
+            return std::min(PerformanceData::GetBucketLimit(i), maxTime);
+    }
+
+    return maxTime;
+}
+
+PerfMonitorShard* PerfMonitor::GetLocalShard()
+{
+    if (!localShard)
+    {
+        // Shards outlive their thread so timings of finished threads still show up in the stats.
+        localShard = new PerfMonitorShard();
+
+        std::lock_guard<std::mutex> guard(lock);
+        shards.push_back(localShard);
+    }
+
+    return localShard;
+}
+
+void PerfMonitor::RegisterSeries(uint64_t key, PerformanceMetric metric, SymbolId nameId,
+                                 std::string_view const name, PerformanceStack const* stack)
+{
+    std::lock_guard<std::mutex> guard(lock);
+    names.emplace(nameId, std::string(name));
+
+    if (series.find(key) != series.end())
+        return;
+
+    std::string stackName(name);
+    if (stack && !stack->empty())
+    {
+        std::ostringstream out;
+        out << stackName << " [";
+
+        for (PerformanceStack::const_reverse_iterator i = stack->rbegin(); i != stack->rend(); ++i)
+            out << names[*i] << (std::next(i) == stack->rend() ? "" : "|");
+
+        out << "]";
+
+        stackName = out.str();
+    }
+
+    series.emplace(key, SeriesInfo{metric, stackName});
+}
+
+PerfMonitorOperation* PerfMonitor::start(PerformanceMetric metric, std::string_view const name,
+                                         PerformanceStack* stack)
 {
     if (!sPlayerbotAIConfig.perfMonEnabled)
         return nullptr;
 
-    std::string stackName = name;
+    SymbolId const nameId = SymbolTable::GetId(name);
+    uint64 key = MixKey(nameId, metric);
+    if (stack)
+    {
+        for (SymbolId id : *stack)
+            key = MixKey(key, id);
+    }
+
+    PerfMonitorShard* shard = GetLocalShard();
+    PerformanceData* pd = shard->Find(key);
+    if (!pd)
+    {
+        RegisterSeries(key, metric, nameId, name, stack);
+        pd = shard->Insert(key);
+    }
 
     if (stack)
+        stack->push_back(nameId);
+
+    PerfMonitorOperation* operation;
+    if (freeOperations.empty())
+        operation = new PerfMonitorOperation();
+    else
     {
-        if (!stack->empty())
-        {
-            std::ostringstream out;
-            out << stackName << " [";
+        operation = freeOperations.back().release();
+        freeOperations.pop_back();
+    }
 
-            for (std::vector<std::string>::reverse_iterator i = stack->rbegin(); i != stack->rend(); ++i)
-                out << *i << (std::next(i) == stack->rend() ? "" : "|");
+    operation->shard = shard;
+    operation->data = pd;
+    operation->key = key;
+    operation->nameId = nameId;
+    operation->stack = stack;
+    operation->started = std::chrono::steady_clock::now();
 
-            out << "]";
+    return operation;
+}
 
-            stackName = out.str().c_str();
-        }
+PerformanceCounter* PerfMonitor::GetCounter(std::string const name)
+{
+    std::lock_guard<std::mutex> guard(lock);
+    PerformanceCounter*& counter = counters[name];
+    if (!counter)
+        counter = new PerformanceCounter();
+
+    return counter;
+}
+
+std::map<PerformanceMetric, std::map<std::string, PerfMonitor::PerformanceTotals>> PerfMonitor::MergeShards()
+{
+    std::map<PerformanceMetric, std::map<std::string, PerformanceTotals>> merged;
 
-        stack->push_back(name);
+    std::lock_guard<std::mutex> guard(lock);
+    for (PerfMonitorShard* shard : shards)
+    {
+        std::lock_guard<std::mutex> shardGuard(shard->lock);
+        for (auto const& [key, pd] : shard->data)
+        {
+            uint32 const count = pd->count.load(std::memory_order_relaxed);
+            auto info = series.find(key);
+            if (!count || info == series.end())
+                continue;
+
+            PerformanceTotals& totals = merged[info->second.metric][info->second.name];
+            uint64_t const minTime = pd->minTime.load(std::memory_order_relaxed);
+            if (minTime && (!totals.minTime || totals.minTime > minTime))
+                totals.minTime = minTime;
+
+            totals.maxTime = std::max(totals.maxTime, pd->maxTime.load(std::memory_order_relaxed));
+            totals.totalTime += pd->totalTime.load(std::memory_order_relaxed);
+            totals.count += count;
+            for (uint32 i = 0; i < PerformanceData::BUCKETS; ++i)
+                totals.buckets[i] += pd->buckets[i].load(std::memory_order_relaxed);
+        }
     }
 
+    return merged;
+}
+
+void PerfMonitor::PrintCounters()
+{
     std::lock_guard<std::mutex> guard(lock);
-    PerformanceData* pd = data[metric][stackName];
-    if (!pd)
+    if (counters.empty())
+        return;
+
+    LOG_INFO(
+        "playerbots",
+        "---------------------------------------[COUNTERS]------------------------------------------------------");
+
+    for (auto const& counter : counters)
+        LOG_INFO("playerbots", "{:>20} : {}", counter.second->get(), counter.first);
+
+    // "<name> hit" with a matching "<name> miss" counter also gets a hit rate line.
+    for (auto const& counter : counters)
     {
-        pd = new PerformanceData();
-        pd->minTime = 0;
-        pd->maxTime = 0;
-        pd->totalTime = 0;
-        pd->count = 0;
-        data[metric][stackName] = pd;
+        std::string const& name = counter.first;
+        if (name.size() < 4 || name.compare(name.size() - 4, 4, " hit"))
+            continue;
+
+        auto misses = counters.find(name.substr(0, name.size() - 4) + " miss");
+        if (misses == counters.end())
+            continue;
+
+        uint64_t hitCount = counter.second->get();
+        uint64_t total = hitCount + misses->second->get();
+        if (total)
+            LOG_INFO("playerbots", "{:>19.1f}% : {} rate", hitCount * 100.0 / total, name);
     }
 
-    return new PerfMonitorOperation(pd, name, stack);
+    LOG_INFO("playerbots", " ");
 }
 
 void PerfMonitor::PrintStats(bool perTick, bool fullStack)
 {
+    PrintCounters();
+
+    std::map<PerformanceMetric, std::map<std::string, PerformanceTotals>> data = MergeShards();
     if (data.empty())
         return;
 
+    float tickCount = 1.0f;
+    float referenceTime = 0;
     if (!perTick)
     {
-        float updateAITotalTime = 0;
         for (auto& map : data[PERF_MON_TOTAL])
             if (map.first.find("PlayerbotAI::UpdateAIInternal") != std::string::npos)
-                updateAITotalTime += map.second->totalTime;
+                referenceTime += map.second.totalTime;
 
         LOG_INFO(
             "playerbots",
             "--------------------------------------[TOTAL BOT]------------------------------------------------------");
-        LOG_INFO("playerbots",
-                 "percentage     time  |     min ..     max (      avg  of      count) - type      : name");
-        LOG_INFO(
-            "playerbots",
-            "-------------------------------------------------------------------------------------------------------");
-
-        for (std::map<PerformanceMetric, std::map<std::string, PerformanceData*>>::iterator i = data.begin();
-             i != data.end(); ++i)
-        {
-            std::map<std::string, PerformanceData*> pdMap = i->second;
-
-            std::string key;
-            switch (i->first)
-            {
-                case PERF_MON_TRIGGER:
-                    key = "Trigger";
-                    break;
-                case PERF_MON_VALUE:
-                    key = "Value";
-                    break;
-                case PERF_MON_ACTION:
-                    key = "Action";
-                    break;
-                case PERF_MON_RNDBOT:
-                    key = "RndBot";
-                    break;
-                case PERF_MON_TOTAL:
-                    key = "Total";
-                    break;
-                default:
-                    key = "?";
-                    break;
-            }
-
-            std::vector<std::string> names;
-
-            for (std::map<std::string, PerformanceData*>::iterator j = pdMap.begin(); j != pdMap.end(); ++j)
-            {
-                if (key == "Total" && j->first.find("PlayerbotAI::UpdateAIInternal") == std::string::npos)
-                    continue;
-
-                names.push_back(j->first);
-            }
-
-            std::sort(names.begin(), names.end(),
-                      [pdMap](std::string const i, std::string const j)
-                      { return pdMap.at(i)->totalTime < pdMap.at(j)->totalTime; });
-
-            uint64 typeTotalTime = 0;
-            uint64 typeMinTime = 0xffffffffu;
-            uint64 typeMaxTime = 0;
-            uint32 typeCount = 0;
-            for (auto& name : names)
-            {
-                PerformanceData* pd = pdMap[name];
-                typeTotalTime += pd->totalTime;
-                typeCount += pd->count;
-                if (typeMinTime > pd->minTime)
-                    typeMinTime = pd->minTime;
-                if (typeMaxTime < pd->maxTime)
-                    typeMaxTime = pd->maxTime;
-                float perc = (float)pd->totalTime / updateAITotalTime * 100.0f;
-                float time = (float)pd->totalTime / 1000000.0f;
-                float minTime = (float)pd->minTime / 1000.0f;
-                float maxTime = (float)pd->maxTime / 1000.0f;
-                float avg = (float)pd->totalTime / (float)pd->count / 1000.0f;
-                std::string disName = name;
-                if (!fullStack && disName.find("|") != std::string::npos)
-                    disName = disName.substr(0, disName.find("|")) + "]";
-
-                if (perc >= 0.1f || avg >= 0.25f || pd->maxTime > 1000)
-                {
-                    LOG_INFO("playerbots",
-                             "{:7.3f}% {:10.3f}s | {:7.1f} .. {:7.1f} ({:10.3f} of {:10d}) - {:6}    : {}", perc, time,
-                             minTime, maxTime, avg, pd->count, key.c_str(), disName.c_str());
-                }
-            }
-            float tPerc = (float)typeTotalTime / (float)updateAITotalTime * 100.0f;
-            float tTime = (float)typeTotalTime / 1000000.0f;
-            float tMinTime = (float)typeMinTime / 1000.0f;
-            float tMaxTime = (float)typeMaxTime / 1000.0f;
-            float tAvg = (float)typeTotalTime / (float)typeCount / 1000.0f;
-            LOG_INFO("playerbots", "{:7.3f}% {:10.3f}s | {:7.1f} .. {:7.1f} ({:10.3f} of {:10d}) - {:6}    : {}", tPerc,
-                     tTime, tMinTime, tMaxTime, tAvg, typeCount, key.c_str(), "Total");
-            LOG_INFO("playerbots", " ");
-        }
     }
     else
     {
-        float fullTickCount = data[PERF_MON_TOTAL]["PlayerbotAIBase::FullTick"]->count;
-        float fullTickTotalTime = data[PERF_MON_TOTAL]["PlayerbotAIBase::FullTick"]->totalTime;
+        auto fullTick = data[PERF_MON_TOTAL].find("PlayerbotAIBase::FullTick");
+        if (fullTick == data[PERF_MON_TOTAL].end())
+        {
+            LOG_INFO("playerbots", "No full bot ticks recorded yet");
+            return;
+        }
+
+        tickCount = fullTick->second.count;
+        referenceTime = fullTick->second.totalTime;
 
         LOG_INFO(
             "playerbots",
             "---------------------------------------[PER TICK]------------------------------------------------------");
-        LOG_INFO("playerbots",
-                 "percentage     time  |     min ..     max (      avg  of      count) - type      : name");
-        LOG_INFO(
-            "playerbots",
-            "-------------------------------------------------------------------------------------------------------");
+    }
+
+    LOG_INFO("playerbots",
+             "percentage     time  |     min ..     max (      avg  of      count) |     p50     p95     p99"
+             " - type      : name");
+    LOG_INFO(
+        "playerbots",
+        "-------------------------------------------------------------------------------------------------------");
+
+    for (auto& [metric, pdMap] : data)
+    {
+        std::string key;
+        switch (metric)
+        {
+            case PERF_MON_TRIGGER:
+                key = "Trigger";
+                break;
+            case PERF_MON_VALUE:
+                key = "Value";
+                break;
+            case PERF_MON_ACTION:
+                key = "Action";
+                break;
+            case PERF_MON_RNDBOT:
+                key = "RndBot";
+                break;
+            case PERF_MON_TOTAL:
+                key = "Total";
+                break;
+            default:
+                key = "?";
+                break;
+        }
+
+        std::vector<std::string> names;
 
-        for (std::map<PerformanceMetric, std::map<std::string, PerformanceData*>>::iterator i = data.begin();
-             i != data.end(); ++i)
+        for (auto const& entry : pdMap)
         {
-            std::map<std::string, PerformanceData*> pdMap = i->second;
-
-            std::string key;
-            switch (i->first)
-            {
-                case PERF_MON_TRIGGER:
-                    key = "Trigger";
-                    break;
-                case PERF_MON_VALUE:
-                    key = "Value";
-                    break;
-                case PERF_MON_ACTION:
-                    key = "Action";
-                    break;
-                case PERF_MON_RNDBOT:
-                    key = "RndBot";
-                    break;
-                case PERF_MON_TOTAL:
-                    key = "Total";
-                    break;
-                default:
-                    key = "?";
-            }
-
-            std::vector<std::string> names;
-
-            for (std::map<std::string, PerformanceData*>::iterator j = pdMap.begin(); j != pdMap.end(); ++j)
-            {
-                names.push_back(j->first);
-            }
-
-            std::sort(names.begin(), names.end(),
-                      [pdMap](std::string const i, std::string const j)
-                      { return pdMap.at(i)->totalTime < pdMap.at(j)->totalTime; });
-
-            uint64 typeTotalTime = 0;
-            uint64 typeMinTime = 0xffffffffu;
-            uint64 typeMaxTime = 0;
-            uint32 typeCount = 0;
-            for (auto& name : names)
-            {
-                PerformanceData* pd = pdMap[name];
-                typeTotalTime += pd->totalTime;
-                typeCount += pd->count;
-                if (typeMinTime > pd->minTime)
-                    typeMinTime = pd->minTime;
-                if (typeMaxTime < pd->maxTime)
-                    typeMaxTime = pd->maxTime;
-                float perc = (float)pd->totalTime / fullTickTotalTime * 100.0f;
-                float time = (float)pd->totalTime / fullTickCount / 1000.0f;
-                float minTime = (float)pd->minTime / 1000.0f;
-                float maxTime = (float)pd->maxTime / 1000.0f;
-                float avg = (float)pd->totalTime / (float)pd->count / 1000.0f;
-                float amount = (float)pd->count / fullTickCount;
-                std::string disName = name;
-                if (!fullStack && disName.find("|") != std::string::npos)
-                    disName = disName.substr(0, disName.find("|")) + "]";
-                if (perc >= 0.1f || avg >= 0.25f || pd->maxTime > 1000)
-                {
-                    LOG_INFO("playerbots",
-                             "{:7.3f}% {:9.3f}ms | {:7.1f} .. {:7.1f} ({:10.3f} of {:10.2f}) - {:6}    : {}", perc,
-                             time, minTime, maxTime, avg, amount, key.c_str(), disName.c_str());
-                }
-            }
-            if (i->first != PERF_MON_TOTAL)
-            {
-                float tPerc = (float)typeTotalTime / (float)fullTickTotalTime * 100.0f;
-                float tTime = (float)typeTotalTime / fullTickCount / 1000.0f;
-                float tMinTime = (float)typeMinTime / 1000.0f;
-                float tMaxTime = (float)typeMaxTime / 1000.0f;
-                float tAvg = (float)typeTotalTime / (float)typeCount / 1000.0f;
-                float tAmount = (float)typeCount / fullTickCount;
-                LOG_INFO("playerbots", "{:7.3f}% {:9.3f}ms | {:7.1f} .. {:7.1f} ({:10.3f} of {:10.2f}) - {:6}    : {}",
-                         tPerc, tTime, tMinTime, tMaxTime, tAvg, tAmount, key.c_str(), "Total");
-            }
-            LOG_INFO("playerbots", " ");
+            if (!perTick && key == "Total" && entry.first.find("PlayerbotAI::UpdateAIInternal") == std::string::npos)
+                continue;
+
+            names.push_back(entry.first);
         }
+
+        std::sort(names.begin(), names.end(), [&pdMap](std::string const& i, std::string const& j)
+                  { return pdMap.at(i).totalTime < pdMap.at(j).totalTime; });
+
+        PerformanceTotals typeTotals;
+        for (auto& name : names)
+        {
+            PerformanceTotals const& pd = pdMap[name];
+            typeTotals.totalTime += pd.totalTime;
+            typeTotals.count += pd.count;
+            if (!typeTotals.minTime || typeTotals.minTime > pd.minTime)
+                typeTotals.minTime = pd.minTime;
+            if (typeTotals.maxTime < pd.maxTime)
+                typeTotals.maxTime = pd.maxTime;
+            for (uint32 i = 0; i < PerformanceData::BUCKETS; ++i)
+                typeTotals.buckets[i] += pd.buckets[i];
+
+            float perc = (float)pd.totalTime / referenceTime * 100.0f;
+            float avg = (float)pd.totalTime / (float)pd.count / 1000.0f;
+            std::string disName = name;
+            if (!fullStack && disName.find("|") != std::string::npos)
+                disName = disName.substr(0, disName.find("|")) + "]";
+
+            if (perc >= 0.1f || avg >= 0.25f || pd.maxTime > 1000)
+                PrintRow(pd, perc, avg, perTick, tickCount, key, disName);
+        }
+
+        if (!perTick || metric != PERF_MON_TOTAL)
+        {
+            float tPerc = (float)typeTotals.totalTime / referenceTime * 100.0f;
+            float tAvg = (float)typeTotals.totalTime / (float)typeTotals.count / 1000.0f;
+            PrintRow(typeTotals, tPerc, tAvg, perTick, tickCount, key, "Total");
+        }
+
+        LOG_INFO("playerbots", " ");
     }
 }
 
-void PerfMonitor::Reset()
+void PerfMonitor::PrintRow(PerformanceTotals const& pd, float perc, float avg, bool perTick, float tickCount,
+                           std::string const& key, std::string const& name)
 {
-    for (std::map<PerformanceMetric, std::map<std::string, PerformanceData*>>::iterator i = data.begin();
-         i != data.end(); ++i)
+    float minTime = (float)pd.minTime / 1000.0f;
+    float maxTime = (float)pd.maxTime / 1000.0f;
+    float p50 = (float)pd.GetPercentile(0.50f) / 1000.0f;
+    float p95 = (float)pd.GetPercentile(0.95f) / 1000.0f;
+    float p99 = (float)pd.GetPercentile(0.99f) / 1000.0f;
+
+    if (!perTick)
     {
-        std::map<std::string, PerformanceData*> pdMap = i->second;
-        for (std::map<std::string, PerformanceData*>::iterator j = pdMap.begin(); j != pdMap.end(); ++j)
-        {
-            PerformanceData* pd = j->second;
-            std::lock_guard<std::mutex> guard(pd->lock);
-            pd->minTime = 0;
-            pd->maxTime = 0;
-            pd->totalTime = 0;
-            pd->count = 0;
-        }
+        float time = (float)pd.totalTime / 1000000.0f;
+        LOG_INFO("playerbots",
+                 "{:7.3f}% {:10.3f}s | {:7.1f} .. {:7.1f} ({:10.3f} of {:10d}) | {:7.1f} {:7.1f} {:7.1f} - {:6}"
+                 "    : {}",
+                 perc, time, minTime, maxTime, avg, pd.count, p50, p95, p99, key, name);
+    }
+    else
+    {
+        float time = (float)pd.totalTime / tickCount / 1000.0f;
+        float amount = (float)pd.count / tickCount;
+        LOG_INFO("playerbots",
+                 "{:7.3f}% {:9.3f}ms | {:7.1f} .. {:7.1f} ({:10.3f} of {:10.2f}) | {:7.1f} {:7.1f} {:7.1f} - {:6}"
+                 "    : {}",
+                 perc, time, minTime, maxTime, avg, amount, p50, p95, p99, key, name);
     }
 }
 
-PerfMonitorOperation::PerfMonitorOperation(PerformanceData* data, std::string const name,
-                                                         PerformanceStack* stack)
-    : data(data), name(name), stack(stack)
+void PerfMonitor::Reset()
 {
-    started = (std::chrono::time_point_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now()))
-                  .time_since_epoch();
+    std::lock_guard<std::mutex> guard(lock);
+    for (auto& counter : counters)
+        counter.second->reset();
+
+    for (PerfMonitorShard* shard : shards)
+    {
+        std::lock_guard<std::mutex> shardGuard(shard->lock);
+        for (auto& entry : shard->data)
+            entry.second->Clear();
+    }
 }
 
 void PerfMonitorOperation::finish()
 {
-    std::chrono::microseconds finished =
-        (std::chrono::time_point_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now()))
-            .time_since_epoch();
-    uint64 elapsed = (finished - started).count();
+    uint64 elapsed =
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - started).count();
 
-    std::lock_guard<std::mutex> guard(data->lock);
-    if (elapsed > 0)
+    // An operation may end on another thread than it started on (a bot changing maps between ticks);
+    // it is then recorded in that thread's shard so every shard keeps a single writer.
+    PerfMonitorShard* current = sPerfMonitor.GetLocalShard();
+    if (current != shard)
     {
-        if (!data->minTime || data->minTime > elapsed)
-            data->minTime = elapsed;
-
-        if (!data->maxTime || data->maxTime < elapsed)
-            data->maxTime = elapsed;
-
-        data->totalTime += elapsed;
+        data = current->Find(key);
+        if (!data)
+            data = current->Insert(key);
     }
 
-    ++data->count;
+    data->Add(elapsed);
 
     if (stack)
     {
-        stack->erase(std::remove(stack->begin(), stack->end(), name), stack->end());
+        auto itr = std::find(stack->rbegin(), stack->rend(), nameId);
+        if (itr != stack->rend())
+            stack->erase(std::next(itr).base());
     }
 
-    delete this;
+    freeOperations.emplace_back(this);
+}
+
+PerfMonitorScope::PerfMonitorScope(PerformanceMetric metric, std::string_view const name, PerformanceStack* stack)
+    : operation(sPerfMonitor.start(metric, name, stack))
+{
 }
@@ -7,22 +7,70 @@
 #ifndef PLAYERBOTS_PERFMONITOR_H
 #define PLAYERBOTS_PERFMONITOR_H
 
+#include <array>
+#include <atomic>
 #include <chrono>
 #include <ctime>
 #include <map>
 #include <mutex>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 #include <cstdint>
 
-typedef std::vector<std::string> PerformanceStack;
+#include "SymbolTable.h"
 
+// Names of the operations currently running for a bot, innermost last.
+typedef std::vector<SymbolId> PerformanceStack;
+
+// Small per thread index used to spread writes over shards.
+inline uint32_t PerfMonitorThreadIndex()
+{
+    static std::atomic<uint32_t> next{0};
+    thread_local uint32_t const index = next.fetch_add(1, std::memory_order_relaxed);
+    return index;
+}
+
+// Timings of one operation name (and caller stack) recorded by one thread. Only the owning thread
+// adds samples, but Reset clears them from another thread, so every update is a single atomic
+// read-modify-write; a reset racing an Add can at most leave that one sample half counted.
 struct PerformanceData
 {
-    uint64_t minTime;
-    uint64_t maxTime;
-    uint64_t totalTime;
-    uint32_t count;
-    std::mutex lock;
+    // Four buckets per power of two microseconds, the last one also takes everything above ~16s.
+    static constexpr uint32_t BUCKETS = 96;
+
+    std::atomic<uint64_t> minTime{0};
+    std::atomic<uint64_t> maxTime{0};
+    std::atomic<uint64_t> totalTime{0};
+    std::atomic<uint32_t> count{0};
+    std::array<std::atomic<uint32_t>, BUCKETS> buckets{};
+
+    void Add(uint64_t elapsed);
+    void Clear();
+
+    static uint32_t GetBucket(uint64_t elapsed);
+    static uint64_t GetBucketLimit(uint32_t bucket);
+};
+
+// Named event counter (cache hits, skipped work, ...) printed alongside the timings.
+struct PerformanceCounter
+{
+    static constexpr uint32_t SHARDS = 16;
+
+    struct alignas(64) Shard
+    {
+        std::atomic<uint64_t> value{0};
+    };
+
+    std::array<Shard, SHARDS> shards;
+
+    void add(uint64_t amount = 1)
+    {
+        shards[PerfMonitorThreadIndex() % SHARDS].value.fetch_add(amount, std::memory_order_relaxed);
+    }
+
+    uint64_t get() const;
+    void reset();
 };
 
 enum PerformanceMetric
@@ -34,17 +82,23 @@ enum PerformanceMetric
     PERF_MON_TOTAL
 };
 
+class PerfMonitorShard;
+
+// A running timer. Operations come from a per thread pool, finish() hands them back.
 class PerfMonitorOperation
 {
 public:
-    PerfMonitorOperation(PerformanceData* data, std::string const name, PerformanceStack* stack);
     void finish();
 
 private:
+    friend class PerfMonitor;
+
+    PerfMonitorShard* shard;
     PerformanceData* data;
-    std::string const name;
+    uint64_t key;
+    SymbolId nameId;
     PerformanceStack* stack;
-    std::chrono::microseconds started;
+    std::chrono::steady_clock::time_point started;
 };
 
 class PerfMonitor
@@ -57,12 +111,34 @@ public:
         return instance;
     }
 
-    PerfMonitorOperation* start(PerformanceMetric metric, std::string const name,
-                                       PerformanceStack* stack = nullptr);
+    PerfMonitorOperation* start(PerformanceMetric metric, std::string_view const name,
+                                PerformanceStack* stack = nullptr);
+    // Returns the counter registered under name; the pointer stays valid for the lifetime of the server.
+    PerformanceCounter* GetCounter(std::string const name);
     void PrintStats(bool perTick = false, bool fullStack = false);
     void Reset();
 
 private:
+    friend class PerfMonitorOperation;
+
+    // Timings of one series summed over all thread shards.
+    struct PerformanceTotals
+    {
+        uint64_t minTime = 0;
+        uint64_t maxTime = 0;
+        uint64_t totalTime = 0;
+        uint64_t count = 0;
+        std::array<uint64_t, PerformanceData::BUCKETS> buckets{};
+
+        uint64_t GetPercentile(float percentile) const;
+    };
+
+    struct SeriesInfo
+    {
+        PerformanceMetric metric;
+        std::string name;
+    };
+
     PerfMonitor() = default;
     virtual ~PerfMonitor() = default;
 
@@ -72,10 +148,40 @@ private:
     PerfMonitor(PerfMonitor&&) = delete;
     PerfMonitor& operator=(PerfMonitor&&) = delete;
 
-    std::map<PerformanceMetric, std::map<std::string, PerformanceData*> > data;
+    PerfMonitorShard* GetLocalShard();
+    // Records the display name of a series the first time any thread sees it.
+    void RegisterSeries(uint64_t key, PerformanceMetric metric, SymbolId nameId, std::string_view const name,
+                        PerformanceStack const* stack);
+    std::map<PerformanceMetric, std::map<std::string, PerformanceTotals>> MergeShards();
+    void PrintCounters();
+    void PrintRow(PerformanceTotals const& pd, float perc, float avg, bool perTick, float tickCount,
+                  std::string const& key, std::string const& name);
+
+    std::vector<PerfMonitorShard*> shards;
+    std::unordered_map<uint64_t, SeriesInfo> series;
+    std::unordered_map<SymbolId, std::string> names;
+    std::map<std::string, PerformanceCounter*> counters;
     std::mutex lock;
 };
 
+// Times the enclosing scope, e.g. PerfMonitorScope pmo(PERF_MON_VALUE, name, &context->performanceStack).
+class PerfMonitorScope
+{
+public:
+    PerfMonitorScope(PerformanceMetric metric, std::string_view const name, PerformanceStack* stack = nullptr);
+    ~PerfMonitorScope()
+    {
+        if (operation)
+            operation->finish();
+    }
+
+    PerfMonitorScope(const PerfMonitorScope&) = delete;
+    PerfMonitorScope& operator=(const PerfMonitorScope&) = delete;
+
+private:
+    PerfMonitorOperation* operation;
+};
+
 #define sPerfMonitor PerfMonitor::instance()
 
 #endif
@@ -9,6 +9,7 @@
 
 #include "AiObject.h"
 #include "Event.h"
+#include "SymbolTable.h"
 #include "Value.h"
 
 class PlayerbotAI;
@@ -45,6 +46,30 @@ private:
     std::string name;
 };
 
+// What kind of action an action is, for multipliers to test instead of casting it to the class. Each bit is
+// set by the constructor of the class named next to it, so its subclasses carry it too and testing the bit
+// gives the same answer as a dynamic_cast to that class.
+enum ActionCategory : uint32
+{
+    ACTION_CATEGORY_NONE                  = 0x00000000,
+    ACTION_CATEGORY_MOVEMENT              = 0x00000001,  // MovementAction
+    ACTION_CATEGORY_COMBAT_FORMATION_MOVE = 0x00000002,  // CombatFormationMoveAction
+    ACTION_CATEGORY_FOLLOW                = 0x00000004,  // FollowAction
+    ACTION_CATEGORY_FLEE                  = 0x00000008,  // FleeAction
+    ACTION_CATEGORY_AVOID_AOE             = 0x00000010,  // AvoidAoeAction
+    ACTION_CATEGORY_REACH_TARGET          = 0x00000020,  // ReachTargetAction
+    ACTION_CATEGORY_ATTACK                = 0x00000040,  // AttackAction
+    ACTION_CATEGORY_DPS_AOE               = 0x00000080,  // DpsAoeAction
+    ACTION_CATEGORY_DPS_ASSIST            = 0x00000100,  // DpsAssistAction
+    ACTION_CATEGORY_TANK_ASSIST           = 0x00000200,  // TankAssistAction
+    ACTION_CATEGORY_SPELL                 = 0x00000400,  // CastSpellAction
+    ACTION_CATEGORY_REACH_SPELL           = 0x00000800,  // CastReachTargetSpellAction
+    ACTION_CATEGORY_HEAL                  = 0x00001000,  // CastHealingSpellAction
+    ACTION_CATEGORY_CROWD_CONTROL         = 0x00002000,  // CastCrowdControlSpellAction
+    // CastTauntAction (warrior and Drak'Tharon), CastDarkCommandAction, CastHandOfReckoningAction, CastGrowlAction
+    ACTION_CATEGORY_TAUNT                 = 0x00004000
+};
+
 class Action : public AiNamedObject
 {
 public:
@@ -93,10 +118,14 @@ public:
     void MakeVerbose() { verbose = true; }
     void setRelevance(uint32 relevance1) { relevance = relevance1; };
     virtual float getRelevance() { return relevance; }
+    uint32 GetCategories() const { return categories; }
+    // True when the action is of any of the ActionCategory bits in mask.
+    bool HasCategory(uint32 mask) const { return (categories & mask) != 0; }
 
 protected:
     bool verbose;
     float relevance = 0;
+    uint32 categories = ACTION_CATEGORY_NONE;
 };
 
 class ActionNode
@@ -109,6 +138,7 @@ public:
         std::vector<NextAction> continuers = {}
     ) :
     name(std::move(name)),
+    nameId(SymbolTable::GetId(this->name)),
     action(nullptr),
     continuers(continuers),
     alternatives(alternatives),
@@ -120,6 +150,7 @@ public:
     Action* getAction() { return action; }
     void setAction(Action* action) { this->action = action; }
     const std::string getName() { return name; }
+    SymbolId getNameId() const { return nameId; }
 
     std::vector<NextAction> getContinuers()
     {
@@ -136,6 +167,7 @@ public:
 
 private:
     const std::string name;
+    const SymbolId nameId;
     Action* action;
     std::vector<NextAction> continuers;
     std::vector<NextAction> alternatives;
@@ -149,8 +181,8 @@ public:
 
     virtual ~ActionBasket(void) {}
 
-    float getRelevance() { return relevance; }
-    ActionNode* getAction() { return action; }
+    float getRelevance() const { return relevance; }
+    ActionNode* getAction() const { return action; }
     Event getEvent() { return event; }
     bool isSkipPrerequisites() { return skipPrerequisites; }
     void AmendRelevance(float k) { relevance *= k; }
@@ -11,6 +11,8 @@
 #include "HunterAiObjectContext.h"
 #include "MageAiObjectContext.h"
 #include "PaladinAiObjectContext.h"
+#include "PerfMonitor.h"
+#include "PlayerbotAIConfig.h"
 #include "PriestAiObjectContext.h"
 #include "RogueAiObjectContext.h"
 #include "ShamanAiObjectContext.h"
@@ -57,6 +59,47 @@ void AiObjectContext::BuildSharedContexts()
     BuildSharedValueContexts(sharedValueContexts);
 }
 
+void AiObjectContext::BeginValueGeneration()
+{
+    if (!sPlayerbotAIConfig.tickValueCache)
+        return;
+
+    valueGeneration = ++lastValueGeneration;
+    if (!valueGeneration)
+        valueGeneration = ++lastValueGeneration;
+}
+
+void AiObjectContext::AdvanceValueGeneration()
+{
+    if (valueGeneration)
+        BeginValueGeneration();
+}
+
+void AiObjectContext::EndValueGeneration()
+{
+    valueGeneration = 0;
+
+    if (!valueCacheHits && !valueCacheMisses)
+        return;
+
+    static PerformanceCounter* hits = sPerfMonitor.GetCounter("Tick value cache hit");
+    static PerformanceCounter* misses = sPerfMonitor.GetCounter("Tick value cache miss");
+    hits->add(valueCacheHits);
+    misses->add(valueCacheMisses);
+    valueCacheHits = 0;
+    valueCacheMisses = 0;
+}
+
+void AiObjectContext::InvalidateValues(uint16 opcode)
+{
+    auto itr = valueDependencies.find(opcode);
+    if (itr == valueDependencies.end())
+        return;
+
+    for (UntypedValue* value : itr->second)
+        value->Invalidate();
+}
+
 std::vector<std::string> AiObjectContext::Save()
 {
     std::vector<std::string> result;
@@ -7,8 +7,10 @@
 #ifndef PLAYERBOTS_AIOBJECTCONTEXT_H
 #define PLAYERBOTS_AIOBJECTCONTEXT_H
 
+#include <charconv>
 #include <sstream>
 #include <string>
+#include <string_view>
 
 #include "Common.h"
 #include "DynamicObject.h"
@@ -42,24 +44,48 @@ public:
     virtual Action* GetAction(std::string const name);
     virtual UntypedValue* GetUntypedValue(std::string const name);
 
+    Action* GetAction(Symbol symbol) { return actionContexts.GetContextObject(symbol.id, symbol.name, botAI); }
+    UntypedValue* GetUntypedValue(Symbol symbol)
+    {
+        return valueContexts.GetContextObject(symbol.id, symbol.name, botAI);
+    }
+    UntypedValue* GetUntypedValue(std::string_view const name, std::string_view const qualifier)
+    {
+        return valueContexts.GetContextObject(SymbolTable::GetId(name), name, qualifier, botAI);
+    }
+
     template <class T>
     Value<T>* GetValue(std::string const name)
     {
         return dynamic_cast<Value<T>*>(GetUntypedValue(name));
     }
 
+    // Literal names are hashed in place instead of being copied into a std::string first.
+    template <class T, size_t N>
+    Value<T>* GetValue(char const (&name)[N])
+    {
+        std::string_view const view(name);
+        return GetValue<T>(Symbol(SymbolTable::GetId(view), view));
+    }
+
     template <class T>
-    Value<T>* GetValue(std::string const name, std::string const param)
+    Value<T>* GetValue(Symbol symbol)
     {
-        return GetValue<T>((std::string(name) + "::" + param));
+        return dynamic_cast<Value<T>*>(GetUntypedValue(symbol));
     }
 
     template <class T>
-    Value<T>* GetValue(std::string const name, int32 param)
+    Value<T>* GetValue(std::string_view const name, std::string_view const param)
     {
-        std::ostringstream out;
-        out << param;
-        return GetValue<T>(name, out.str());
+        return dynamic_cast<Value<T>*>(GetUntypedValue(name, param));
+    }
+
+    template <class T>
+    Value<T>* GetValue(std::string_view const name, int32 param)
+    {
+        char buffer[16];
+        std::to_chars_result result = std::to_chars(buffer, buffer + sizeof(buffer), param);
+        return GetValue<T>(name, std::string_view(buffer, result.ptr - buffer));
     }
 
     std::set<std::string> GetValues();
@@ -70,7 +96,19 @@ public:
     std::vector<std::string> Save();
     void Load(std::vector<std::string> data);
 
-    std::vector<std::string> performanceStack;
+    PerformanceStack performanceStack;
+
+    // Values without a check interval are calculated at most once per generation. The engine begins a
+    // generation at the start of each tick and after every executed action; outside a tick it is 0 and
+    // values calculate on every read.
+    void BeginValueGeneration();
+    void AdvanceValueGeneration();
+    void EndValueGeneration();
+    uint32 GetValueGeneration() const { return valueGeneration; }
+    void CountValueCache(bool hit) { hit ? ++valueCacheHits : ++valueCacheMisses; }
+
+    void AddValueDependency(uint16 opcode, UntypedValue* value) { valueDependencies[opcode].push_back(value); }
+    void InvalidateValues(uint16 opcode);
 
     static void BuildAllSharedContexts();
 
@@ -87,6 +125,12 @@ protected:
     NamedObjectContextList<UntypedValue> valueContexts;
 
 private:
+    uint32 valueGeneration = 0;
+    uint32 lastValueGeneration = 0;
+    uint32 valueCacheHits = 0;
+    uint32 valueCacheMisses = 0;
+    std::unordered_map<uint16, std::vector<UntypedValue*>> valueDependencies;
+
     static SharedNamedObjectContextList<Strategy> sharedStrategyContexts;
     static SharedNamedObjectContextList<Action> sharedActionContexts;
     static SharedNamedObjectContextList<Trigger> sharedTriggerContexts;
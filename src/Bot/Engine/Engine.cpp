@@ -74,6 +74,7 @@ ActionExecutionListeners::~ActionExecutionListeners()
 Engine::~Engine(void)
 {
     Reset();
+    DeleteRetiredActionNodes();
 
     // for (std::map<std::string, Strategy*>::iterator i = strategies.begin(); i != strategies.end(); i++)
     // {
@@ -91,13 +92,16 @@ void Engine::Reset()
 {
     strategyTypeMask = 0;
 
-    ActionNode* action = nullptr;
+    queue.Clear();
 
-    while ((action = queue.Pop()) != nullptr)
+    // Strategies may change from inside an action, so the node being executed must outlive this call.
+    for (auto& node : actionNodes)
     {
-        delete action;
+        retiredActionNodes.push_back(node.second);
     }
 
+    actionNodes.clear();
+
     for (TriggerNode* trigger : triggers)
     {
         delete trigger;
@@ -145,6 +149,9 @@ bool Engine::DoNextAction(Unit* /*unit*/, uint32 /*depth*/, bool minimal)
 {
     LogAction("--- AI Tick ---");
 
+    DeleteRetiredActionNodes();
+    aiObjectContext->BeginValueGeneration();
+
     if (sPlayerbotAIConfig.logValuesPerTick)
         LogValues();
 
@@ -172,7 +179,7 @@ bool Engine::DoNextAction(Unit* /*unit*/, uint32 /*depth*/, bool minimal)
             continue;
 
         Event event = basket->getEvent();
-        ActionNode* actionNode = queue.Pop();  // NOTE: Pop() deletes basket
+        ActionNode* actionNode = queue.Pop();  // NOTE: Pop() invalidates basket
         Action* action = InitializeAction(actionNode);
 
         if (!action)
@@ -184,6 +191,9 @@ bool Engine::DoNextAction(Unit* /*unit*/, uint32 /*depth*/, bool minimal)
             // Apply multipliers early to avoid unnecessary iterations
             for (Multiplier* multiplier : multipliers)
             {
+                if (!multiplier->AppliesTo(action))
+                    continue;
+
                 relevance *= multiplier->GetValue(action);
                 action->setRelevance(relevance);
 
@@ -217,7 +227,6 @@ bool Engine::DoNextAction(Unit* /*unit*/, uint32 /*depth*/, bool minimal)
                     LogAction("A:%s - OK", action->getName().c_str());
                     MultiplyAndPush(actionNode->getContinuers(), relevance, false, event, "cont");
                     lastRelevance = relevance;
-                    delete actionNode;  // Safe memory management
                     break;
                 }
                 else
@@ -237,8 +246,6 @@ bool Engine::DoNextAction(Unit* /*unit*/, uint32 /*depth*/, bool minimal)
             LogAction("A:%s - USELESS", action->getName().c_str());
             lastRelevance = relevance;
         }
-
-        delete actionNode;  // Always delete after processing the action node
     }
 
     if (time(nullptr) - currentTime > 1)
@@ -250,20 +257,34 @@ bool Engine::DoNextAction(Unit* /*unit*/, uint32 /*depth*/, bool minimal)
         LogAction("no actions executed");
 
     queue.RemoveExpired();
+    aiObjectContext->EndValueGeneration();
 
     return actionExecuted;
 }
 
-ActionNode* Engine::CreateActionNode(std::string const name)
+ActionNode* Engine::GetActionNode(std::string const name)
 {
+    auto itr = actionNodes.find(name);
+    if (itr != actionNodes.end())
+        return itr->second;
+
     ActionNode* node = actionNodeFactories.GetContextObject(name, botAI);
-    if (node)
-        return node;
+    if (!node)
+        node = new ActionNode(name,
+                              /*P*/ {},
+                              /*A*/ {},
+                              /*C*/ {});
+
+    actionNodes[name] = node;
+    return node;
+}
 
-    return new ActionNode(name,
-                          /*P*/ {},
-                          /*A*/ {},
-                          /*C*/ {});
+void Engine::DeleteRetiredActionNodes()
+{
+    for (ActionNode* node : retiredActionNodes)
+        delete node;
+
+    retiredActionNodes.clear();
 }
 
 bool Engine::MultiplyAndPush(
@@ -278,7 +299,7 @@ bool Engine::MultiplyAndPush(
 
     for (NextAction nextAction : actions)
     {
-        ActionNode* action = this->CreateActionNode(nextAction.getName());
+        ActionNode* action = this->GetActionNode(nextAction.getName());
 
         this->InitializeAction(action);
 
@@ -292,14 +313,9 @@ bool Engine::MultiplyAndPush(
         if (k > 0)
         {
             this->LogAction("PUSH:%s - %f (%s)", action->getName().c_str(), k, pushType);
-            queue.Push(new ActionBasket(action, k, skipPrerequisites, event));
+            queue.Push(ActionBasket(action, k, skipPrerequisites, event));
             pushed = true;
-
-            continue;
         }
-
-        delete action;
-
     }
 
     return pushed;
@@ -309,16 +325,13 @@ ActionResult Engine::ExecuteAction(std::string const name, Event event, std::str
 {
     bool result = false;
 
-    ActionNode* actionNode = CreateActionNode(name);
+    ActionNode* actionNode = GetActionNode(name);
     if (!actionNode)
         return ACTION_RESULT_UNKNOWN;
 
     Action* action = InitializeAction(actionNode);
     if (!action)
-    {
-        delete actionNode;
         return ACTION_RESULT_UNKNOWN;
-    }
 
     if (!qualifier.empty())
     {
@@ -327,24 +340,16 @@ ActionResult Engine::ExecuteAction(std::string const name, Event event, std::str
     }
 
     if (!action->isUseful())
-    {
-        delete actionNode;
         return ACTION_RESULT_USELESS;
-    }
 
     if (!action->isPossible())
-    {
-        delete actionNode;
         return ACTION_RESULT_IMPOSSIBLE;
-    }
 
     action->MakeVerbose();
 
     result = ListenAndExecute(action, event);
     MultiplyAndPush(action->getContinuers(), 0.0f, false, event, "default");
 
-    delete actionNode;
-
     return result ? ACTION_RESULT_OK : ACTION_RESULT_FAILED;
 }
 
@@ -539,8 +544,6 @@ void Engine::PushAgain(ActionNode* actionNode, float relevance, Event event)
     std::vector<NextAction> nextAction = { NextAction(actionNode->getName(), relevance) };
 
     MultiplyAndPush(nextAction, relevance, true, event, "again");
-
-    delete actionNode;
 }
 
 bool Engine::ContainsStrategy(StrategyType type)
@@ -558,7 +561,8 @@ Action* Engine::InitializeAction(ActionNode* actionNode)
     Action* action = actionNode->getAction();
     if (!action)
     {
-        action = aiObjectContext->GetAction(actionNode->getName());
+        std::string const name = actionNode->getName();
+        action = aiObjectContext->GetAction(Symbol(actionNode->getNameId(), name));
         actionNode->setAction(action);
     }
 
@@ -578,7 +582,15 @@ bool Engine::ListenAndExecute(Action* action, Event event)
 
     if (actionExecutionListeners.Before(action, event))
     {
-        actionExecuted = actionExecutionListeners.AllowExecution(action, event) ? action->Execute(event) : true;
+        if (actionExecutionListeners.AllowExecution(action, event))
+        {
+            actionExecuted = action->Execute(event);
+
+            // The action may have changed what the cached values describe.
+            aiObjectContext->AdvanceValueGeneration();
+        }
+        else
+            actionExecuted = true;
     }
 
     if (botAI->HasStrategy("debug", BOT_STATE_NON_COMBAT))
@@ -8,6 +8,7 @@
 #define PLAYERBOTS_ENGINE_H
 
 #include <map>
+#include <unordered_map>
 
 #include "Multiplier.h"
 #include "PlayerbotAIAware.h"
@@ -99,7 +100,8 @@ private:
     void ProcessTriggers(bool minimal);
     void PushDefaultActions();
     void PushAgain(ActionNode* actionNode, float relevance, Event event);
-    ActionNode* CreateActionNode(std::string const name);
+    ActionNode* GetActionNode(std::string const name);
+    void DeleteRetiredActionNodes();
     Action* InitializeAction(ActionNode* actionNode);
     bool ListenAndExecute(Action* action, Event event);
 
@@ -119,6 +121,11 @@ protected:
     uint32 strategyTypeMask;
     bool hasTargetExclusions = false;
     NamedObjectFactoryList<ActionNode> actionNodeFactories;
+
+    // One node per action name, created on first push and reused until the next Init().
+    std::unordered_map<std::string, ActionNode*> actionNodes;
+    // Nodes dropped by Reset() while an action may still be reading them, deleted on the next tick.
+    std::vector<ActionNode*> retiredActionNodes;
 };
 
 #endif
@@ -0,0 +1,314 @@
+/*
+ * This file is part of the mod-playerbots module for AzerothCore. See AUTHORS file for Copyright
+ * information; released under GNU GPL v2 license, redistribute/modify under version 2 of the License,
+ * or (at your option) any later version.
+ */
+
+#include "EngineBenchmark.h"
+
+#include <chrono>
+#include <memory>
+#include <unordered_map>
+
+#include "AiObjectContext.h"
+#include "Chat.h"
+#include "Engine.h"
+#include "Playerbots.h"
+
+namespace
+{
+    constexpr uint32 BENCH_STRATEGIES = 8;
+    constexpr uint32 BENCH_ACTIONS = 12;   // Per strategy.
+    constexpr uint32 BENCH_TRIGGERS = 4;   // Per strategy.
+
+    std::string GetBenchActionName(uint32 strategy, uint32 action)
+    {
+        return "bench " + std::to_string(strategy) + " action " + std::to_string(action % BENCH_ACTIONS);
+    }
+
+    // Useless, failing or succeeding in a fixed pattern so prerequisites, alternatives and
+    // continuers all end up in the queue.
+    class BenchmarkAction : public Action
+    {
+    public:
+        BenchmarkAction(PlayerbotAI* botAI, std::string const name, uint32 seed) : Action(botAI, name), calls(seed) {}
+
+        bool isUseful() override { return ++calls % 7 != 0; }
+        bool Execute(Event /*event*/) override { return ++calls % 5 == 0; }
+
+    private:
+        uint32 calls;
+    };
+
+    class BenchmarkTrigger : public Trigger
+    {
+    public:
+        BenchmarkTrigger(PlayerbotAI* botAI, std::string const name, uint32 seed) : Trigger(botAI, name), calls(seed) {}
+
+        bool IsActive() override { return ++calls % 3 == 0; }
+
+    private:
+        uint32 calls;
+    };
+
+    class BenchmarkStrategy : public Strategy
+    {
+    public:
+        BenchmarkStrategy(PlayerbotAI* botAI, uint32 index, std::vector<std::unique_ptr<Action>>& actions,
+                          std::vector<std::unique_ptr<Trigger>>& triggers)
+            : Strategy(botAI), index(index), name("bench " + std::to_string(index))
+        {
+            for (uint32 i = 0; i < BENCH_ACTIONS; ++i)
+            {
+                std::string const actionName = GetBenchActionName(index, i);
+                actions.push_back(std::make_unique<BenchmarkAction>(botAI, actionName, index + i));
+                Action* action = actions.back().get();
+
+                std::vector<NextAction> prerequisites;
+                if (i % 3 == 0)
+                    prerequisites.push_back(NextAction(GetBenchActionName(index, i + 1)));
+
+                actionNodeFactories.creators[actionName] = [=](PlayerbotAI*)
+                {
+                    ActionNode* node = new ActionNode(
+                        actionName,
+                        /*P*/ prerequisites,
+                        /*A*/ { NextAction(GetBenchActionName(index, i + 2)) },
+                        /*C*/ { NextAction(GetBenchActionName(index, i + 3)) }
+                    );
+                    node->setAction(action);
+                    return node;
+                };
+            }
+
+            for (uint32 i = 0; i < BENCH_TRIGGERS; ++i)
+            {
+                std::string const triggerName = name + " trigger " + std::to_string(i);
+                triggers.push_back(std::make_unique<BenchmarkTrigger>(botAI, triggerName, index + i));
+                triggerHandlers.push_back(std::make_pair(
+                    triggers.back().get(),
+                    std::vector<NextAction>{ NextAction(GetBenchActionName(index, i * 3), 20.0f + i + index) }));
+            }
+        }
+
+        std::string const getName() override { return name; }
+
+        std::vector<NextAction> getDefaultActions() override
+        {
+            return { NextAction(GetBenchActionName(index, 0), 1.0f + index),
+                     NextAction(GetBenchActionName(index, 5), 2.0f + index) };
+        }
+
+        void InitTriggers(std::vector<TriggerNode*>& triggers) override
+        {
+            for (auto const& handler : triggerHandlers)
+            {
+                TriggerNode* node = new TriggerNode(handler.first->getName(), handler.second);
+                node->setTrigger(handler.first);
+                triggers.push_back(node);
+            }
+        }
+
+    private:
+        uint32 index;
+        std::string const name;
+        std::vector<std::pair<Trigger*, std::vector<NextAction>>> triggerHandlers;
+    };
+
+    class BenchmarkEngine : public Engine
+    {
+    public:
+        BenchmarkEngine(PlayerbotAI* botAI) : Engine(botAI, botAI->GetAiObjectContext()) {}
+
+        void AddBenchmarkStrategy(Strategy* strategy) { strategies[strategy->getName()] = strategy; }
+        uint32 GetQueueSize() { return queue.Size(); }
+    };
+}
+
+bool EngineBenchmark::HandleConsoleCommand(ChatHandler* handler, char const* args)
+{
+    Player* player = handler->getSelectedPlayer();
+    PlayerbotAI* botAI = player ? GET_PLAYERBOT_AI(player) : nullptr;
+    if (!botAI)
+    {
+        handler->PSendSysMessage("Select a bot to run the engine benchmark on.");
+        return true;
+    }
+
+    std::string const cmd = args ? args : "";
+
+    if (cmd.rfind("lookup", 0) == 0)
+    {
+        uint32 iterations = cmd.size() > 7 ? std::max(1, atoi(cmd.substr(7).c_str())) : 1000;
+        BenchLookups(handler, botAI, iterations);
+        return true;
+    }
+
+    if (cmd.rfind("tick", 0) == 0)
+    {
+        uint32 ticks = cmd.size() > 5 ? std::max(1, atoi(cmd.substr(5).c_str())) : 10000;
+        BenchTicks(handler, botAI, ticks);
+        return true;
+    }
+
+    handler->PSendSysMessage("Usage: .playerbots debug engine tick/lookup [iterations]");
+    return true;
+}
+
+void EngineBenchmark::BenchTicks(ChatHandler* handler, PlayerbotAI* botAI, uint32 ticks)
+{
+    // Declared before the engine so they outlive it.
+    std::vector<std::unique_ptr<Action>> actions;
+    std::vector<std::unique_ptr<Trigger>> triggers;
+    std::vector<std::unique_ptr<Strategy>> strategies;
+
+    BenchmarkEngine engine(botAI);
+    for (uint32 i = 0; i < BENCH_STRATEGIES; ++i)
+    {
+        strategies.push_back(std::make_unique<BenchmarkStrategy>(botAI, i, actions, triggers));
+        engine.AddBenchmarkStrategy(strategies.back().get());
+    }
+
+    engine.Init();
+
+    // One warm up tick fills the node pool and the queue.
+    engine.DoNextAction(nullptr);
+
+    uint32 executed = 0;
+    auto begin = std::chrono::steady_clock::now();
+
+    for (uint32 i = 0; i < ticks; ++i)
+    {
+        if (engine.DoNextAction(nullptr))
+            ++executed;
+    }
+
+    auto end = std::chrono::steady_clock::now();
+    uint64 time = std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count();
+
+    handler->PSendSysMessage("{} engine ticks over {} strategies, {} actions, {} triggers: {}ms, {:.2f}us per tick.",
+                             ticks, strategies.size(), actions.size(), triggers.size(), time / 1000,
+                             float(time) / ticks);
+    handler->PSendSysMessage("{} ticks executed an action, {} actions left queued.", executed, engine.GetQueueSize());
+}
+
+void EngineBenchmark::BenchLookups(ChatHandler* handler, PlayerbotAI* botAI, uint32 iterations)
+{
+    AiObjectContext* context = botAI->GetAiObjectContext();
+
+    std::vector<std::string> names;
+    std::vector<std::pair<std::string, std::string>> qualifiedNames;
+    std::vector<Symbol> symbols;
+    std::unordered_map<std::string, UntypedValue*> legacyMap;
+
+    for (std::string const& name : context->GetValues())
+    {
+        UntypedValue* value = context->GetUntypedValue(name);
+        if (!value)
+            continue;
+
+        names.push_back(name);
+        legacyMap[name] = value;
+
+        size_t found = name.find("::");
+        if (found != std::string::npos)
+            qualifiedNames.push_back(std::make_pair(name.substr(0, found), name.substr(found + 2)));
+    }
+
+    if (names.empty())
+    {
+        handler->PSendSysMessage("The selected bot has not created any values yet.");
+        return;
+    }
+
+    // Views into names, which is not modified below.
+    for (std::string const& name : names)
+        symbols.push_back(Symbol(SymbolTable::GetId(name), name));
+
+    uint32 misses = 0;
+    auto begin = std::chrono::steady_clock::now();
+
+    // The map layout and key construction the contexts used before symbol ids.
+    for (uint32 i = 0; i < iterations; ++i)
+    {
+        for (std::string const& name : names)
+        {
+            std::string const key(name.c_str());
+            if (legacyMap.find(key) == legacyMap.end() || !legacyMap[key])
+                ++misses;
+        }
+    }
+
+    auto legacyEnd = std::chrono::steady_clock::now();
+
+    for (uint32 i = 0; i < iterations; ++i)
+    {
+        for (std::string const& name : names)
+        {
+            if (!context->GetUntypedValue(name))
+                ++misses;
+        }
+    }
+
+    auto stringEnd = std::chrono::steady_clock::now();
+
+    for (uint32 i = 0; i < iterations; ++i)
+    {
+        for (Symbol const& symbol : symbols)
+        {
+            if (!context->GetUntypedValue(symbol))
+                ++misses;
+        }
+    }
+
+    auto symbolEnd = std::chrono::steady_clock::now();
+
+    uint64 legacyQualifiedTime = 0, qualifiedTime = 0;
+    if (!qualifiedNames.empty())
+    {
+        for (uint32 i = 0; i < iterations; ++i)
+        {
+            for (auto const& name : qualifiedNames)
+            {
+                if (!context->GetUntypedValue(name.first + "::" + name.second))
+                    ++misses;
+            }
+        }
+
+        auto legacyQualifiedEnd = std::chrono::steady_clock::now();
+
+        for (uint32 i = 0; i < iterations; ++i)
+        {
+            for (auto const& name : qualifiedNames)
+            {
+                if (!context->GetUntypedValue(name.first, name.second))
+                    ++misses;
+            }
+        }
+
+        auto qualifiedEnd = std::chrono::steady_clock::now();
+
+        legacyQualifiedTime =
+            std::chrono::duration_cast<std::chrono::microseconds>(legacyQualifiedEnd - symbolEnd).count();
+        qualifiedTime =
+            std::chrono::duration_cast<std::chrono::microseconds>(qualifiedEnd - legacyQualifiedEnd).count();
+    }
+
+    auto lookupsPerSecond = [iterations](size_t count, uint64 time)
+    { return time ? uint64(double(count) * iterations * 1000000 / time) : 0; };
+
+    uint64 legacyTime = std::chrono::duration_cast<std::chrono::microseconds>(legacyEnd - begin).count();
+    uint64 stringTime = std::chrono::duration_cast<std::chrono::microseconds>(stringEnd - legacyEnd).count();
+    uint64 symbolTime = std::chrono::duration_cast<std::chrono::microseconds>(symbolEnd - stringEnd).count();
+
+    handler->PSendSysMessage("{} values x{}, lookups/s: string map {}, string API {}, symbol ids {}.",
+                             names.size(), iterations, lookupsPerSecond(names.size(), legacyTime),
+                             lookupsPerSecond(names.size(), stringTime), lookupsPerSecond(names.size(), symbolTime));
+
+    if (!qualifiedNames.empty())
+        handler->PSendSysMessage("{} qualified values: joined name {} lookups/s, name and qualifier {} lookups/s.",
+                                 qualifiedNames.size(), lookupsPerSecond(qualifiedNames.size(), legacyQualifiedTime),
+                                 lookupsPerSecond(qualifiedNames.size(), qualifiedTime));
+
+    handler->PSendSysMessage("{} symbols registered, {} failed lookups.", sSymbolTable.GetSize(), misses);
+}
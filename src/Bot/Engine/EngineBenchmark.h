@@ -0,0 +1,31 @@
+/*
+ * This file is part of the mod-playerbots module for AzerothCore. See AUTHORS file for Copyright
+ * information; released under GNU GPL v2 license, redistribute/modify under version 2 of the License,
+ * or (at your option) any later version.
+ */
+
+#ifndef PLAYERBOTS_ENGINEBENCHMARK_H
+#define PLAYERBOTS_ENGINEBENCHMARK_H
+
+#include "Common.h"
+
+class ChatHandler;
+class PlayerbotAI;
+
+// Micro benchmarks for the AI engine, run against the selected bot from .playerbots debug engine.
+class EngineBenchmark
+{
+public:
+    static bool HandleConsoleCommand(ChatHandler* handler, char const* args);
+
+private:
+    // Drives Engine::DoNextAction with a synthetic strategy set whose actions, triggers and
+    // action nodes never touch game state, so only the engine's own bookkeeping is measured.
+    static void BenchTicks(ChatHandler* handler, PlayerbotAI* botAI, uint32 ticks);
+
+    // Looks up every value the bot has created through the old string keyed map layout, the
+    // string API and precomputed symbol ids.
+    static void BenchLookups(ChatHandler* handler, PlayerbotAI* botAI, uint32 iterations);
+};
+
+#endif
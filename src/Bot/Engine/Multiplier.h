@@ -7,18 +7,27 @@
 #ifndef PLAYERBOTS_MULTIPLIER_H
 #define PLAYERBOTS_MULTIPLIER_H
 
+#include "Action.h"
 #include "AiObject.h"
 
-class Action;
 class PlayerbotAI;
 
 class Multiplier : public AiNamedObject
 {
 public:
-    Multiplier(PlayerbotAI* botAI, std::string const name) : AiNamedObject(botAI, name) {}
+    // A multiplier that only ever changes the relevance of actions of some ActionCategory bits passes them as
+    // actionCategories, the engine then does not call it for any other action.
+    Multiplier(PlayerbotAI* botAI, std::string const name, uint32 actionCategories = 0)
+        : AiNamedObject(botAI, name), actionCategories(actionCategories)
+    {
+    }
     virtual ~Multiplier() {}
 
     virtual float GetValue([[maybe_unused]] Action* action) { return 1.0f; }
+    bool AppliesTo(Action* action) const { return !actionCategories || action->HasCategory(actionCategories); }
+
+private:
+    uint32 actionCategories;
 };
 
 #endif
@@ -15,6 +15,7 @@
 #include <functional>
 
 #include "Common.h"
+#include "SymbolTable.h"
 
 class PlayerbotAI;
 
@@ -150,7 +151,10 @@ public:
     {
         contexts.push_back(context);
         for (auto const& iter : context->creators)
+        {
             creators[iter.first] = iter.second;
+            sSymbolTable.Register(SymbolTable::GetId(iter.first), iter.first);
+        }
     }
 };
 
@@ -162,6 +166,8 @@ public:
     const std::unordered_map<std::string, ObjectCreator>& creators;
     const std::vector<NamedObjectContext<T>*>& contexts;
     std::unordered_map<std::string, T*> created;
+    // Same objects as created, keyed by SymbolTable id. Lookups go through this map.
+    std::unordered_map<SymbolId, T*> createdById;
 
     NamedObjectContextList(const SharedNamedObjectContextList<T>& shared)
         : creators(shared.creators), contexts(shared.contexts)
@@ -177,6 +183,7 @@ public:
         }
 
         created.clear();
+        createdById.clear();
     }
 
     T* create(std::string name, PlayerbotAI* botAI)
@@ -204,13 +211,38 @@ public:
 
     T* GetContextObject(const std::string& name, PlayerbotAI* botAI)
     {
-        if (created.find(name) == created.end())
-        {
-            if (T* object = create(name, botAI))
-                return created[name] = object;
-        }
+        return GetContextObject(SymbolTable::GetId(name), name, botAI);
+    }
 
-        return created[name];
+    // The name is only read when the object does not exist yet.
+    T* GetContextObject(SymbolId id, std::string_view name, PlayerbotAI* botAI)
+    {
+        auto itr = createdById.find(id);
+        if (itr != createdById.end())
+            return itr->second;
+
+        std::string const key(name);
+        sSymbolTable.Register(id, key);
+
+        T* object = created[key];
+        if (!object)
+            object = created[key] = create(key, botAI);
+
+        createdById[id] = object;
+        return object;
+    }
+
+    // Same as GetContextObject(name + "::" + qualifier) without building the string for existing objects.
+    T* GetContextObject(SymbolId nameId, std::string_view name, std::string_view qualifier, PlayerbotAI* botAI)
+    {
+        SymbolId id = SymbolTable::GetId(nameId, qualifier);
+        auto itr = createdById.find(id);
+        if (itr != createdById.end())
+            return itr->second;
+
+        std::string key(name);
+        key.append("::").append(qualifier);
+        return GetContextObject(id, key, botAI);
     }
 
     std::set<std::string> GetSiblings(const std::string& name)
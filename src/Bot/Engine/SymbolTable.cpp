@@ -0,0 +1,63 @@
+/*
+ * This file is part of the mod-playerbots module for AzerothCore. See AUTHORS file for Copyright
+ * information; released under GNU GPL v2 license, redistribute/modify under version 2 of the License,
+ * or (at your option) any later version.
+ */
+
+#include "SymbolTable.h"
+
+#include <charconv>
+#include <mutex>
+
+#include "Errors.h"
+#include "Log.h"
+
+SymbolId SymbolTable::GetId(SymbolId name, int32 qualifier)
+{
+    char buffer[16];
+    std::to_chars_result result = std::to_chars(buffer, buffer + sizeof(buffer), qualifier);
+    return GetId(name, std::string_view(buffer, result.ptr - buffer));
+}
+
+void SymbolTable::Register(SymbolId id, std::string_view name)
+{
+    {
+        std::shared_lock<std::shared_mutex> lock(m_mutex);
+        auto itr = m_names.find(id);
+        if (itr != m_names.end())
+        {
+            // Both names would resolve to the same context object, so the bot would run the wrong code.
+            ASSERT(itr->second == name, "Symbol '{}' has the same id as '{}'", name, itr->second);
+            return;
+        }
+
+        if (m_full)
+            return;
+    }
+
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    if (m_names.size() >= MAX_SYMBOLS)
+    {
+        if (!m_full)
+            LOG_WARN("playerbots", "Symbol table is full ({} names), new names are not recorded", MAX_SYMBOLS);
+
+        m_full = true;
+        return;
+    }
+
+    auto result = m_names.try_emplace(id, name);
+    ASSERT(result.first->second == name, "Symbol '{}' has the same id as '{}'", name, result.first->second);
+}
+
+std::string const SymbolTable::GetName(SymbolId id)
+{
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    auto itr = m_names.find(id);
+    return itr != m_names.end() ? itr->second : "";
+}
+
+uint32 SymbolTable::GetSize()
+{
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    return m_names.size();
+}
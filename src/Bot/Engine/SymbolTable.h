@@ -0,0 +1,90 @@
+/*
+ * This file is part of the mod-playerbots module for AzerothCore. See AUTHORS file for Copyright
+ * information; released under GNU GPL v2 license, redistribute/modify under version 2 of the License,
+ * or (at your option) any later version.
+ */
+
+#ifndef PLAYERBOTS_SYMBOLTABLE_H
+#define PLAYERBOTS_SYMBOLTABLE_H
+
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+
+#include "Common.h"
+
+// Integer id of a strategy, action, trigger or value name. The id is the 64 bit FNV-1a hash of the
+// full name, so it can be computed at compile time for literals and extended with a "::" qualifier
+// without building the qualified string.
+typedef uint64 SymbolId;
+
+// A name with its precomputed id.
+struct Symbol
+{
+    constexpr Symbol(SymbolId id, std::string_view name) : id(id), name(name) {}
+
+    SymbolId id;
+    std::string_view name;
+};
+
+class SymbolTable
+{
+public:
+    static SymbolTable& instance()
+    {
+        static SymbolTable instance;
+        return instance;
+    }
+
+    static constexpr SymbolId GetId(std::string_view name) { return Append(FNV_OFFSET, name); }
+
+    // Id of "name::qualifier".
+    static constexpr SymbolId GetId(SymbolId name, std::string_view qualifier)
+    {
+        return Append(Append(name, "::"), qualifier);
+    }
+
+    static SymbolId GetId(SymbolId name, int32 qualifier);
+
+    // Records the name behind an id, once per name. Two names hashing to the same id abort the server,
+    // since their lookups would silently return each other's objects.
+    void Register(SymbolId id, std::string_view name);
+
+    std::string const GetName(SymbolId id);
+    uint32 GetSize();
+
+private:
+    static constexpr SymbolId FNV_OFFSET = 14695981039346656037ULL;
+    static constexpr SymbolId FNV_PRIME = 1099511628211ULL;
+
+    static constexpr SymbolId Append(SymbolId id, std::string_view text)
+    {
+        for (char c : text)
+        {
+            id ^= static_cast<uint8>(c);
+            id *= FNV_PRIME;
+        }
+
+        return id;
+    }
+
+    // Qualified names ("name::spell id", ...) are registered too, so the number of names depends on the
+    // data bots run into. Past this limit new names are no longer recorded (nor checked for collisions);
+    // the ids themselves keep working since they do not depend on the table.
+    static constexpr uint32 MAX_SYMBOLS = 65536;
+
+    SymbolTable() = default;
+
+    std::shared_mutex m_mutex;
+    std::unordered_map<SymbolId, std::string> m_names;
+    bool m_full = false;
+};
+
+#define sSymbolTable SymbolTable::instance()
+
+// Compile time id of a literal name, e.g. context->GetValue<Unit*>(SYMBOL("current target")).
+#define SYMBOL(name) Symbol(std::integral_constant<SymbolId, SymbolTable::GetId(name)>::value, name)
+
+#endif
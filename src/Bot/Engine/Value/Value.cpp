@@ -6,10 +6,29 @@
 
 #include "Value.h"
 
+#include "AiObjectContext.h"
 #include "PerfMonitor.h"
 #include "Playerbots.h"
 #include "Timer.h"
 
+bool UntypedValue::IsCalculatedThisTick()
+{
+    uint32 generation = context ? context->GetValueGeneration() : 0;
+    if (!generation)
+        return false;
+
+    bool hit = tickGeneration == generation;
+    tickGeneration = generation;
+    context->CountValueCache(hit);
+    return hit;
+}
+
+void UntypedValue::DependsOn(uint16 opcode)
+{
+    if (context)
+        context->AddValueDependency(opcode, this);
+}
+
 UnitCalculatedValue::UnitCalculatedValue(PlayerbotAI* botAI, std::string const name, int32 checkInterval)
     : CalculatedValue<Unit*>(botAI, name, checkInterval)
 {
@@ -124,11 +143,11 @@ Unit* UnitCalculatedValue::Get()
 {
     if (checkInterval < 2)
     {
-        PerfMonitorOperation* pmo = sPerfMonitor.start(
-            PERF_MON_VALUE, this->getName(), this->context ? &this->context->performanceStack : nullptr);
-        value = Calculate();
-        if (pmo)
-            pmo->finish();
+        if (!IsCalculatedThisTick())
+        {
+            PerfMonitorScope pmo(PERF_MON_VALUE, name, context ? &context->performanceStack : nullptr);
+            value = Calculate();
+        }
     }
     else
     {
@@ -136,11 +155,8 @@ Unit* UnitCalculatedValue::Get()
         if (!lastCheckTime || now - lastCheckTime >= checkInterval)
         {
             lastCheckTime = now;
-            PerfMonitorOperation* pmo = sPerfMonitor.start(
-                PERF_MON_VALUE, this->getName(), this->context ? &this->context->performanceStack : nullptr);
+            PerfMonitorScope pmo(PERF_MON_VALUE, name, context ? &context->performanceStack : nullptr);
             value = Calculate();
-            if (pmo)
-                pmo->finish();
         }
     }
     // Prevent crashing by InWorld check
@@ -41,6 +41,19 @@ public:
     virtual std::string const Format() { return "?"; }
     virtual std::string const Save() { return "?"; }
     virtual bool Load([[maybe_unused]] std::string const value) { return false; }
+
+    // Drops the cached result so the next Get() calculates again.
+    virtual void Invalidate() { tickGeneration = 0; }
+
+protected:
+    // True if the value was already calculated in the current AI tick, see AiObjectContext::GetValueGeneration().
+    bool IsCalculatedThisTick();
+
+    // Invalidates the value whenever the bot receives a packet with this opcode.
+    void DependsOn(uint16 opcode);
+
+private:
+    uint32 tickGeneration = 0;
 };
 
 template <class T>
@@ -74,11 +87,12 @@ public:
     {
         if (checkInterval < 2)
         {
-            // PerfMonitorOperation* pmo = sPerfMonitor.start(PERF_MON_VALUE, this->getName(),
-            // this->context ? &this->context->performanceStack : nullptr);
-            value = Calculate();
-            // if (pmo)
-            //     pmo->finish();
+            if (!IsCalculatedThisTick())
+            {
+                PerfMonitorScope pmo(PERF_MON_VALUE, this->name,
+                                     this->context ? &this->context->performanceStack : nullptr);
+                value = Calculate();
+            }
         }
         else
         {
@@ -86,11 +100,9 @@ public:
             if (!lastCheckTime || now - lastCheckTime >= checkInterval)
             {
                 lastCheckTime = now;
-                // PerfMonitorOperation* pmo = sPerfMonitor.start(PERF_MON_VALUE, this->getName(),
-                // this->context ? &this->context->performanceStack : nullptr);
+                PerfMonitorScope pmo(PERF_MON_VALUE, this->name,
+                                     this->context ? &this->context->performanceStack : nullptr);
                 value = Calculate();
-                // if (pmo)
-                //     pmo->finish();
             }
         }
         return value;
@@ -107,11 +119,12 @@ public:
     {
         if (checkInterval < 2)
         {
-            // PerfMonitorOperation* pmo = sPerfMonitor.start(PERF_MON_VALUE, this->getName(),
-            // this->context ? &this->context->performanceStack : nullptr);
-            value = Calculate();
-            // if (pmo)
-            //     pmo->finish();
+            if (!IsCalculatedThisTick())
+            {
+                PerfMonitorScope pmo(PERF_MON_VALUE, this->name,
+                                     this->context ? &this->context->performanceStack : nullptr);
+                value = Calculate();
+            }
         }
         else
         {
@@ -119,19 +132,27 @@ public:
             if (!lastCheckTime || now - lastCheckTime >= checkInterval)
             {
                 lastCheckTime = now;
-                // PerfMonitorOperation* pmo = sPerfMonitor.start(PERF_MON_VALUE, this->getName(),
-                // this->context ? &this->context->performanceStack : nullptr);
+                PerfMonitorScope pmo(PERF_MON_VALUE, this->name,
+                                     this->context ? &this->context->performanceStack : nullptr);
                 value = Calculate();
-                // if (pmo)
-                //     pmo->finish();
             }
         }
         return value;
     }
-    void Set(T val) override { value = val; }
+    void Set(T val) override
+    {
+        value = val;
+        UntypedValue::Invalidate();
+    }
     void Update() override {}
     void Reset() override { lastCheckTime = 0; }
 
+    void Invalidate() override
+    {
+        UntypedValue::Invalidate();
+        lastCheckTime = 0;
+    }
+
 protected:
     virtual T Calculate() = 0;
 
@@ -156,11 +177,9 @@ public:
         {
             this->lastCheckTime = now;
 
-            PerfMonitorOperation* pmo = sPerfMonitor.start(
-                PERF_MON_VALUE, this->getName(), this->context ? &this->context->performanceStack : nullptr);
+            PerfMonitorScope pmo(PERF_MON_VALUE, this->name,
+                                 this->context ? &this->context->performanceStack : nullptr);
             this->value = this->Calculate();
-            if (pmo)
-                pmo->finish();
         }
 
         return this->value;
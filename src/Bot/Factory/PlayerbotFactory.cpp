@@ -1862,9 +1862,9 @@ void PlayerbotFactory::AddItemStats(uint32 mod, uint8& sp, uint8& ap, uint8& tan
     }
 }
 
-bool PlayerbotFactory::CanEquipWeapon(ItemTemplate const* proto)
+bool PlayerbotFactory::CanEquipWeapon(ItemTemplate const* proto, uint8 cls)
 {
-    switch (bot->getClass())
+    switch (cls)
     {
         case CLASS_PRIEST:
             if (proto->SubClass != ITEM_SUBCLASS_WEAPON_STAFF && proto->SubClass != ITEM_SUBCLASS_WEAPON_WAND &&
@@ -2178,6 +2178,28 @@ void PlayerbotFactory::InitEquipment(bool incremental, bool second_chance)
         }
     }
 
+    EquipProfile equipProfile;
+    equipProfile.clazz = bot->getClass();
+    equipProfile.spec = AiFactory::GetPlayerSpecTab(bot);
+    equipProfile.level = bot->GetLevel();
+    equipProfile.pvp = isPvp;
+    equipProfile.gearScoreLimit = gearScoreLimit;
+    if (bot->HasSkill(SKILL_PLATE_MAIL))
+        equipProfile.armorMask |= 1u << ITEM_SUBCLASS_ARMOR_PLATE;
+    if (bot->HasSkill(SKILL_MAIL))
+        equipProfile.armorMask |= 1u << ITEM_SUBCLASS_ARMOR_MAIL;
+    if (bot->HasSkill(SKILL_LEATHER))
+        equipProfile.armorMask |= 1u << ITEM_SUBCLASS_ARMOR_LEATHER;
+    if (bot->HasSkill(SKILL_CLOTH))
+        equipProfile.armorMask |= 1u << ITEM_SUBCLASS_ARMOR_CLOTH;
+    if (bot->HasSkill(SKILL_SHIELD))
+        equipProfile.armorMask |= 1u << ITEM_SUBCLASS_ARMOR_SHIELD;
+    equipProfile.quality = itemQuality;
+
+    RankedEquipment rankedEquipment;
+    if (!incremental)
+        rankedEquipment = sRandomItemMgr.GetBestEquipment(bot, equipProfile, 50);
+
     for (int32 slot : initSlotsOrder)
     {
         if (slot == EQUIPMENT_SLOT_TABARD || slot == EQUIPMENT_SLOT_BODY)
@@ -2236,69 +2258,95 @@ void PlayerbotFactory::InitEquipment(bool incremental, bool second_chance)
         if (urand(0, 100) < 100 * sPlayerbotAIConfig.randomGearLoweringChance && desiredQuality > ITEM_QUALITY_NORMAL)
             desiredQuality--;
 
-        do
+        if (!incremental)
         {
-            for (uint32 requiredLevel = bot->GetLevel(); requiredLevel > uint32(std::max((int32)bot->GetLevel() - delta, 0));
-                 requiredLevel--)
+            // Candidates ranked once per profile and shared with every bot built the same way. The skip keeps
+            // the variety of the search below, the live calculator still picks the best of what is left.
+            RankedItemList lowered;
+            if (uint32(desiredQuality) != itemQuality)
             {
-                for (InventoryType inventoryType : GetPossibleInventoryTypeListBySlot((EquipmentSlots)slot))
-                {
-                    for (uint32 itemId : sRandomItemMgr.GetEquipmentNew(requiredLevel, inventoryType))
-                    {
-                        uint32 skipProb = 25;
-                        if (urand(1, 100) <= skipProb)
-                            continue;
-
-                        ItemTemplate const* proto = sObjectMgr->GetItemTemplate(itemId);
-                        // disable next expansion gear
-                        if (sPlayerbotAIConfig.limitGearExpansion && bot->GetLevel() <= 60 && itemId >= 23728)
-                            continue;
-
-                        if (sPlayerbotAIConfig.limitGearExpansion && bot->GetLevel() <= 70 && itemId >= 35570 &&
-                            itemId != 36737 && itemId != 37739 &&
-                            itemId != 37740)  // transition point from TBC -> WOTLK isn't as clear, and there are other
-                                              // wearable TBC items above 35570 but nothing of significance
-                            continue;
+                EquipProfile loweredProfile = equipProfile;
+                loweredProfile.quality = desiredQuality;
+                lowered = sRandomItemMgr.GetBestEquipment(bot, loweredProfile, slot, 50);
+            }
 
-                        if (!proto)
-                            continue;
+            for (RankedItem const& item : uint32(desiredQuality) != itemQuality ? lowered : rankedEquipment[slot])
+            {
+                if (items[slot].size() >= 25)
+                    break;
 
-                        bool shouldCheckGS = desiredQuality > ITEM_QUALITY_NORMAL;
+                if (urand(1, 100) <= 25)
+                    continue;
 
-                        if (shouldCheckGS && gearScoreLimit != 0 &&
-                            CalcMixedGearScore(proto->ItemLevel, proto->Quality) > gearScoreLimit)
+                items[slot].push_back({item.itemId, item.randomPropertyId});
+            }
+        }
+        else
+        {
+            do
+            {
+                for (uint32 requiredLevel = bot->GetLevel();
+                     requiredLevel > uint32(std::max((int32)bot->GetLevel() - delta, 0)); requiredLevel--)
+                {
+                    for (InventoryType inventoryType : GetPossibleInventoryTypeListBySlot((EquipmentSlots)slot))
+                    {
+                        for (uint32 itemId : sRandomItemMgr.GetEquipmentNew(requiredLevel, inventoryType))
                         {
-                            continue;
+                            uint32 skipProb = 25;
+                            if (urand(1, 100) <= skipProb)
+                                continue;
+
+                            ItemTemplate const* proto = sObjectMgr->GetItemTemplate(itemId);
+                            // disable next expansion gear
+                            if (sPlayerbotAIConfig.limitGearExpansion && bot->GetLevel() <= 60 && itemId >= 23728)
+                                continue;
+
+                            if (sPlayerbotAIConfig.limitGearExpansion && bot->GetLevel() <= 70 && itemId >= 35570 &&
+                                itemId != 36737 && itemId != 37739 &&
+                                itemId != 37740)  // transition point from TBC -> WOTLK isn't as clear, and there are
+                                                  // other wearable TBC items above 35570 but nothing of significance
+                                continue;
+
+                            if (!proto)
+                                continue;
+
+                            bool shouldCheckGS = desiredQuality > ITEM_QUALITY_NORMAL;
+
+                            if (shouldCheckGS && gearScoreLimit != 0 &&
+                                CalcMixedGearScore(proto->ItemLevel, proto->Quality) > gearScoreLimit)
+                            {
+                                continue;
+                            }
+                            if (proto->Class != ITEM_CLASS_WEAPON && proto->Class != ITEM_CLASS_ARMOR)
+                                continue;
+
+                            if (proto->Quality != uint32(desiredQuality))
+                                continue;
+
+                            if (proto->Class == ITEM_CLASS_ARMOR &&
+                                (slot == EQUIPMENT_SLOT_HEAD || slot == EQUIPMENT_SLOT_SHOULDERS ||
+                                 slot == EQUIPMENT_SLOT_CHEST || slot == EQUIPMENT_SLOT_WAIST ||
+                                 slot == EQUIPMENT_SLOT_LEGS || slot == EQUIPMENT_SLOT_FEET ||
+                                 slot == EQUIPMENT_SLOT_WRISTS || slot == EQUIPMENT_SLOT_HANDS) &&
+                                !CanEquipArmor(proto))
+                                continue;
+
+                            if (proto->Class == ITEM_CLASS_WEAPON && !CanEquipWeapon(proto, bot->getClass()))
+                                continue;
+
+                            if (slot == EQUIPMENT_SLOT_OFFHAND && bot->getClass() == CLASS_ROGUE &&
+                                proto->Class != ITEM_CLASS_WEAPON)
+                                continue;
+
+                            int32 bestRandomProp = 0;
+                            if (proto->RandomProperty || proto->RandomSuffix)
+                                bestRandomProp = calculator.PickBestRandomPropertyId(itemId);
+                            items[slot].push_back({itemId, bestRandomProp});
                         }
-                        if (proto->Class != ITEM_CLASS_WEAPON && proto->Class != ITEM_CLASS_ARMOR)
-                            continue;
-
-                        if (proto->Quality != uint32(desiredQuality))
-                            continue;
-
-                        if (proto->Class == ITEM_CLASS_ARMOR &&
-                            (slot == EQUIPMENT_SLOT_HEAD || slot == EQUIPMENT_SLOT_SHOULDERS ||
-                             slot == EQUIPMENT_SLOT_CHEST || slot == EQUIPMENT_SLOT_WAIST ||
-                             slot == EQUIPMENT_SLOT_LEGS || slot == EQUIPMENT_SLOT_FEET ||
-                             slot == EQUIPMENT_SLOT_WRISTS || slot == EQUIPMENT_SLOT_HANDS) &&
-                            !CanEquipArmor(proto))
-                            continue;
-
-                        if (proto->Class == ITEM_CLASS_WEAPON && !CanEquipWeapon(proto))
-                            continue;
-
-                        if (slot == EQUIPMENT_SLOT_OFFHAND && bot->getClass() == CLASS_ROGUE &&
-                            proto->Class != ITEM_CLASS_WEAPON)
-                            continue;
-
-                        int32 bestRandomProp = 0;
-                        if (proto->RandomProperty || proto->RandomSuffix)
-                            bestRandomProp = calculator.PickBestRandomPropertyId(itemId);
-                        items[slot].push_back({itemId, bestRandomProp});
                     }
                 }
-            }
-        } while (items[slot].size() < 25 && desiredQuality-- > ITEM_QUALITY_POOR);
+            } while (items[slot].size() < 25 && desiredQuality-- > ITEM_QUALITY_POOR);
+        }
 
         std::vector<std::pair<uint32, int32>>& ids = items[slot];
         if (ids.empty())
@@ -4588,7 +4636,7 @@ void PlayerbotFactory::InitInventoryEquip()
         if (proto->Class == ITEM_CLASS_ARMOR && !CanEquipArmor(proto))
             continue;
 
-        if (proto->Class == ITEM_CLASS_WEAPON && !CanEquipWeapon(proto))
+        if (proto->Class == ITEM_CLASS_WEAPON && !CanEquipWeapon(proto, bot->getClass()))
             continue;
 
         if (proto->Quality != desiredQuality)
@@ -91,6 +91,11 @@ public:
     void InitAttunementQuests();
     void InitGuild();
 
+    // Class only checks of InitEquipment, shared with RandomItemMgr::GetBestEquipment.
+    static bool CanEquipWeapon(ItemTemplate const* proto, uint8 cls);
+    static uint8 GetPreferredArmorType(uint8 cls);
+    static std::vector<InventoryType> GetPossibleInventoryTypeListBySlot(EquipmentSlots slot);
+
 private:
     enum class ProfessionSpecializationSpell : uint32
     {
@@ -190,9 +195,7 @@ private:
 
     std::vector<uint32> GetCurrentGemsCount();
     bool CanEquipArmor(ItemTemplate const* proto);
-    bool CanEquipWeapon(ItemTemplate const* proto);
     static void BuildCcBreakTrinketCache();
-    uint8 GetPreferredArmorType(uint8 cls);
     void EnchantItem(Item* item);
     void AddItemStats(uint32 mod, uint8& sp, uint8& ap, uint8& tank);
     bool CheckItemStats(uint8 sp, uint8 ap, uint8 tank);
@@ -209,7 +212,6 @@ private:
     void LoadEnchantContainer();
     void ApplyEnchantTemplate();
     void ApplyEnchantTemplate(uint8 spec);
-    std::vector<InventoryType> GetPossibleInventoryTypeListBySlot(EquipmentSlots slot);
     void IterateItems(IterateItemsVisitor* visitor, IterateItemsMask mask = ITERATE_ITEMS_IN_BAGS);
     void IterateItemsInBags(IterateItemsVisitor* visitor);
     void IterateItemsInEquip(IterateItemsVisitor* visitor);
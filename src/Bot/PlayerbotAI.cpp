@@ -1118,6 +1118,8 @@ void PlayerbotAI::HandleBotOutgoingPacket(WorldPacket const& packet)
     if (!bot || !bot->IsInWorld() || bot->IsDuringRemoveFromWorld())
         return;
 
+    aiObjectContext->InvalidateValues(packet.GetOpcode());
+
     switch (packet.GetOpcode())
     {
         case SMSG_SPELL_FAILURE:
@@ -104,16 +104,20 @@ void PlayerbotHolder::AddPlayerBot(ObjectGuid playerGuid, uint32 masterAccountId
     Guild* guild = masterPlayer ? sGuildMgr->GetGuildById(masterPlayer->GetGuildId()) : nullptr;
     bool sameGuild = sPlayerbotAIConfig.allowGuildBots && guild && guild->GetMember(playerGuid);
     bool addClassBot = sRandomPlayerbotMgr.IsAddclassBot(playerGuid.GetCounter());
-    bool linkedAccount = sPlayerbotAIConfig.allowTrustedAccountBots && IsAccountLinked(accountId, masterAccountId);
 
     bool allowed = true;
     std::ostringstream out;
-    std::string botName;
-    sCharacterCache->GetCharacterNameByGuid(playerGuid, botName);
-    if (!isRndbot && !sameAccount && !sameGuild && !addClassBot && !linkedAccount)
+    if (!isRndbot && !sameAccount && !sameGuild && !addClassBot)
     {
-        allowed = false;
-        out << "Failure: You are not allowed to control bot " << botName.c_str();
+        // Only queried when nothing else allows the bot, random bot logins must not wait on the database
+        bool linkedAccount = sPlayerbotAIConfig.allowTrustedAccountBots && IsAccountLinked(accountId, masterAccountId);
+        if (!linkedAccount)
+        {
+            std::string botName;
+            sCharacterCache->GetCharacterNameByGuid(playerGuid, botName);
+            allowed = false;
+            out << "Failure: You are not allowed to control bot " << botName.c_str();
+        }
     }
     if (masterAccountId && masterPlayer)
     {
@@ -157,7 +161,7 @@ void PlayerbotHolder::AddPlayerBot(ObjectGuid playerGuid, uint32 masterAccountId
     // Always login in with world session to avoid race condition
     sWorld->AddQueryHolderCallback(CharacterDatabase.DelayQueryHolder(holder))
         .AfterComplete(
-            [](SQLQueryHolderBase const& queryHolder)
+            [loginHolder = holder](SQLQueryHolderBase const& queryHolder)
             {
                 PlayerbotLoginQueryHolder const& holder = static_cast<PlayerbotLoginQueryHolder const&>(queryHolder);
                 uint32 masterAccountId = holder.GetMasterAccountId();
@@ -185,7 +189,8 @@ void PlayerbotHolder::AddPlayerBot(ObjectGuid playerGuid, uint32 masterAccountId
                     }
                 }
 
-                RandomPlayerbotMgr ::instance().HandlePlayerBotLoginCallback(holder);
+                // Random bots enter the world at the rate RandomPlayerbotMgr::UpdateLoginPipeline admits them
+                RandomPlayerbotMgr::instance().QueueLogin(loginHolder);
             });
 }
 
@@ -564,21 +569,24 @@ void PlayerbotHolder::OnBotLogin(Player* const bot)
             if (mgroup->isRaidGroup() || (!mgroup->isLFGGroup() && !mgroup->isBGGroup() && !mgroup->isBFGroup()))
             {
                 // Queue AddMember operation; Execute() converts the party to a raid before adding.
-                auto addOp = std::make_unique<GroupInviteOperation>(master->GetGUID(), bot->GetGUID());
+                auto addOp = std::make_unique<GroupInviteOperation>(master->GetGUID(), bot->GetGUID(),
+                                                                    !GET_PLAYERBOT_AI(master));
                 PlayerbotWorldThreadProcessor::instance().QueueOperation(std::move(addOp));
             }
         }
         else
         {
             // Queue AddMember operation
-            auto addOp = std::make_unique<GroupInviteOperation>(master->GetGUID(), bot->GetGUID());
+            auto addOp = std::make_unique<GroupInviteOperation>(master->GetGUID(), bot->GetGUID(),
+                                                                !GET_PLAYERBOT_AI(master));
             PlayerbotWorldThreadProcessor::instance().QueueOperation(std::move(addOp));
         }
     }
     else if (master && !group)
     {
         // Queue group creation and AddMember operation
-        auto inviteOp = std::make_unique<GroupInviteOperation>(master->GetGUID(), bot->GetGUID());
+        auto inviteOp = std::make_unique<GroupInviteOperation>(master->GetGUID(), bot->GetGUID(),
+                                                               !GET_PLAYERBOT_AI(master));
         PlayerbotWorldThreadProcessor::instance().QueueOperation(std::move(inviteOp));
     }
     // if (master)
@@ -13,6 +13,7 @@
 #include <cstdlib>
 #include <ctime>
 #include <iomanip>
+#include <mutex>
 #include <random>
 
 #include "AiFactory.h"
@@ -45,6 +46,7 @@
 #include "SharedDefines.h"
 #include "TravelMgr.h"
 #include "Unit.h"
+#include "UpdateTime.h"
 #include "World.h"
 #include "Cell.h"
 #include "GridNotifiers.h"
@@ -428,17 +430,27 @@ void RandomPlayerbotMgr::UpdateAIInternal(uint32 /*elapsed*/, bool /*minimal*/)
                 break;
         }
 
-        if (loginBots && botLoading.empty())
+        // Logins are pipelined: new ones are issued while earlier ones still load, up to the prefetch window.
+        // Bots still loading count against the bot count.
+        uint32 const loading = botLoading.size();
+        uint32 const prefetch = sPlayerbotAIConfig.randomBotLoginPrefetch;
+        uint32 const loginSlots =
+            std::min(maxNewBots - std::min(maxNewBots, loading), prefetch - std::min(prefetch, loading));
+
+        if (loginBots && loginSlots)
         {
             loginBots += updateBots;
-            loginBots = std::min(loginBots, maxNewBots);
+            loginBots = std::min(loginBots, loginSlots);
+
+            LOG_DEBUG("playerbots", "{} new bots prepared to login, {} loading", loginBots, loading);
 
-            LOG_DEBUG("playerbots", "{} new bots prepared to login", loginBots);
+            if (!loginStats.startTime)
+                loginStats.startTime = getMSTime();
 
             // Log in bots
             for (auto bot : availableBots)
             {
-                if (GetPlayerBot(bot))
+                if (GetPlayerBot(bot) || botLoading.count(ObjectGuid::Create<HighGuid::Player>(bot)))
                     continue;
 
                 if (ProcessBot(bot))
@@ -1763,6 +1775,8 @@ void RandomPlayerbotMgr::Init()
         sRandomPlayerbotMgr.LoadBattleMastersCache();
 
     PlayerbotsDatabase.Execute("DELETE FROM playerbots_random_bots WHERE event = 'add'");
+
+    sRandomPlayerbotMgr.PreloadEventCache();
 }
 
 void RandomPlayerbotMgr::RandomTeleportForLevel(Player* bot)
@@ -1954,17 +1968,8 @@ void RandomPlayerbotMgr::RandomizeFirst(Player* bot)
     uint32 inworldTime =
         urand(sPlayerbotAIConfig.minRandomBotInWorldTime, sPlayerbotAIConfig.maxRandomBotInWorldTime);
 
-    PlayerbotsDatabasePreparedStatement* stmt = PlayerbotsDatabase.GetPreparedStatement(PLAYERBOTS_UPD_RANDOM_BOTS);
-    stmt->SetData(0, randomTime);
-    stmt->SetData(1, "bot_delete");
-    stmt->SetData(2, bot->GetGUID().GetCounter());
-    PlayerbotsDatabase.Execute(stmt);
-
-    stmt = PlayerbotsDatabase.GetPreparedStatement(PLAYERBOTS_UPD_RANDOM_BOTS);
-    stmt->SetData(0, inworldTime);
-    stmt->SetData(1, "logout");
-    stmt->SetData(2, bot->GetGUID().GetCounter());
-    PlayerbotsDatabase.Execute(stmt);
+    SetEventValidIn(bot->GetGUID().GetCounter(), "bot_delete", randomTime);
+    SetEventValidIn(bot->GetGUID().GetCounter(), "logout", inworldTime);
 
     // teleport to a random inn for bot level
     botAI->Reset(true);
@@ -1995,17 +2000,8 @@ void RandomPlayerbotMgr::RandomizeMin(Player* bot)
     uint32 inworldTime =
         urand(sPlayerbotAIConfig.minRandomBotInWorldTime, sPlayerbotAIConfig.maxRandomBotInWorldTime);
 
-    PlayerbotsDatabasePreparedStatement* stmt = PlayerbotsDatabase.GetPreparedStatement(PLAYERBOTS_UPD_RANDOM_BOTS);
-    stmt->SetData(0, randomTime);
-    stmt->SetData(1, "bot_delete");
-    stmt->SetData(2, bot->GetGUID().GetCounter());
-    PlayerbotsDatabase.Execute(stmt);
-
-    stmt = PlayerbotsDatabase.GetPreparedStatement(PLAYERBOTS_UPD_RANDOM_BOTS);
-    stmt->SetData(0, inworldTime);
-    stmt->SetData(1, "logout");
-    stmt->SetData(2, bot->GetGUID().GetCounter());
-    PlayerbotsDatabase.Execute(stmt);
+    SetEventValidIn(bot->GetGUID().GetCounter(), "bot_delete", randomTime);
+    SetEventValidIn(bot->GetGUID().GetCounter(), "logout", inworldTime);
 
     // teleport to a random inn for bot level
     botAI->Reset(true);
@@ -2176,11 +2172,41 @@ void RandomPlayerbotMgr::GetBots()
     if (!currentBots.empty())
         return;
 
+    uint32 maxAllowedBotCount = GetEventValue(0, "bot_count");
+
+    // With the whole table preloaded the "add" events are looked up in memory, ordered by guid.
+    if (eventCachePreloaded)
+    {
+        EventId const add = GetEventId("add");
+
+        std::vector<uint32> bots;
+        for (auto const& [bot, cache] : eventCache)
+        {
+            if (bot)
+                bots.push_back(bot);
+        }
+
+        std::sort(bots.begin(), bots.end());
+
+        for (uint32 bot : bots)
+        {
+            if (CachedEvent* e = FindEvent(bot, add); e && e->value)
+                currentBots.push_back(bot);
+
+            if (currentBots.size() >= maxAllowedBotCount)
+                break;
+        }
+
+        return;
+    }
+
+    // The query below reads the table, journaled "add" events must be in it.
+    FlushEventJournal();
+
     PlayerbotsDatabasePreparedStatement* stmt =
         PlayerbotsDatabase.GetPreparedStatement(PLAYERBOTS_SEL_RANDOM_BOTS_BY_OWNER_AND_EVENT);
     stmt->SetData(0, 0);
     stmt->SetData(1, "add");
-    uint32 maxAllowedBotCount = GetEventValue(0, "bot_count");
     if (PreparedQueryResult result = PlayerbotsDatabase.Query(stmt))
     {
         do
@@ -2196,35 +2222,89 @@ void RandomPlayerbotMgr::GetBots()
     }
 }
 
-std::vector<uint32> RandomPlayerbotMgr::GetBgBots(uint32 bracket)
+EventId RandomPlayerbotMgr::GetEventId(std::string const& event)
 {
-    // if (!currentBgBots.empty()) return currentBgBots;
+    {
+        std::shared_lock<std::shared_mutex> lock(eventNamesLock);
+        auto const itr = eventIds.find(event);
+        if (itr != eventIds.end())
+            return itr->second;
+    }
 
-    std::vector<uint32> BgBots;
+    std::unique_lock<std::shared_mutex> lock(eventNamesLock);
+    auto const [itr, inserted] = eventIds.try_emplace(event, eventNames.size());
+    if (inserted)
+        eventNames.push_back(event);
 
-    PlayerbotsDatabasePreparedStatement* stmt =
-        PlayerbotsDatabase.GetPreparedStatement(PLAYERBOTS_SEL_RANDOM_BOTS_BY_EVENT_AND_VALUE);
-    stmt->SetData(0, "bg");
-    stmt->SetData(1, bracket);
-    if (PreparedQueryResult result = PlayerbotsDatabase.Query(stmt))
+    return itr->second;
+}
+
+std::string const& RandomPlayerbotMgr::GetEventName(EventId event)
+{
+    std::shared_lock<std::shared_mutex> lock(eventNamesLock);
+    return eventNames[event];
+}
+
+void RandomPlayerbotMgr::PreloadEventCache()
+{
+    uint32 const oldMSTime = getMSTime();
+
+    // "add" rows are deleted at startup, skip them instead of racing the async delete.
+    QueryResult result = PlayerbotsDatabase.Query(
+        "SELECT bot, event, value, time, validIn, data FROM playerbots_random_bots "
+        "WHERE owner = 0 AND event <> 'add'");
+
+    std::unordered_map<uint32, BotEventCache> preloaded;
+    uint32 count = 0;
+
+    if (result)
     {
         do
         {
             Field* fields = result->Fetch();
-            uint32 bot = fields[0].Get<uint32>();
-            BgBots.push_back(bot);
+
+            BotEventCache& cache = preloaded[fields[0].Get<uint32>()];
+            cache.loaded = true;
+
+            CachedEvent& e = cache.events.emplace_back();
+            e.id = GetEventId(fields[1].Get<std::string>());
+            e.value = fields[2].Get<uint32>();
+            e.lastChangeTime = fields[3].Get<uint32>();
+            e.validIn = fields[4].Get<uint32>();
+            e.data = fields[5].Get<std::string>();
+
+            ++count;
         } while (result->NextRow());
     }
 
-    return BgBots;
+    // Bots already read or written before Init keep their cache, it is newer than the table.
+    for (auto& [bot, cache] : preloaded)
+        eventCache.try_emplace(bot, std::move(cache));
+
+    // Every row is in memory now, a bot without a cache entry has no events.
+    eventCachePreloaded = true;
+
+    std::size_t eventNameCount;
+    {
+        std::shared_lock<std::shared_mutex> lock(eventNamesLock);
+        eventNameCount = eventNames.size();
+    }
+
+    LOG_INFO("playerbots", ">> Loaded {} random bot events of {} bots ({} event names) in {} ms", count,
+             preloaded.size(), eventNameCount, GetMSTimeDiffToNow(oldMSTime));
 }
 
 CachedEvent* RandomPlayerbotMgr::FindEvent(uint32 bot, std::string const& event)
+{
+    return FindEvent(bot, GetEventId(event));
+}
+
+CachedEvent* RandomPlayerbotMgr::FindEvent(uint32 bot, EventId event)
 {
     BotEventCache& cache = eventCache[bot];
 
-    // Load once
-    if (!cache.loaded)
+    // Load once, only taken for bots PreloadEventCache did not run for
+    if (!cache.loaded && !eventCachePreloaded)
     {
         cache.events.clear();
 
@@ -2239,33 +2319,31 @@ CachedEvent* RandomPlayerbotMgr::FindEvent(uint32 bot, std::string const& event)
             {
                 Field* fields = result->Fetch();
 
-                CachedEvent e;
+                CachedEvent& e = cache.events.emplace_back();
+                e.id = GetEventId(fields[0].Get<std::string>());
                 e.value = fields[1].Get<uint32>();
                 e.lastChangeTime = fields[2].Get<uint32>();
                 e.validIn = fields[3].Get<uint32>();
                 e.data = fields[4].Get<std::string>();
-
-                cache.events.emplace(fields[0].Get<std::string>(), std::move(e));
             } while (result->NextRow());
         }
-
-        cache.loaded = true;
     }
 
-    auto it = cache.events.find(event);
-    if (it == cache.events.end())
-        return nullptr;
+    cache.loaded = true;
 
-    CachedEvent& e = it->second;
+    CachedEvent* e = cache.Find(event);
+    if (!e)
+        return nullptr;
 
     // remove expired events
-    if (e.validIn && (NowSeconds() - e.lastChangeTime) >= e.validIn && event != "specNo" && event != "specLink")
+    if (e->validIn && (NowSeconds() - e->lastChangeTime) >= e->validIn && event != specNoEventId &&
+        event != specLinkEventId)
     {
-        cache.events.erase(it);
+        cache.Erase(event);
         return nullptr;
     }
 
-    return &e;
+    return e;
 }
 
 bool RandomPlayerbotMgr::IsSpecPvp(uint32 bot, uint8 cls)
@@ -2297,52 +2375,146 @@ std::string RandomPlayerbotMgr::GetEventData(uint32 bot, std::string const& even
 uint32 RandomPlayerbotMgr::SetEventValue(uint32 bot, std::string const& event, uint32 value, uint32 validIn,
                                          std::string const& data)
 {
-    PlayerbotsDatabaseTransaction trans = PlayerbotsDatabase.BeginTransaction();
+    EventId const id = GetEventId(event);
 
-    PlayerbotsDatabasePreparedStatement* stmt =
-        PlayerbotsDatabase.GetPreparedStatement(PLAYERBOTS_DEL_RANDOM_BOTS_BY_OWNER_AND_EVENT);
-    stmt->SetData(0, 0);
-    stmt->SetData(1, bot);
-    stmt->SetData(2, event.c_str());
-    trans->Append(stmt);
+    // Update in-memory cache, the database row follows with the next journal flush
+    BotEventCache& cache = eventCache[bot];
+    cache.loaded = true;
+
+    JournalEvent(bot, id);
 
-    if (value)
+    if (!value)
+    {
+        cache.Erase(id);
+        return 0;
+    }
+
+    CachedEvent* e = cache.Find(id);
+    if (!e)  // create-on-write is OK here
     {
+        e = &cache.events.emplace_back();
+        e->id = id;
+    }
+
+    e->value = value;
+    e->lastChangeTime = NowSeconds();
+    e->validIn = validIn;
+    e->data = data;
+
+    return value;
+}
+
+void RandomPlayerbotMgr::SetEventValidIn(uint32 bot, std::string const& event, uint32 validIn)
+{
+    EventId const id = GetEventId(event);
+    if (CachedEvent* e = FindEvent(bot, id))
+    {
+        e->validIn = validIn;
+        JournalEvent(bot, id);
+    }
+}
+
+void RandomPlayerbotMgr::JournalEvent(uint32 bot, EventId event)
+{
+    ++eventJournalStats.writes;
+
+    eventJournal.insert((uint64(bot) << 32) | event);
+
+    // Flushed on the next update so the cache change right after the call is part of it.
+    if (!sPlayerbotAIConfig.eventJournalFlushInterval ||
+        eventJournal.size() >= sPlayerbotAIConfig.eventJournalMaxSize)
+        eventJournalTimer = sPlayerbotAIConfig.eventJournalFlushInterval;
+}
+
+void RandomPlayerbotMgr::UpdateEventJournal(uint32 diff)
+{
+    eventJournalTimer += diff;
+    if (eventJournalTimer >= sPlayerbotAIConfig.eventJournalFlushInterval)
+        FlushEventJournal();
+}
+
+void RandomPlayerbotMgr::FlushEventJournal()
+{
+    eventJournalTimer = 0;
+
+    if (eventJournal.empty())
+        return;
+
+    PlayerbotsDatabaseTransaction trans = PlayerbotsDatabase.BeginTransaction();
+
+    for (uint64 const key : eventJournal)
+    {
+        uint32 const bot = key >> 32;
+        EventId const event = key & 0xFFFFFFFF;
+        std::string const& name = GetEventName(event);
+
+        PlayerbotsDatabasePreparedStatement* stmt =
+            PlayerbotsDatabase.GetPreparedStatement(PLAYERBOTS_DEL_RANDOM_BOTS_BY_OWNER_AND_EVENT);
+        stmt->SetData(0, 0);
+        stmt->SetData(1, bot);
+        stmt->SetData(2, name.c_str());
+        trans->Append(stmt);
+
+        ++eventJournalStats.rows;
+
+        auto const cacheItr = eventCache.find(bot);
+        if (cacheItr == eventCache.end())
+            continue;
+
+        CachedEvent const* e = cacheItr->second.Find(event);
+        if (!e)
+            continue;
+
         stmt = PlayerbotsDatabase.GetPreparedStatement(PLAYERBOTS_INS_RANDOM_BOTS);
         stmt->SetData(0, 0);
         stmt->SetData(1, bot);
-        stmt->SetData(2, NowSeconds());
-        stmt->SetData(3, validIn);
-        stmt->SetData(4, event.c_str());
-        stmt->SetData(5, value);
+        stmt->SetData(2, e->lastChangeTime);
+        stmt->SetData(3, e->validIn);
+        stmt->SetData(4, name.c_str());
+        stmt->SetData(5, e->value);
 
-        if (!data.empty())
-            stmt->SetData(6, data.c_str());
+        if (!e->data.empty())
+            stmt->SetData(6, e->data.c_str());
         else
             stmt->SetData(6);  // NULL
 
         trans->Append(stmt);
     }
 
-    PlayerbotsDatabase.CommitTransaction(trans);
+    // Always committed synchronously: an async commit still queued behind a later flush would write its older
+    // snapshot of an event over the newer row. Reads of the table (GetBots) and shutdown need the rows too.
+    PlayerbotsDatabase.DirectCommitTransaction(trans);
 
-    // Update in-memory cache
-    BotEventCache& cache = eventCache[bot];
-    cache.loaded = true;
+    ++eventJournalStats.flushes;
 
-    if (!value)
-    {
-        cache.events.erase(event);
-        return 0;
-    }
+    eventJournal.clear();
+}
 
-    CachedEvent& e = cache.events[event];  // create-on-write is OK here
-    e.value = value;
-    e.lastChangeTime = NowSeconds();
-    e.validIn = validIn;
-    e.data = data;
+void RandomPlayerbotMgr::QueueLogin(std::shared_ptr<PlayerbotLoginQueryHolder> holder)
+{
+    loginReady.push_back(std::move(holder));
+}
 
-    return value;
+void RandomPlayerbotMgr::UpdateLoginPipeline()
+{
+    if (loginReady.empty())
+        return;
+
+    // Additive increase, multiplicative decrease: a slow world update halves the rate at once, every
+    // update under the limit lets one more bot in, up to the bots handled per interval.
+    if (sWorldUpdateTime.GetAverageUpdateTime() > sPlayerbotAIConfig.randomBotLoginMaxUpdateTime)
+        loginStats.admitPerUpdate = std::max(1u, loginStats.admitPerUpdate / 2);
+    else if (loginStats.admitPerUpdate < sPlayerbotAIConfig.randomBotsPerInterval)
+        ++loginStats.admitPerUpdate;
+
+    for (uint32 i = 0; i < loginStats.admitPerUpdate && !loginReady.empty(); ++i)
+    {
+        std::shared_ptr<PlayerbotLoginQueryHolder> holder = std::move(loginReady.front());
+        loginReady.pop_front();
+
+        HandlePlayerBotLoginCallback(*holder);
+        ++loginStats.admitted;
+    }
 }
 
 uint32 RandomPlayerbotMgr::GetValue(uint32 bot, std::string const& type) { return GetEventValue(bot, type); }
@@ -2384,6 +2556,7 @@ bool RandomPlayerbotMgr::HandlePlayerbotConsoleCommand(ChatHandler* /*handler*/,
     {
         PlayerbotsDatabase.Execute(PlayerbotsDatabase.GetPreparedStatement(PLAYERBOTS_DEL_RANDOM_BOTS));
         sRandomPlayerbotMgr.eventCache.clear();
+        sRandomPlayerbotMgr.eventJournal.clear();
         LOG_INFO("playerbots", "Random bots were reset for all players. Please restart the Server.");
         return true;
     }
@@ -2541,6 +2714,13 @@ void RandomPlayerbotMgr::OnBotLoginInternal(Player* const bot)
         if (playerBots.size() == sRandomPlayerbotMgr.GetMaxAllowedBotCount())
         {
             _isBotLogging = false;
+
+            if (loginStats.startTime && !loginStats.fullTime)
+            {
+                loginStats.fullTime = std::max(1u, getMSTimeDiff(loginStats.startTime, getMSTime()));
+                LOG_INFO("playerbots", "{} bots logged in after {}s ({:.1f} bots/s)", playerBots.size(),
+                         loginStats.fullTime / 1000, playerBots.size() * 1000.0f / loginStats.fullTime);
+            }
         }
     }
 
@@ -2894,6 +3074,18 @@ void RandomPlayerbotMgr::PrintStats()
 
     LOG_INFO("playerbots", "Bots engine:", dead);
     LOG_INFO("playerbots", "    Non-combat: {}, Combat: {}, Dead: {}", engine_noncombat, engine_combat, engine_dead);
+
+    LOG_INFO("playerbots", "Bots event journal:");
+    LOG_INFO("playerbots", "    Changes: {}, Rows written: {}, Transactions: {} ({} saved), Pending: {}",
+             eventJournalStats.writes, eventJournalStats.rows, eventJournalStats.flushes,
+             eventJournalStats.writes - std::min(eventJournalStats.writes, eventJournalStats.flushes),
+             eventJournal.size());
+
+    LOG_INFO("playerbots", "Bots login pipeline:");
+    LOG_INFO("playerbots", "    Admitted: {}, Loading: {}, Ready: {}, Admit per update: {}, Time to full: {}",
+             loginStats.admitted, botLoading.size() - std::min(botLoading.size(), loginReady.size()),
+             loginReady.size(), loginStats.admitPerUpdate,
+             loginStats.fullTime ? std::to_string(loginStats.fullTime / 1000) + "s" : "-");
 }
 
 double RandomPlayerbotMgr::GetBuyMultiplier(Player* bot)
@@ -3046,6 +3238,8 @@ void RandomPlayerbotMgr::Remove(Player* bot)
     uint32 botId = owner.GetCounter();
     eventCache.erase(botId);
 
+    std::erase_if(eventJournal, [botId](uint64 key) { return (key >> 32) == botId; });
+
     LogoutPlayerBot(owner);
 }
 
@@ -7,6 +7,9 @@
 #ifndef PLAYERBOTS_RANDOMPLAYERBOTMGR_H
 #define PLAYERBOTS_RANDOMPLAYERBOTMGR_H
 
+#include <deque>
+#include <shared_mutex>
+
 #include "NewRpgInfo.h"
 #include "ObjectGuid.h"
 #include "PlayerbotMgr.h"
@@ -48,8 +51,12 @@ class ChatHandler;
 class PerfMonitorOperation;
 class WorldLocation;
 
+// Event names are interned to small ids on first use, see RandomPlayerbotMgr::GetEventId.
+typedef uint32 EventId;
+
 struct CachedEvent
 {
+    EventId id = 0;
     uint32 value = 0;
     uint32 lastChangeTime = 0;
     uint32 validIn = 0;
@@ -58,10 +65,53 @@ struct CachedEvent
     bool IsEmpty() const { return !lastChangeTime; }
 };
 
+// A bot only carries a handful of events, scanning them by id is cheaper than hashing names.
+// Pointers returned by Find stay valid until the events of the bot change.
 struct BotEventCache
 {
     bool loaded = false;
-    std::unordered_map<std::string, CachedEvent> events;
+    std::vector<CachedEvent> events;
+
+    CachedEvent* Find(EventId id)
+    {
+        for (CachedEvent& e : events)
+        {
+            if (e.id == id)
+                return &e;
+        }
+
+        return nullptr;
+    }
+
+    void Erase(EventId id)
+    {
+        for (auto itr = events.begin(); itr != events.end(); ++itr)
+        {
+            if (itr->id == id)
+            {
+                *itr = std::move(events.back());
+                events.pop_back();
+                return;
+            }
+        }
+    }
+};
+
+// Counters of the write-behind event journal (see RandomPlayerbotMgr::FlushEventJournal).
+struct EventJournalStats
+{
+    uint64 writes = 0;   // event changes, each one was a transaction before the journal
+    uint64 rows = 0;     // (bot, event) rows written, repeated changes between two flushes count once
+    uint64 flushes = 0;  // transactions committed
+};
+
+// Counters of the random bot login pipeline (see RandomPlayerbotMgr::UpdateLoginPipeline).
+struct LoginPipelineStats
+{
+    uint64 admitted = 0;       // loaded bots that entered the world
+    uint32 startTime = 0;      // getMSTime() of the first login, 0 before
+    uint32 fullTime = 0;       // ms from the first login until the bot count was first reached, 0 before
+    uint32 admitPerUpdate = 1; // current admission rate
 };
 
 // https://gist.github.com/bradley219/5373998
@@ -143,6 +193,13 @@ public:
     void SetValue(Player* bot, std::string const& type, uint32 value, std::string const& data = "");
     bool IsSpecPvp(uint32 bot, uint8 cls);
     void Remove(Player* bot);
+    // eventCache is the source of truth, changed events are journaled and written in batches.
+    void UpdateEventJournal(uint32 diff);
+    void FlushEventJournal();
+    // Login holders of random bots are loaded ahead and queued here, UpdateLoginPipeline admits them
+    // into the world at a rate driven by the world update time.
+    void QueueLogin(std::shared_ptr<PlayerbotLoginQueryHolder> holder);
+    void UpdateLoginPipeline();
     ObjectGuid GetBattleMasterGUID(Player* bot, BattlegroundTypeId bgTypeId);
     CreatureData const* GetCreatureDataByEntry(uint32 entry);
     void LoadBattleMastersCache();
@@ -204,6 +261,9 @@ private:
         this->BgCheckTimer = 0;
         this->LfgCheckTimer = 0;
         this->PlayersCheckTimer = 0;
+
+        specNoEventId = GetEventId("specNo");
+        specLinkEventId = GetEventId("specLink");
     }
 
     ~RandomPlayerbotMgr() = default;
@@ -220,13 +280,18 @@ private:
     bool _isBotInitializing = true;
     bool _isBotLogging = true;
     NewRpgStatistic rpgStasticTotal;
+    EventId GetEventId(std::string const& event);
+    std::string const& GetEventName(EventId event);
+    void PreloadEventCache();
     CachedEvent* FindEvent(uint32 bot, std::string const& event);
+    CachedEvent* FindEvent(uint32 bot, EventId event);
     uint32 GetEventValue(uint32 bot, std::string const& event);
     std::string GetEventData(uint32 bot, std::string const& event);
     uint32 SetEventValue(uint32 bot, std::string const& event, uint32 value, uint32 validIn,
                          std::string const& data = "");
+    void JournalEvent(uint32 bot, EventId event);
+    void SetEventValidIn(uint32 bot, std::string const& event, uint32 validIn);
     void GetBots();
-    std::vector<uint32> GetBgBots(uint32 bracket);
     time_t BgCheckTimer;
     time_t LfgCheckTimer;
     time_t PlayersCheckTimer;
@@ -246,7 +311,19 @@ private:
     // std::map<uint32, std::vector<WorldLocation>> rpgLocsCache;
     std::map<uint32, std::map<uint32, std::vector<WorldLocation>>> rpgLocsCacheLevel;
     std::map<TeamId, std::map<BattlegroundTypeId, std::vector<uint32>>> BattleMastersCache;
+    // Interned from map threads too (trade discounts), a deque keeps returned names valid while it grows.
+    std::unordered_map<std::string, EventId> eventIds;
+    std::deque<std::string> eventNames;
+    std::shared_mutex eventNamesLock;
+    EventId specNoEventId = 0;    // kept past validIn, see FindEvent
+    EventId specLinkEventId = 0;
     std::unordered_map<uint32, BotEventCache> eventCache;
+    bool eventCachePreloaded = false;
+    std::unordered_set<uint64> eventJournal;  // (bot << 32) | event id
+    uint32 eventJournalTimer = 0;
+    EventJournalStats eventJournalStats;
+    std::deque<std::shared_ptr<PlayerbotLoginQueryHolder>> loginReady;
+    LoginPipelineStats loginStats;
     std::list<uint32> currentBots;
     uint32 bgBotsCount;
     uint32 playersLevel;
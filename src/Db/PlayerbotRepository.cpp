@@ -6,11 +6,16 @@
 
 #include "PlayerbotRepository.h"
 #include "AiObjectContext.h"
+#include "PlayerbotAIConfig.h"
+#include "Playerbots.h"
 
 void PlayerbotRepository::Load(PlayerbotAI* botAI)
 {
     ObjectGuid::LowType guid = botAI->GetBot()->GetGUID().GetCounter();
 
+    BotState state;
+    uint32 strategyRows = 0;
+
     PlayerbotsDatabasePreparedStatement* stmt = PlayerbotsDatabase.GetPreparedStatement(PLAYERBOTS_SEL_DB_STORE);
     stmt->SetData(0, guid);
     if (PreparedQueryResult result = PlayerbotsDatabase.Query(stmt))
@@ -26,46 +31,162 @@ void PlayerbotRepository::Load(PlayerbotAI* botAI)
                 values.push_back(value);
             else if (key == "co")
             {
+                state.co = value;
+                ++strategyRows;
                 botAI->ClearStrategies(BOT_STATE_COMBAT);
                 botAI->ChangeStrategy("+chat", BOT_STATE_COMBAT);
                 botAI->ChangeStrategy(value, BOT_STATE_COMBAT);
             }
             else if (key == "nc")
             {
+                state.nc = value;
+                ++strategyRows;
                 botAI->ClearStrategies(BOT_STATE_NON_COMBAT);
                 botAI->ChangeStrategy("+chat", BOT_STATE_NON_COMBAT);
                 botAI->ChangeStrategy(value, BOT_STATE_NON_COMBAT);
             }
             else if (key == "dead")
+            {
+                state.dead = value;
+                ++strategyRows;
                 botAI->ChangeStrategy(value, BOT_STATE_DEAD);
+            }
         } while (result->NextRow());
 
         botAI->GetAiObjectContext()->GetUntypedValue("outfit list");
 
         botAI->GetAiObjectContext()->Load(values);
+
+        state.values = std::move(values);
     }
+
+    // Save writes all three strategy rows, anything else is not a state Save can diff against.
+    std::lock_guard<std::mutex> lock(stateMutex);
+    if (strategyRows == 3)
+        savedStates[guid] = std::move(state);
+    else
+        savedStates.erase(guid);
 }
 
 void PlayerbotRepository::Save(PlayerbotAI* botAI)
 {
     ObjectGuid::LowType guid = botAI->GetBot()->GetGUID().GetCounter();
 
-    Reset(botAI);
+    BotState state;
+    state.values = botAI->GetAiObjectContext()->Save();
+    state.co = FormatStrategies("co", botAI->GetStrategies(BOT_STATE_COMBAT));
+    state.nc = FormatStrategies("nc", botAI->GetStrategies(BOT_STATE_NON_COMBAT));
+    state.dead = FormatStrategies("dead", botAI->GetStrategies(BOT_STATE_DEAD));
 
-    PlayerbotsDatabasePreparedStatement* deleteStatement =
-        PlayerbotsDatabase.GetPreparedStatement(PLAYERBOTS_DEL_DB_STORE);
-    deleteStatement->SetData(0, guid);
-    PlayerbotsDatabase.Execute(deleteStatement);
+    // Without a known state all rows of the bot are replaced, otherwise only the changed keys.
+    bool known = false;
+    bool valuesChanged = true;
+    bool coChanged = true;
+    bool ncChanged = true;
+    bool deadChanged = true;
 
-    std::vector<std::string> data = botAI->GetAiObjectContext()->Save();
-    for (std::vector<std::string>::iterator i = data.begin(); i != data.end(); ++i)
     {
-        SaveValue(guid, "value", *i);
+        std::lock_guard<std::mutex> lock(stateMutex);
+
+        auto itr = savedStates.find(guid);
+        if (itr != savedStates.end())
+        {
+            BotState& saved = itr->second;
+            known = true;
+            valuesChanged = saved.values != state.values;
+            coChanged = saved.co != state.co;
+            ncChanged = saved.nc != state.nc;
+            deadChanged = saved.dead != state.dead;
+
+            if (!valuesChanged && !coChanged && !ncChanged && !deadChanged)
+                return;
+
+            saved = state;
+        }
+        else
+            savedStates.emplace(guid, state);
     }
 
-    SaveValue(guid, "co", FormatStrategies("co", botAI->GetStrategies(BOT_STATE_COMBAT)));
-    SaveValue(guid, "nc", FormatStrategies("nc", botAI->GetStrategies(BOT_STATE_NON_COMBAT)));
-    SaveValue(guid, "dead", FormatStrategies("dead", botAI->GetStrategies(BOT_STATE_DEAD)));
+    PlayerbotsDatabaseTransaction trans = PlayerbotsDatabase.BeginTransaction();
+
+    if (!known)
+    {
+        PlayerbotsDatabasePreparedStatement* stmt = PlayerbotsDatabase.GetPreparedStatement(PLAYERBOTS_DEL_DB_STORE);
+        stmt->SetData(0, guid);
+        trans->Append(stmt);
+    }
+    else
+    {
+        std::ostringstream keys;
+        if (valuesChanged)
+            keys << "'value',";
+        if (coChanged)
+            keys << "'co',";
+        if (ncChanged)
+            keys << "'nc',";
+        if (deadChanged)
+            keys << "'dead',";
+
+        std::string keyList = keys.str();
+        keyList.pop_back();
+
+        std::ostringstream del;
+        del << "DELETE FROM playerbots_db_store WHERE guid = " << guid << " AND `key` IN (" << keyList << ")";
+        trans->Append(del.str());
+    }
+
+    // All changed rows go in one multi-row insert.
+    std::ostringstream insert;
+    if (valuesChanged)
+    {
+        for (std::string const& value : state.values)
+            AppendValue(insert, guid, "value", value);
+    }
+
+    if (coChanged)
+        AppendValue(insert, guid, "co", state.co);
+    if (ncChanged)
+        AppendValue(insert, guid, "nc", state.nc);
+    if (deadChanged)
+        AppendValue(insert, guid, "dead", state.dead);
+
+    std::string const rows = insert.str();
+    if (!rows.empty())
+        trans->Append("INSERT INTO playerbots_db_store (guid, `key`, value) VALUES " + rows);
+
+    PlayerbotsDatabase.CommitTransaction(trans);
+}
+
+void PlayerbotRepository::ScheduleSave(PlayerbotAI* botAI)
+{
+    ObjectGuid guid = botAI->GetBot()->GetGUID();
+
+    std::lock_guard<std::mutex> lock(scheduleMutex);
+    if (scheduledBots.insert(guid).second)
+        scheduledSaves.push_back(guid);
+}
+
+void PlayerbotRepository::Update()
+{
+    std::vector<ObjectGuid> guids;
+
+    {
+        std::lock_guard<std::mutex> lock(scheduleMutex);
+        while (!scheduledSaves.empty() && guids.size() < sPlayerbotAIConfig.botStateSavesPerTick)
+        {
+            guids.push_back(scheduledSaves.front());
+            scheduledBots.erase(scheduledSaves.front());
+            scheduledSaves.pop_front();
+        }
+    }
+
+    // Bots that logged out meanwhile were saved by the logout itself.
+    for (ObjectGuid const& guid : guids)
+    {
+        Player* bot = ObjectAccessor::FindPlayer(guid);
+        if (PlayerbotAI* botAI = bot ? GET_PLAYERBOT_AI(bot) : nullptr)
+            Save(botAI);
+    }
 }
 
 std::string const PlayerbotRepository::FormatStrategies(std::string const /*type*/, std::vector<std::string> strategies)
@@ -85,13 +206,17 @@ void PlayerbotRepository::Reset(PlayerbotAI* botAI)
     PlayerbotsDatabasePreparedStatement* stmt = PlayerbotsDatabase.GetPreparedStatement(PLAYERBOTS_DEL_DB_STORE);
     stmt->SetData(0, guid);
     PlayerbotsDatabase.Execute(stmt);
+
+    std::lock_guard<std::mutex> lock(stateMutex);
+    savedStates.erase(guid);
 }
 
-void PlayerbotRepository::SaveValue(uint32 guid, std::string const key, std::string const value)
+void PlayerbotRepository::AppendValue(std::ostringstream& out, uint32 guid, std::string const key, std::string value)
 {
-    PlayerbotsDatabasePreparedStatement* stmt = PlayerbotsDatabase.GetPreparedStatement(PLAYERBOTS_INS_DB_STORE);
-    stmt->SetData(0, guid);
-    stmt->SetData(1, key);
-    stmt->SetData(2, value);
-    PlayerbotsDatabase.Execute(stmt);
+    PlayerbotsDatabase.EscapeString(value);
+
+    if (out.tellp() > 0)
+        out << ",";
+
+    out << "(" << guid << ",'" << key << "','" << value << "')";
 }
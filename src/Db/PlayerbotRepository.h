@@ -8,7 +8,12 @@
 #define PLAYERBOTS_PLAYERBOTREPOSITORY_H
 
 #include <cstdint>
+#include <deque>
+#include <mutex>
+#include <sstream>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "PlayerbotAI.h"
@@ -23,11 +28,24 @@ public:
         return instance;
     }
 
+    // Writes the rows that differ from the last saved or loaded state of the bot, nothing when unchanged.
     void Save(PlayerbotAI* botAI);
+    // Queues a Save, Update runs AiPlayerbot.BotStateSavesPerTick of them per world update.
+    void ScheduleSave(PlayerbotAI* botAI);
+    void Update();
     void Load(PlayerbotAI* botAI);
     void Reset(PlayerbotAI* botAI);
 
 private:
+    // Rows of playerbots_db_store for one bot, grouped by key.
+    struct BotState
+    {
+        std::vector<std::string> values;
+        std::string co;
+        std::string nc;
+        std::string dead;
+    };
+
     PlayerbotRepository() = default;
     ~PlayerbotRepository() = default;
 
@@ -37,8 +55,15 @@ private:
     PlayerbotRepository(PlayerbotRepository&&) = delete;
     PlayerbotRepository& operator=(PlayerbotRepository&&) = delete;
 
-    void SaveValue(uint32_t guid, std::string const key, std::string const value);
+    void AppendValue(std::ostringstream& out, uint32_t guid, std::string const key, std::string value);
     std::string const FormatStrategies(std::string const type, std::vector<std::string> strategies);
+
+    std::mutex stateMutex;
+    std::unordered_map<uint32_t, BotState> savedStates;
+
+    std::mutex scheduleMutex;
+    std::deque<ObjectGuid> scheduledSaves;
+    std::unordered_set<ObjectGuid> scheduledBots;
 };
 
 #endif
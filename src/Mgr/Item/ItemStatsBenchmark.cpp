@@ -0,0 +1,128 @@
+/*
+ * This file is part of the mod-playerbots module for AzerothCore. See AUTHORS file for Copyright
+ * information; released under GNU GPL v2 license, redistribute/modify under version 2 of the License,
+ * or (at your option) any later version.
+ */
+
+#include "ItemStatsBenchmark.h"
+
+#include <chrono>
+
+#include "Chat.h"
+#include "ItemStatsCache.h"
+#include "ObjectMgr.h"
+#include "Playerbots.h"
+#include "StatsWeightCalculator.h"
+
+namespace
+{
+    constexpr CollectorType BENCH_COLLECTOR_TYPES[] = {CollectorType::MELEE_DMG, CollectorType::MELEE_TANK,
+                                                       CollectorType::RANGED, CollectorType::SPELL_DMG,
+                                                       CollectorType::SPELL_HEAL};
+
+    uint64 GetElapsed(std::chrono::steady_clock::time_point begin)
+    {
+        return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - begin)
+            .count();
+    }
+}
+
+bool ItemStatsBenchmark::HandleConsoleCommand(ChatHandler* handler, char const* args)
+{
+    Player* player = handler->getSelectedPlayer();
+    if (!player || !GET_PLAYERBOT_AI(player))
+    {
+        handler->PSendSysMessage("Select a bot to run the item stats benchmark on.");
+        return true;
+    }
+
+    uint32 passes = args && *args ? std::max(1, atoi(args)) : 3;
+    BenchScores(handler, player, passes);
+    return true;
+}
+
+void ItemStatsBenchmark::BenchScores(ChatHandler* handler, Player* bot, uint32 passes)
+{
+    std::vector<ItemTemplate const*> items;
+    for (auto const& itr : *sObjectMgr->GetItemTemplateStore())
+    {
+        ItemTemplate const* proto = &itr.second;
+        if (proto->InventoryType != INVTYPE_NON_EQUIP &&
+            (proto->Class == ITEM_CLASS_ARMOR || proto->Class == ITEM_CLASS_WEAPON))
+            items.push_back(proto);
+    }
+
+    uint8 cls = bot->getClass();
+
+    // Any non zero weights will do, only the time is compared.
+    StatsVector weights;
+    for (uint32 i = 0; i < STATS_TYPE_MAX; ++i)
+        weights[i] = 1.0f + i * 0.1f;
+
+    float legacyScore = 0.0f;
+    auto begin = std::chrono::steady_clock::now();
+
+    for (uint32 pass = 0; pass < passes; ++pass)
+    {
+        for (CollectorType type : BENCH_COLLECTOR_TYPES)
+        {
+            for (ItemTemplate const* proto : items)
+            {
+                StatsCollector collector(type, cls);
+                collector.CollectItemStats(proto);
+                for (uint32 i = 0; i < STATS_TYPE_MAX; ++i)
+                    legacyScore += weights[i] * collector.stats[i];
+            }
+        }
+    }
+
+    uint64 legacyTime = GetElapsed(begin);
+
+    uint32 cachedBefore = sItemStatsCache.GetSize();
+    float cachedScore = 0.0f;
+    begin = std::chrono::steady_clock::now();
+
+    for (CollectorType type : BENCH_COLLECTOR_TYPES)
+    {
+        for (ItemTemplate const* proto : items)
+            cachedScore += sItemStatsCache.GetItemStats(type, cls, proto).Dot(weights);
+    }
+
+    uint64 fillTime = GetElapsed(begin);
+    begin = std::chrono::steady_clock::now();
+
+    for (uint32 pass = 0; pass < passes; ++pass)
+    {
+        for (CollectorType type : BENCH_COLLECTOR_TYPES)
+        {
+            for (ItemTemplate const* proto : items)
+                cachedScore += sItemStatsCache.GetItemStats(type, cls, proto).Dot(weights);
+        }
+    }
+
+    uint64 cachedTime = GetElapsed(begin);
+
+    StatsWeightCalculator calculator(bot);
+    float calculatorScore = 0.0f;
+    begin = std::chrono::steady_clock::now();
+
+    for (uint32 pass = 0; pass < passes; ++pass)
+    {
+        for (ItemTemplate const* proto : items)
+            calculatorScore += calculator.CalculateItem(proto->ItemId);
+    }
+
+    uint64 calculatorTime = GetElapsed(begin);
+
+    uint64 scores = uint64(items.size()) * std::size(BENCH_COLLECTOR_TYPES) * passes;
+    handler->PSendSysMessage("{} equippable items, {} collector types, {} passes ({} scores).", items.size(),
+                             std::size(BENCH_COLLECTOR_TYPES), passes, scores);
+    handler->PSendSysMessage("Collected per score: {}ms, {:.3f}us per score (sum {:.0f}).", legacyTime / 1000,
+                             float(legacyTime) / scores, legacyScore);
+    handler->PSendSysMessage("Cache fill: {}ms for {} new vectors, cached: {}ms, {:.3f}us per score (sum {:.0f}).",
+                             fillTime / 1000, sItemStatsCache.GetSize() - cachedBefore, cachedTime / 1000,
+                             float(cachedTime) / scores, cachedScore);
+    handler->PSendSysMessage("StatsWeightCalculator of the bot: {}ms, {:.3f}us per item (sum {:.0f}).",
+                             calculatorTime / 1000, float(calculatorTime) / (uint64(items.size()) * passes),
+                             calculatorScore);
+}
@@ -0,0 +1,28 @@
+/*
+ * This file is part of the mod-playerbots module for AzerothCore. See AUTHORS file for Copyright
+ * information; released under GNU GPL v2 license, redistribute/modify under version 2 of the License,
+ * or (at your option) any later version.
+ */
+
+#ifndef PLAYERBOTS_ITEMSTATSBENCHMARK_H
+#define PLAYERBOTS_ITEMSTATSBENCHMARK_H
+
+#include "Common.h"
+
+class ChatHandler;
+class Player;
+
+// Item scoring benchmark, run against the selected bot from .playerbots debug stats.
+class ItemStatsBenchmark
+{
+public:
+    static bool HandleConsoleCommand(ChatHandler* handler, char const* args);
+
+private:
+    // Scores every equippable item for every collector type (the role each spec maps to), collecting the
+    // stats per item as StatsWeightCalculator did before ItemStatsCache and through the cache, then runs the
+    // selected bot's own StatsWeightCalculator over all items.
+    static void BenchScores(ChatHandler* handler, Player* bot, uint32 passes);
+};
+
+#endif
@@ -0,0 +1,68 @@
+/*
+ * This file is part of the mod-playerbots module for AzerothCore. See AUTHORS file for Copyright
+ * information; released under GNU GPL v2 license, redistribute/modify under version 2 of the License,
+ * or (at your option) any later version.
+ */
+
+#include "ItemStatsCache.h"
+
+#include <bit>
+#include <mutex>
+
+StatsVector const& ItemStatsCache::GetItemStats(CollectorType type, uint8 cls, ItemTemplate const* proto)
+{
+    return Get(type, cls, proto->ItemId, 0, proto);
+}
+
+StatsVector const& ItemStatsCache::GetRandomPropertyStats(CollectorType type, uint8 cls, uint32 itemId,
+                                                          int32 randomPropertyId)
+{
+    return Get(type, cls, itemId, randomPropertyId, nullptr);
+}
+
+uint32 ItemStatsCache::GetSize()
+{
+    uint32 size = 0;
+    for (Table& table : tables)
+    {
+        std::shared_lock<std::shared_mutex> lock(table.mutex);
+        size += table.vectors.size();
+    }
+
+    return size;
+}
+
+ItemStatsCache::Table& ItemStatsCache::GetTable(CollectorType type, uint8 cls)
+{
+    uint32 typeIndex = std::min<uint32>(std::countr_zero(static_cast<uint32>(type)), COLLECTOR_TYPES - 1);
+    return tables[typeIndex * MAX_CLASSES + cls % MAX_CLASSES];
+}
+
+StatsVector const& ItemStatsCache::Get(CollectorType type, uint8 cls, uint32 itemId, int32 randomPropertyId,
+                                       ItemTemplate const* proto)
+{
+    Table& table = GetTable(type, cls);
+    uint64 key = (uint64(itemId) << 32) | uint32(randomPropertyId);
+
+    {
+        std::shared_lock<std::shared_mutex> lock(table.mutex);
+        auto itr = table.vectors.find(key);
+        if (itr != table.vectors.end())
+            return *itr->second;
+    }
+
+    // Collected outside the lock; two threads racing for the same item collect the same stats and the
+    // second insert is dropped.
+    std::unique_ptr<StatsVector> vector = std::make_unique<StatsVector>();
+    StatsCollector collector(type, cls);
+    if (proto)
+        collector.CollectItemStats(proto);
+    else
+        collector.CollectRandomPropertyStats(randomPropertyId, itemId);
+
+    for (uint32 i = 0; i < STATS_TYPE_MAX; ++i)
+        vector->stats[i] = collector.stats[i];
+
+    std::unique_lock<std::shared_mutex> lock(table.mutex);
+    return *table.vectors.try_emplace(key, std::move(vector)).first->second;
+}
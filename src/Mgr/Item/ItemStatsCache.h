@@ -0,0 +1,94 @@
+/*
+ * This file is part of the mod-playerbots module for AzerothCore. See AUTHORS file for Copyright
+ * information; released under GNU GPL v2 license, redistribute/modify under version 2 of the License,
+ * or (at your option) any later version.
+ */
+
+#ifndef PLAYERBOTS_ITEMSTATSCACHE_H
+#define PLAYERBOTS_ITEMSTATSCACHE_H
+
+#include <array>
+#include <memory>
+#include <shared_mutex>
+#include <unordered_map>
+
+#include "SharedDefines.h"
+#include "StatsCollector.h"
+
+// Collected stats (or stat weights) in a fixed size aligned layout. The entries past STATS_TYPE_MAX stay
+// zero, so sums and dot products always run over whole vector registers and the compiler can vectorize
+// them without reordering a single accumulator.
+struct alignas(32) StatsVector
+{
+    static constexpr uint32 SIZE = 32;
+    static constexpr uint32 LANES = 8;
+
+    float stats[SIZE] = {};
+
+    void Add(StatsVector const& other)
+    {
+        for (uint32 i = 0; i < SIZE; ++i)
+            stats[i] += other.stats[i];
+    }
+
+    float& operator[](uint32 index) { return stats[index]; }
+    float operator[](uint32 index) const { return stats[index]; }
+
+    float Dot(StatsVector const& weights) const
+    {
+        float lanes[LANES] = {};
+        for (uint32 i = 0; i < SIZE; i += LANES)
+        {
+            for (uint32 j = 0; j < LANES; ++j)
+                lanes[j] += stats[i + j] * weights.stats[i + j];
+        }
+
+        float sum = 0.0f;
+        for (uint32 j = 0; j < LANES; ++j)
+            sum += lanes[j];
+
+        return sum;
+    }
+};
+
+static_assert(STATS_TYPE_MAX <= StatsVector::SIZE, "StatsVector is too small for all stat types");
+
+// What StatsCollector gathers from an item only depends on the collector type, the class and the item, so
+// it is collected once per combination and shared by every StatsWeightCalculator. Entries are immutable
+// once published and live as long as the server.
+class ItemStatsCache
+{
+public:
+    static ItemStatsCache& instance()
+    {
+        static ItemStatsCache instance;
+        return instance;
+    }
+
+    // Stats of the item template itself (StatsCollector::CollectItemStats).
+    StatsVector const& GetItemStats(CollectorType type, uint8 cls, ItemTemplate const* proto);
+    // Stats added by a random property (> 0) or random suffix (< 0) rolled on itemId.
+    StatsVector const& GetRandomPropertyStats(CollectorType type, uint8 cls, uint32 itemId, int32 randomPropertyId);
+    uint32 GetSize();
+
+private:
+    struct Table
+    {
+        std::shared_mutex mutex;
+        std::unordered_map<uint64, std::unique_ptr<StatsVector>> vectors;
+    };
+
+    static constexpr uint32 COLLECTOR_TYPES = 5;  // MELEE_DMG .. SPELL_HEAL
+
+    ItemStatsCache() = default;
+
+    Table& GetTable(CollectorType type, uint8 cls);
+    StatsVector const& Get(CollectorType type, uint8 cls, uint32 itemId, int32 randomPropertyId,
+                           ItemTemplate const* proto);
+
+    std::array<Table, COLLECTOR_TYPES * MAX_CLASSES> tables;
+};
+
+#define sItemStatsCache ItemStatsCache::instance()
+
+#endif
@@ -6,9 +6,21 @@
 
 #include "RandomItemMgr.h"
 
+#include <boost/crc.hpp>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <thread>
+#include <tuple>
+
 #include "DBCStores.h"
 #include "ItemTemplate.h"
+#include "PlayerbotFactory.h"
 #include "Playerbots.h"
+#include "StatsWeightCalculator.h"
+#include "World.h"
 
 std::unordered_set<uint32> RandomItemMgr::itemCache;
 
@@ -98,6 +110,39 @@ RandomItemMgr::~RandomItemMgr()
     predicates.clear();
 }
 
+namespace
+{
+    // Item ids per scan range. The ranges do not depend on the number of threads, so neither do the merged
+    // candidate lists nor the checksum of the item cache file.
+    constexpr uint32 ITEM_SCAN_RANGE = 4096;
+
+    // Runs work(0) .. work(count - 1) on the item cache threads. Every call must only change its own data.
+    void RunParallel(uint32 count, std::function<void(uint32)> const& work)
+    {
+        uint32 threads = sPlayerbotAIConfig.itemCacheThreads;
+        if (!threads)
+            threads = std::max(1u, std::thread::hardware_concurrency());
+
+        threads = std::min(threads, count);
+
+        std::atomic<uint32> next{0};
+        auto worker = [&]()
+        {
+            for (uint32 i = next++; i < count; i = next++)
+                work(i);
+        };
+
+        std::vector<std::thread> workers;
+        for (uint32 i = 1; i < threads; ++i)
+            workers.emplace_back(worker);
+
+        worker();
+
+        for (auto& thread : workers)
+            thread.join();
+    }
+}
+
 void RandomItemMgr::Init()
 {
     // Prevent double initialization when the reload command is executed.
@@ -109,15 +154,53 @@ void RandomItemMgr::Init()
     if (m_initialized.exchange(true))
         return;
 
-    BuildCacheItemInfo();
-    // if (!LoadCacheEquip())
-    //     BuildCacheEquip();
-    BuildCacheEquipNew();
-    BuildCacheAmmo();
-    BuildCacheFood();
-    BuildCachePotion();
-    BuildCacheTrade();
-    LoadEnchantmentPool();
+    uint32 const oldMSTime = getMSTime();
+
+    uint32 const checksum = sPlayerbotAIConfig.itemCacheFile.empty() ? 0 : GetItemCacheChecksum();
+    bool const loaded = LoadCacheFile(checksum);
+
+    ItemCacheCandidates candidates;
+    uint32 scanTime = 0;
+    if (!loaded)
+    {
+        ScanItemTemplates(candidates);
+        scanTime = GetMSTimeDiffToNow(oldMSTime);
+    }
+
+    // Every task fills its own caches and only reads data that no longer changes, so they run side by side.
+    std::vector<std::pair<std::string, std::function<void()>>> tasks = {
+        {"item info", [this]() { BuildCacheItemInfo(); }},
+        {"enchantment pool", [this]() { LoadEnchantmentPool(); }}};
+
+    if (loaded)
+        tasks.push_back({"equipment slots", [this]() { BuildCacheEquipSlots(); }});
+    else
+    {
+        tasks.push_back({"equipment", [&]() { BuildCacheEquipNew(candidates.equipment); }});
+        tasks.push_back({"ammo", [&]() { BuildCacheAmmo(candidates.ammo); }});
+        tasks.push_back({"food", [&]() { BuildCacheFood(candidates.food); }});
+        tasks.push_back({"potion", [&]() { BuildCachePotion(candidates.potions); }});
+        tasks.push_back({"trade", [&]() { BuildCacheTrade(candidates.trade); }});
+    }
+
+    std::vector<uint32> taskTimes(tasks.size());
+    RunParallel(tasks.size(),
+                [&](uint32 i)
+                {
+                    uint32 const taskTime = getMSTime();
+                    tasks[i].second();
+                    taskTimes[i] = GetMSTimeDiffToNow(taskTime);
+                });
+
+    if (!loaded)
+        SaveCacheFile(checksum);
+
+    std::string report = loaded ? "loaded from file" : "scan " + std::to_string(scanTime) + " ms";
+    for (uint32 i = 0; i < tasks.size(); ++i)
+        report += ", " + tasks[i].first + " " + std::to_string(taskTimes[i]) + " ms";
+
+    LOG_INFO("server.loading", ">> Item caches ready in {} ms ({})", GetMSTimeDiffToNow(oldMSTime), report);
+    LOG_INFO("server.loading", " ");
 }
 
 void RandomItemMgr::InitAfterAhBot()
@@ -944,6 +1027,156 @@ RandomItemList const& RandomItemMgr::GetEquipmentNew(uint32 level, InventoryType
     return typeItr->second;
 }
 
+RankedEquipment RandomItemMgr::GetBestEquipment(Player* bot, EquipProfile const& profile, uint32 amount)
+{
+    RankedEquipment equipment;
+    std::unique_ptr<StatsWeightCalculator> calculator;
+
+    for (uint8 slot = EQUIPMENT_SLOT_START; slot < EQUIPMENT_SLOT_END; ++slot)
+    {
+        if (slot == EQUIPMENT_SLOT_TABARD || slot == EQUIPMENT_SLOT_BODY)
+            continue;
+
+        equipment[slot] = GetBestEquipment(calculator, bot, profile, slot, amount);
+    }
+
+    return equipment;
+}
+
+RankedItemList RandomItemMgr::GetBestEquipment(Player* bot, EquipProfile const& profile, uint8 slot, uint32 amount)
+{
+    std::unique_ptr<StatsWeightCalculator> calculator;
+    return GetBestEquipment(calculator, bot, profile, slot, amount);
+}
+
+RankedItemList RandomItemMgr::GetBestEquipment(std::unique_ptr<StatsWeightCalculator>& calculator, Player* bot,
+                                               EquipProfile const& profile, uint8 slot, uint32 amount)
+{
+    RankedItemList items;
+    if (slot >= EQUIPMENT_SLOT_END)
+        return items;
+
+    // Same quality fallback as PlayerbotFactory::InitEquipment: lower qualities fill up a short list.
+    uint32 quality = std::min<uint32>(profile.quality, MAX_ITEM_QUALITY - 1);
+    do
+    {
+        for (RankedItem const& item : GetRankedEquipment(calculator, bot, profile, slot, quality))
+        {
+            if (items.size() >= amount)
+                break;
+
+            items.push_back(item);
+        }
+    } while (items.size() < amount && quality-- > ITEM_QUALITY_POOR);
+
+    return items;
+}
+
+RankedItemList const& RandomItemMgr::GetRankedEquipment(std::unique_ptr<StatsWeightCalculator>& calculator,
+                                                        Player* bot, EquipProfile const& profile, uint8 slot,
+                                                        uint32 quality)
+{
+    uint64 const key = profile.GetKey(slot, quality);
+    // The limit only applies above normal quality, lower lists are shared by every limit.
+    uint32 const gearScoreLimit = quality > ITEM_QUALITY_NORMAL ? profile.gearScoreLimit : 0;
+
+    {
+        std::shared_lock<std::shared_mutex> lock(rankedEquipLock);
+        auto itr = rankedEquipCache.find(key);
+        if (itr != rankedEquipCache.end())
+        {
+            auto limitItr = itr->second.find(gearScoreLimit);
+            if (limitItr != itr->second.end())
+                return limitItr->second;
+        }
+    }
+
+    if (!calculator)
+    {
+        calculator = std::make_unique<StatsWeightCalculator>(bot);
+        calculator->SetOverflowPenalty(false);
+        calculator->SetItemSetBonus(false);
+        calculator->SetPvpSpec(profile.pvp);
+    }
+
+    RankedItemList items = BuildRankedEquipment(*calculator, profile, slot, quality);
+
+    // Entries are never removed, so references stay valid after the lock is released.
+    std::unique_lock<std::shared_mutex> lock(rankedEquipLock);
+    return rankedEquipCache[key].try_emplace(gearScoreLimit, std::move(items)).first->second;
+}
+
+RankedItemList RandomItemMgr::BuildRankedEquipment(StatsWeightCalculator& calculator, EquipProfile const& profile,
+                                                   uint8 slot, uint32 quality) const
+{
+    static constexpr uint32 RANKED_EQUIPMENT_SIZE = 50;
+
+    RankedItemList items;
+
+    auto const levelItr = equipSlotCache.find(NormalizeLevel(profile.level));
+    if (levelItr == equipSlotCache.end() || quality >= MAX_ITEM_QUALITY)
+        return items;
+
+    bool const isArmorSlot = slot == EQUIPMENT_SLOT_HEAD || slot == EQUIPMENT_SLOT_SHOULDERS ||
+                             slot == EQUIPMENT_SLOT_CHEST || slot == EQUIPMENT_SLOT_WAIST ||
+                             slot == EQUIPMENT_SLOT_LEGS || slot == EQUIPMENT_SLOT_FEET ||
+                             slot == EQUIPMENT_SLOT_WRISTS || slot == EQUIPMENT_SLOT_HANDS;
+    uint8 const preferredArmorType = PlayerbotFactory::GetPreferredArmorType(profile.clazz);
+    bool const checkGearScore = profile.gearScoreLimit && quality > ITEM_QUALITY_NORMAL;
+
+    calculator.SetExcludeResilience(slot == EQUIPMENT_SLOT_TRINKET1 || slot == EQUIPMENT_SLOT_TRINKET2);
+
+    // Same filters as the candidate search of PlayerbotFactory::InitEquipment.
+    for (uint32 itemId : levelItr->second[slot][quality])
+    {
+        if (sPlayerbotAIConfig.limitGearExpansion && profile.level <= 60 && itemId >= 23728)
+            continue;
+
+        if (sPlayerbotAIConfig.limitGearExpansion && profile.level <= 70 && itemId >= 35570 && itemId != 36737 &&
+            itemId != 37739 && itemId != 37740)
+            continue;
+
+        ItemTemplate const* proto = sObjectMgr->GetItemTemplate(itemId);
+        if (!proto)
+            continue;
+
+        // Filtered before the list is cut to its best items, so capped bots still get a full list.
+        if (checkGearScore &&
+            PlayerbotFactory::CalcMixedGearScore(proto->ItemLevel, proto->Quality) > profile.gearScoreLimit)
+            continue;
+
+        if (proto->Class == ITEM_CLASS_ARMOR && isArmorSlot && proto->SubClass <= ITEM_SUBCLASS_ARMOR_SHIELD &&
+            proto->SubClass != ITEM_SUBCLASS_ARMOR_MISC && proto->SubClass != ITEM_SUBCLASS_ARMOR_BUCKLER &&
+            !(profile.armorMask & (1u << proto->SubClass)))
+            continue;
+
+        if (proto->Class == ITEM_CLASS_WEAPON && !PlayerbotFactory::CanEquipWeapon(proto, profile.clazz))
+            continue;
+
+        if (slot == EQUIPMENT_SLOT_OFFHAND && profile.clazz == CLASS_ROGUE && proto->Class != ITEM_CLASS_WEAPON)
+            continue;
+
+        int32 randomPropertyId = 0;
+        if (proto->RandomProperty || proto->RandomSuffix)
+            randomPropertyId = calculator.PickBestRandomPropertyId(itemId);
+
+        float score = calculator.CalculateItem(itemId, randomPropertyId, slot);
+        if (score > 0.0f && proto->Class == ITEM_CLASS_ARMOR && sPlayerbotAIConfig.preferClassArmorType &&
+            preferredArmorType != 0 && proto->SubClass == preferredArmorType)
+            score *= 3.0f;
+
+        items.push_back({itemId, randomPropertyId, score});
+    }
+
+    std::sort(items.begin(), items.end(),
+              [](RankedItem const& a, RankedItem const& b) { return a.score > b.score; });
+
+    if (items.size() > RANKED_EQUIPMENT_SIZE)
+        items.resize(RANKED_EQUIPMENT_SIZE);
+
+    return items;
+}
+
 uint32 RandomItemMgr::GetRandomItem(uint32 level, RandomItemType type, RandomItemPredicate* predicate) const
 {
     level = NormalizeLevel(level);
@@ -1822,6 +2055,514 @@ void RandomItemMgr::LoadEnchantmentPool()
     LOG_INFO("playerbots", "Loaded {} item enchantment pool rows for bot autogear", count);
 }
 
+namespace
+{
+    // Binary item cache. The list records follow the header, then the item ids of all lists in record order.
+    constexpr uint32 ITEM_CACHE_MAGIC = 0x43494250;  // "PBIC"
+    constexpr uint32 ITEM_CACHE_VERSION = 1;
+
+    enum ItemCacheType : uint32
+    {
+        ITEM_CACHE_EQUIP = 0,  // key: required level, sub key: inventory type
+        ITEM_CACHE_AMMO,       // key: level, sub key: sub class
+        ITEM_CACHE_FOOD,       // key: level bucket, sub key: spell category
+        ITEM_CACHE_POTION,     // key: level, sub key: spell effect
+        ITEM_CACHE_TRADE,      // key: level bucket
+        ITEM_CACHE_MAX
+    };
+
+    struct ItemCacheHeader
+    {
+        uint32 magic;
+        uint32 version;
+        uint32 dataChecksum;  // GetItemCacheChecksum of the data the caches were built from
+        uint32 listCount;
+        uint32 itemCount;
+        uint32 checksum;  // crc32 of everything after the header
+    };
+
+    struct ItemCacheListRecord
+    {
+        uint32 cache;
+        uint32 key;
+        uint32 subKey;
+        uint32 count;
+    };
+
+    static_assert(sizeof(ItemCacheHeader) == 24 && sizeof(ItemCacheListRecord) == 16,
+                  "Item cache records are written as is and must not change size");
+
+    std::string getItemCachePath()
+    {
+        std::string const& fileName = sPlayerbotAIConfig.itemCacheFile;
+        if (fileName.empty() || std::filesystem::path(fileName).is_absolute())
+            return fileName;
+
+        return sWorld->GetDataPath() + fileName;
+    }
+}
+
+// Covers everything the item store builds read: the item fields their filters look at, the spell effects of
+// consumables, the quest rewards and the unobtainable items.
+uint32 RandomItemMgr::GetItemCacheChecksum() const
+{
+    std::vector<ItemTemplate*> const* itemTemplates = sObjectMgr->GetItemTemplateStoreFast();
+    uint32 const ranges = (itemTemplates->size() + ITEM_SCAN_RANGE - 1) / ITEM_SCAN_RANGE;
+
+    std::vector<uint32> rangeChecksums(ranges);
+    RunParallel(ranges,
+                [&](uint32 range)
+                {
+                    boost::crc_32_type crc;
+                    auto add = [&crc](auto value) { crc.process_bytes(&value, sizeof(value)); };
+
+                    uint32 const end = std::min<uint32>(itemTemplates->size(), (range + 1) * ITEM_SCAN_RANGE);
+                    for (uint32 itemId = range * ITEM_SCAN_RANGE; itemId < end; ++itemId)
+                    {
+                        ItemTemplate const* proto = (*itemTemplates)[itemId];
+                        if (!proto)
+                            continue;
+
+                        add(proto->ItemId);
+                        add(proto->Class);
+                        add(proto->SubClass);
+                        add(proto->Quality);
+                        add(proto->InventoryType);
+                        add(proto->RequiredLevel);
+                        add(proto->ItemLevel);
+                        add(proto->Duration);
+                        add(proto->Area);
+                        add(proto->Map);
+                        add(proto->RequiredCityRank);
+                        add(proto->RequiredHonorRank);
+                        add(proto->AllowableClass);
+                        add(proto->AllowableRace);
+                        add(proto->Flags);
+                        add(proto->Bonding);
+                        add(proto->RequiredSkill);
+                        add(proto->Spells[0].SpellId);
+                        add(proto->Spells[0].SpellCategory);
+                        add(proto->Damage[0].DamageMin);
+                        add(proto->GetMaxStackSize());
+                        crc.process_bytes(proto->Name1.data(), proto->Name1.size());
+
+                        if (SpellInfo const* spellInfo = sSpellMgr->GetSpellInfo(proto->Spells[0].SpellId))
+                        {
+                            for (uint8 i = 0; i < MAX_SPELL_EFFECTS; ++i)
+                                add(spellInfo->Effects[i].Effect);
+                        }
+                    }
+
+                    rangeChecksums[range] = crc.checksum();
+                });
+
+    boost::crc_32_type crc;
+    auto add = [&crc](auto value) { crc.process_bytes(&value, sizeof(value)); };
+
+    add(DEFAULT_MAX_LEVEL);
+    for (uint32 rangeChecksum : rangeChecksums)
+        add(rangeChecksum);
+
+    std::vector<Quest const*> quests;
+    for (auto const& [_, quest] : sObjectMgr->GetQuestTemplates())
+        quests.push_back(quest);
+
+    std::sort(quests.begin(), quests.end(),
+              [](Quest const* a, Quest const* b) { return a->GetQuestId() < b->GetQuestId(); });
+
+    for (Quest const* quest : quests)
+    {
+        add(quest->GetQuestId());
+        add(quest->GetQuestLevel());
+        add(quest->IsRepeatable());
+        add(quest->GetRequiredClasses());
+        for (uint32 i = 0; i < quest->GetRewItemsCount(); ++i)
+            add(quest->RewardItemId[i]);
+        for (uint32 i = 0; i < quest->GetRewChoiceItemsCount(); ++i)
+            add(quest->RewardChoiceItemId[i]);
+    }
+
+    for (uint32 itemId : sPlayerbotAIConfig.unobtainableItems)
+        add(itemId);
+
+    return crc.checksum();
+}
+
+bool RandomItemMgr::LoadCacheFile(uint32 checksum)
+{
+    std::string const fileName = getItemCachePath();
+    std::error_code error;
+    if (fileName.empty() || !std::filesystem::exists(fileName, error))
+        return false;
+
+    uint32 const oldMSTime = getMSTime();
+
+    std::ifstream in(fileName, std::ios::binary);
+    std::vector<char> data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    if (data.size() < sizeof(ItemCacheHeader))
+    {
+        LOG_ERROR("playerbots", ">> Item cache file {} is truncated.", fileName);
+        return false;
+    }
+
+    ItemCacheHeader header;
+    std::memcpy(&header, data.data(), sizeof(header));
+    if (header.magic != ITEM_CACHE_MAGIC || header.version != ITEM_CACHE_VERSION)
+    {
+        LOG_ERROR("playerbots", ">> Item cache file {} has an unknown format or version.", fileName);
+        return false;
+    }
+
+    if (header.dataChecksum != checksum)
+    {
+        LOG_INFO("server.loading", ">> Item cache file {} was built from other item data, rebuilding.", fileName);
+        return false;
+    }
+
+    uint64 const expectedSize = sizeof(ItemCacheHeader) + uint64(header.listCount) * sizeof(ItemCacheListRecord) +
+                                uint64(header.itemCount) * sizeof(uint32);
+    if (data.size() != expectedSize)
+    {
+        LOG_ERROR("playerbots", ">> Item cache file {} has a bad size.", fileName);
+        return false;
+    }
+
+    boost::crc_32_type crc;
+    crc.process_bytes(data.data() + sizeof(ItemCacheHeader), data.size() - sizeof(ItemCacheHeader));
+    if (crc.checksum() != header.checksum)
+    {
+        LOG_ERROR("playerbots", ">> Item cache file {} has a bad checksum.", fileName);
+        return false;
+    }
+
+    std::vector<ItemCacheListRecord> records(header.listCount);
+    std::vector<uint32> itemIds(header.itemCount);
+    char const* section = data.data() + sizeof(ItemCacheHeader);
+    std::memcpy(records.data(), section, records.size() * sizeof(ItemCacheListRecord));
+    section += records.size() * sizeof(ItemCacheListRecord);
+    std::memcpy(itemIds.data(), section, itemIds.size() * sizeof(uint32));
+
+    uint64 itemCount = 0;
+    for (ItemCacheListRecord const& record : records)
+    {
+        if (record.cache >= ITEM_CACHE_MAX)
+        {
+            LOG_ERROR("playerbots", ">> Item cache file {} has an unknown cache type.", fileName);
+            return false;
+        }
+
+        itemCount += record.count;
+    }
+
+    if (itemCount != header.itemCount)
+    {
+        LOG_ERROR("playerbots", ">> Item cache file {} has bad list sizes.", fileName);
+        return false;
+    }
+
+    auto next = itemIds.begin();
+    for (ItemCacheListRecord const& record : records)
+    {
+        RandomItemList items(next, next + record.count);
+        next += record.count;
+
+        switch (record.cache)
+        {
+            case ITEM_CACHE_EQUIP:
+                equipCacheNew[record.key][static_cast<InventoryType>(record.subKey)] = std::move(items);
+                break;
+            case ITEM_CACHE_AMMO:
+                ammoCache[record.key][record.subKey] = std::move(items);
+                break;
+            case ITEM_CACHE_FOOD:
+                foodCache[record.key][record.subKey] = std::move(items);
+                break;
+            case ITEM_CACHE_POTION:
+                potionCache[record.key][record.subKey] = std::move(items);
+                break;
+            case ITEM_CACHE_TRADE:
+                tradeCache[record.key] = std::move(items);
+                break;
+        }
+    }
+
+    LOG_INFO("server.loading", ">> Loaded {} item cache lists ({} items) from {} in {} ms", records.size(),
+             itemIds.size(), fileName, GetMSTimeDiffToNow(oldMSTime));
+
+    return true;
+}
+
+void RandomItemMgr::SaveCacheFile(uint32 checksum) const
+{
+    std::string const fileName = getItemCachePath();
+    if (fileName.empty())
+        return;
+
+    std::vector<std::pair<ItemCacheListRecord, RandomItemList const*>> lists;
+    auto addLists = [&lists](uint32 cache, auto const& caches)
+    {
+        for (auto const& [key, byType] : caches)
+        {
+            for (auto const& [subKey, items] : byType)
+                lists.push_back({{cache, key, static_cast<uint32>(subKey), static_cast<uint32>(items.size())}, &items});
+        }
+    };
+
+    addLists(ITEM_CACHE_EQUIP, equipCacheNew);
+    addLists(ITEM_CACHE_AMMO, ammoCache);
+    addLists(ITEM_CACHE_FOOD, foodCache);
+    addLists(ITEM_CACHE_POTION, potionCache);
+    for (auto const& [key, items] : tradeCache)
+        lists.push_back({{ITEM_CACHE_TRADE, key, 0, static_cast<uint32>(items.size())}, &items});
+
+    // Sorted so the same caches always give the same file.
+    std::sort(lists.begin(), lists.end(),
+              [](auto const& a, auto const& b)
+              {
+                  return std::tie(a.first.cache, a.first.key, a.first.subKey) <
+                         std::tie(b.first.cache, b.first.key, b.first.subKey);
+              });
+
+    std::vector<ItemCacheListRecord> records;
+    std::vector<uint32> itemIds;
+    records.reserve(lists.size());
+    for (auto const& [record, items] : lists)
+    {
+        records.push_back(record);
+        itemIds.insert(itemIds.end(), items->begin(), items->end());
+    }
+
+    ItemCacheHeader header = {};
+    header.magic = ITEM_CACHE_MAGIC;
+    header.version = ITEM_CACHE_VERSION;
+    header.dataChecksum = checksum;
+    header.listCount = records.size();
+    header.itemCount = itemIds.size();
+
+    boost::crc_32_type crc;
+    crc.process_bytes(records.data(), records.size() * sizeof(ItemCacheListRecord));
+    crc.process_bytes(itemIds.data(), itemIds.size() * sizeof(uint32));
+    header.checksum = crc.checksum();
+
+    // Write next to the old file and swap, a crash never leaves a half written cache behind.
+    std::string const tmpName = fileName + ".tmp";
+    {
+        std::ofstream out(tmpName, std::ios::binary | std::ios::trunc);
+
+        out.write(reinterpret_cast<char const*>(&header), sizeof(header));
+        out.write(reinterpret_cast<char const*>(records.data()), records.size() * sizeof(ItemCacheListRecord));
+        out.write(reinterpret_cast<char const*>(itemIds.data()), itemIds.size() * sizeof(uint32));
+
+        if (!out)
+        {
+            LOG_ERROR("playerbots", ">> Could not write item cache file {}.", tmpName);
+            return;
+        }
+    }
+
+    std::remove(fileName.c_str());
+    if (std::rename(tmpName.c_str(), fileName.c_str()))
+    {
+        LOG_ERROR("playerbots", ">> Could not replace item cache file {}.", fileName);
+        return;
+    }
+
+    LOG_INFO("server.loading", ">> Saved {} item cache lists ({} items) to {}", records.size(), itemIds.size(),
+             fileName);
+}
+
+void RandomItemMgr::ScanItemTemplates(ItemCacheCandidates& candidates) const
+{
+    uint32 const oldMSTime = getMSTime();
+
+    std::vector<ItemTemplate*> const* itemTemplates = sObjectMgr->GetItemTemplateStoreFast();
+    uint32 const ranges = (itemTemplates->size() + ITEM_SCAN_RANGE - 1) / ITEM_SCAN_RANGE;
+
+    // Every range sorts its own items, the ranges are appended in id order afterwards.
+    std::vector<ItemCacheCandidates> rangeCandidates(ranges);
+    RunParallel(ranges,
+                [&](uint32 range)
+                {
+                    ItemCacheCandidates& rangeItems = rangeCandidates[range];
+
+                    uint32 const end = std::min<uint32>(itemTemplates->size(), (range + 1) * ITEM_SCAN_RANGE);
+                    for (uint32 itemId = range * ITEM_SCAN_RANGE; itemId < end; ++itemId)
+                    {
+                        ItemTemplate const* proto = (*itemTemplates)[itemId];
+                        if (!proto)
+                            continue;
+
+                        if (IsEquipmentCandidate(proto))
+                            rangeItems.equipment.push_back(proto);
+                        else if (IsAmmoCandidate(proto))
+                            rangeItems.ammo.push_back(proto);
+                        else if (IsTradeCandidate(proto))
+                            rangeItems.trade.push_back(proto);
+                        else
+                        {
+                            if (IsFoodCandidate(proto))
+                                rangeItems.food.push_back(proto);
+
+                            if (IsPotionCandidate(proto))
+                                rangeItems.potions.push_back(proto);
+                        }
+                    }
+                });
+
+    for (ItemCacheCandidates& rangeItems : rangeCandidates)
+    {
+        candidates.equipment.insert(candidates.equipment.end(), rangeItems.equipment.begin(),
+                                    rangeItems.equipment.end());
+        candidates.ammo.insert(candidates.ammo.end(), rangeItems.ammo.begin(), rangeItems.ammo.end());
+        candidates.food.insert(candidates.food.end(), rangeItems.food.begin(), rangeItems.food.end());
+        candidates.potions.insert(candidates.potions.end(), rangeItems.potions.begin(), rangeItems.potions.end());
+        candidates.trade.insert(candidates.trade.end(), rangeItems.trade.begin(), rangeItems.trade.end());
+    }
+
+    LOG_INFO("server.loading",
+             ">> Scanned {} item ids: {} equipment, {} ammo, {} food, {} potion and {} trade candidates in {} ms",
+             itemTemplates->size(), candidates.equipment.size(), candidates.ammo.size(), candidates.food.size(),
+             candidates.potions.size(), candidates.trade.size(), GetMSTimeDiffToNow(oldMSTime));
+}
+
+bool RandomItemMgr::IsEquipmentCandidate(ItemTemplate const* proto) const
+{
+    // skip non-equipment classes
+    if (proto->Class != ITEM_CLASS_WEAPON && proto->Class != ITEM_CLASS_ARMOR)
+        return false;
+
+    // skip legendary, artifact and heirloom quality
+    if (proto->Quality > ITEM_QUALITY_EPIC)
+        return false;
+
+    // skip items that fail basic validatoin (level, duration, flags, etc.)
+    if (!IsValidItem(proto))
+        return false;
+
+    // skip items with no viable equip slot
+    return GetViableSlots(static_cast<InventoryType>(proto->InventoryType)) != nullptr;
+}
+
+bool RandomItemMgr::IsAmmoCandidate(ItemTemplate const* proto)
+{
+    // skip non-projectile items
+    if (proto->Class != ITEM_CLASS_PROJECTILE)
+        return false;
+
+    // skip non-arrow and non-bullet subclasses
+    if (proto->SubClass != ITEM_SUBCLASS_ARROW && proto->SubClass != ITEM_SUBCLASS_BULLET)
+        return false;
+
+    // skip items that fail basic validatoin (level, duration, flags, etc.)
+    if (!IsValidItem(proto))
+        return false;
+
+    // skip items with no required level
+    // NOTE: This filters only three items: 3464 (Feathered Arrow), 3465
+    //       (Exploding Shot), and 4960 (Flash Pellet). In theory we could
+    //       set RequiredLevel = ItemLevel and use that instead.
+    if (proto->RequiredLevel == 0)
+        return false;
+
+    // skip items with no damage value
+    return proto->Damage[0].DamageMin != 0.0f;
+}
+
+bool RandomItemMgr::IsFoodCandidate(ItemTemplate const* proto)
+{
+    // skip non-consumable items
+    if (proto->Class != ITEM_CLASS_CONSUMABLE)
+        return false;
+
+    // skip non-food and non-consumable subclasses
+    if (proto->SubClass != ITEM_SUBCLASS_CONSUMABLE && proto->SubClass != ITEM_SUBCLASS_FOOD)
+        return false;
+
+    // skip bound items
+    if (proto->Bonding != NO_BIND)
+        return false;
+
+    // skip items that fail basic validatoin (level, duration, flags, etc.)
+    if (!IsValidItem(proto))
+        return false;
+
+    // skip items requiring a profession skill
+    if (proto->RequiredSkill)
+        return false;
+
+    // skip items that are neither food nor drink
+    if (proto->Spells[0].SpellCategory != SPELL_CATEGORY_FOOD &&
+        proto->Spells[0].SpellCategory != SPELL_CATEGORY_DRINK)
+        return false;
+
+    SpellInfo const* spellInfo = sSpellMgr->GetSpellInfo(proto->Spells[0].SpellId);
+    if (!spellInfo)
+        return false;
+
+    // skip items with spell effect inebriate (alcohol)
+    return !spellInfo->HasEffect(SPELL_EFFECT_INEBRIATE);
+}
+
+bool RandomItemMgr::IsPotionCandidate(ItemTemplate const* proto)
+{
+    // skip non-consumable items
+    if (proto->Class != ITEM_CLASS_CONSUMABLE)
+        return false;
+
+    // skip non-potion and non-flask subclasses
+    if (proto->SubClass != ITEM_SUBCLASS_POTION && proto->SubClass != ITEM_SUBCLASS_FLASK)
+        return false;
+
+    // skip bound items
+    if (proto->Bonding != NO_BIND)
+        return false;
+
+    // skip items that fail basic validatoin (level, duration, flags, etc.)
+    if (!IsValidItem(proto))
+        return false;
+
+    // skip items requiring a profession skill
+    if (proto->RequiredSkill)
+        return false;
+
+    SpellInfo const* spellInfo = sSpellMgr->GetSpellInfo(proto->Spells[0].SpellId);
+    if (!spellInfo)
+        return false;
+
+    // skip potions whose primary effect is not heal or energize
+    if (spellInfo->Effects[EFFECT_0].Effect != SPELL_EFFECT_HEAL &&
+        spellInfo->Effects[EFFECT_0].Effect != SPELL_EFFECT_ENERGIZE)
+        return false;
+
+    // do not accept potions/flasks with more than one spell effects, only
+    // first one effect (EFFECT_0) should be set and eq. heal/energize
+    for (uint8 i = EFFECT_1; i < MAX_SPELL_EFFECTS; ++i)
+    {
+        if (spellInfo->Effects[i].Effect != 0)
+            return false;
+    }
+
+    return true;
+}
+
+bool RandomItemMgr::IsTradeCandidate(ItemTemplate const* proto)
+{
+    // skip non-trade-goods
+    if (proto->Class != ITEM_CLASS_TRADE_GOODS)
+        return false;
+
+    // skip bound items
+    if (proto->Bonding != NO_BIND)
+        return false;
+
+    // skip items that fail basic validatoin (level, duration, flags, etc.)
+    if (!IsValidItem(proto))
+        return false;
+
+    // skip items requiring a profession skill
+    return !proto->RequiredSkill;
+}
+
 void RandomItemMgr::BuildCacheRandomItem()
 {
     uint32 const oldMSTime = getMSTime();
@@ -1965,7 +2706,7 @@ void RandomItemMgr::BuildCacheEquip()
     LOG_INFO("server.loading", " ");
 }
 
-void RandomItemMgr::BuildCacheEquipNew()
+void RandomItemMgr::BuildCacheEquipNew(std::vector<ItemTemplate const*> const& items)
 {
     uint32 const oldMSTime = getMSTime();
 
@@ -1984,22 +2725,10 @@ void RandomItemMgr::BuildCacheEquipNew()
         if (!proto)
             return;
 
-        // skip non-equipment classes
-        if (proto->Class != ITEM_CLASS_WEAPON && proto->Class != ITEM_CLASS_ARMOR)
-            return;
-
-        // skip legendary, artifact and heirloom quality
-        if (proto->Quality > ITEM_QUALITY_EPIC)
-            return;
-
-        // skip items that fail basic validatoin (level, duration, flags, etc.)
-        if (!IsValidItem(proto))
+        if (!IsEquipmentCandidate(proto))
             return;
 
-        // skip items with no viable equip slot
         InventoryType invType = static_cast<InventoryType>(proto->InventoryType);
-        if (!GetViableSlots(invType))
-            return;
 
         uint32 const requiredLevel = static_cast<uint32>(
             std::max(0, std::max(static_cast<int32>(proto->RequiredLevel), itemQuestLevel)));
@@ -2009,7 +2738,16 @@ void RandomItemMgr::BuildCacheEquipNew()
         ++count;
     };
 
+    // Quests in id order, so an item rewarded by several quests always gets the same level.
+    std::vector<Quest const*> quests;
+    quests.reserve(sObjectMgr->GetQuestTemplates().size());
     for (auto const& [_, quest] : sObjectMgr->GetQuestTemplates())
+        quests.push_back(quest);
+
+    std::sort(quests.begin(), quests.end(),
+              [](Quest const* a, Quest const* b) { return a->GetQuestId() < b->GetQuestId(); });
+
+    for (Quest const* quest : quests)
     {
         // skip repeatable quests
         if (quest->IsRepeatable())
@@ -2031,40 +2769,53 @@ void RandomItemMgr::BuildCacheEquipNew()
             processQuestItem(quest->RewardChoiceItemId[i], questLevel);
     }
 
-    ItemTemplateContainer const* itemTemplates = sObjectMgr->GetItemTemplateStore();
-    for (auto const& itr : *itemTemplates)
+    for (ItemTemplate const* proto : items)
     {
-        ItemTemplate const* proto = &itr.second;
-
-        // skip non-equipment classes
-        if (proto->Class != ITEM_CLASS_WEAPON && proto->Class != ITEM_CLASS_ARMOR)
-            continue;
-
-        // skip legendary, artifact and heirloom quality
-        if (proto->Quality > ITEM_QUALITY_EPIC)
-            continue;
-
         // skip items already added from quests
         if (questItemIds.contains(proto->ItemId))
             continue;
 
-        // skip items that fail basic validatoin (level, duration, flags, etc.)
-        if (!IsValidItem(proto))
-            continue;
-
-        // skip items with no viable equip slot
         InventoryType invType = static_cast<InventoryType>(proto->InventoryType);
-        if (!GetViableSlots(invType))
-            continue;
-
         equipCacheNew[proto->RequiredLevel][invType].push_back(proto->ItemId);
         ++count;
     }
 
+    BuildCacheEquipSlots();
+
     LOG_INFO("server.loading", ">> Cached total {} equipment entries in {} ms", count, GetMSTimeDiffToNow(oldMSTime));
     LOG_INFO("server.loading", " ");
 }
 
+void RandomItemMgr::BuildCacheEquipSlots()
+{
+    // Merge the factory level window (the level and the nine below) and the inventory types of every slot,
+    // so GetBestEquipment ranks a single list per slot and quality.
+    for (uint32 level = 1; level <= DEFAULT_MAX_LEVEL; ++level)
+    {
+        EquipBySlot& bySlot = equipSlotCache[level];
+        uint32 const delta = std::min(level, 10u);
+
+        for (uint8 slot = EQUIPMENT_SLOT_START; slot < EQUIPMENT_SLOT_END; ++slot)
+        {
+            std::vector<InventoryType> const invTypes =
+                PlayerbotFactory::GetPossibleInventoryTypeListBySlot(static_cast<EquipmentSlots>(slot));
+
+            for (uint32 requiredLevel = level; requiredLevel > level - delta; --requiredLevel)
+            {
+                for (InventoryType invType : invTypes)
+                {
+                    for (uint32 itemId : GetEquipmentNew(requiredLevel, invType))
+                    {
+                        ItemTemplate const* proto = sObjectMgr->GetItemTemplate(itemId);
+                        if (proto && proto->Quality < MAX_ITEM_QUALITY)
+                            bySlot[slot][proto->Quality].push_back(itemId);
+                    }
+                }
+            }
+        }
+    }
+}
+
 void RandomItemMgr::BuildCacheItemInfo()
 {
     // load weightscales
@@ -2482,7 +3233,7 @@ void RandomItemMgr::BuildCacheItemInfo()
     PlayerbotsDatabase.CommitTransaction(trans);*/
 }
 
-void RandomItemMgr::BuildCacheAmmo()
+void RandomItemMgr::BuildCacheAmmo(std::vector<ItemTemplate const*> const& items)
 {
     uint32 const oldMSTime = getMSTime();
 
@@ -2498,38 +3249,10 @@ void RandomItemMgr::BuildCacheAmmo()
     };
 
     std::vector<AmmoEntry> ammoItems;
-
-    ItemTemplateContainer const* itemTemplates = sObjectMgr->GetItemTemplateStore();
-    for (auto const& itr : *itemTemplates)
-    {
-        ItemTemplate const* proto = &itr.second;
-
-        // skip non-projectile items
-        if (proto->Class != ITEM_CLASS_PROJECTILE)
-            continue;
-
-        // skip non-arrow and non-bullet subclasses
-        if (proto->SubClass != ITEM_SUBCLASS_ARROW && proto->SubClass != ITEM_SUBCLASS_BULLET)
-            continue;
-
-        // skip items that fail basic validatoin (level, duration, flags, etc.)
-        if (!IsValidItem(proto))
-            continue;
-
-        // skip items with no required level
-        // NOTE: This filters only three items: 3464 (Feathered Arrow), 3465
-        //       (Exploding Shot), and 4960 (Flash Pellet). In theory we could
-        //       set RequiredLevel = ItemLevel and use that instead.
-        if (proto->RequiredLevel == 0)
-            continue;
-
-        // skip items with no damage value
-        if (proto->Damage[0].DamageMin == 0.0f)
-            continue;
-
-        ammoItems.push_back({itr.first, proto->SubClass, proto->ItemLevel, proto->RequiredLevel,
-                            proto->GetMaxStackSize()});
-    }
+    ammoItems.reserve(items.size());
+    for (ItemTemplate const* proto : items)
+        ammoItems.push_back({proto->ItemId, proto->SubClass, proto->ItemLevel, proto->RequiredLevel,
+                             proto->GetMaxStackSize()});
 
     // we want higher stack sizes first, then higher item levels, to ensure bots
     // use the best available ammo for their current level
@@ -2558,7 +3281,7 @@ void RandomItemMgr::BuildCacheAmmo()
     LOG_INFO("server.loading", " ");
 }
 
-void RandomItemMgr::BuildCacheFood()
+void RandomItemMgr::BuildCacheFood(std::vector<ItemTemplate const*> const& items)
 {
     uint32 const oldMSTime = getMSTime();
 
@@ -2567,44 +3290,8 @@ void RandomItemMgr::BuildCacheFood()
     constexpr uint32 MAX_FOOD_LEVEL_DELTA = 10;
 
     uint32 count = 0;
-    ItemTemplateContainer const* itemTemplates = sObjectMgr->GetItemTemplateStore();
-    for (auto const& itr : *itemTemplates)
+    for (ItemTemplate const* proto : items)
     {
-        ItemTemplate const* proto = &itr.second;
-
-        // skip non-consumable items
-        if (proto->Class != ITEM_CLASS_CONSUMABLE)
-            continue;
-
-        // skip non-food and non-consumable subclasses
-        if (proto->SubClass != ITEM_SUBCLASS_CONSUMABLE && proto->SubClass != ITEM_SUBCLASS_FOOD)
-            continue;
-
-        // skip bound items
-        if (proto->Bonding != NO_BIND)
-            continue;
-
-        // skip items that fail basic validatoin (level, duration, flags, etc.)
-        if (!IsValidItem(proto))
-            continue;
-
-        // skip items requiring a profession skill
-        if (proto->RequiredSkill)
-            continue;
-
-        // skip items that are neither food nor drink
-        if (proto->Spells[0].SpellCategory != SPELL_CATEGORY_FOOD &&
-            proto->Spells[0].SpellCategory != SPELL_CATEGORY_DRINK)
-            continue;
-
-        SpellInfo const* spellInfo = sSpellMgr->GetSpellInfo(proto->Spells[0].SpellId);
-        if (!spellInfo)
-            continue;
-
-        // skip items with spell effect inebriate (alcohol)
-        if (spellInfo->HasEffect(SPELL_EFFECT_INEBRIATE))
-            continue;
-
         uint32 requiredLevel = proto->RequiredLevel;
         uint32 category = proto->Spells[0].SpellCategory;
         for (uint32 level = 1; level <= DEFAULT_MAX_LEVEL; level += 10)
@@ -2620,7 +3307,7 @@ void RandomItemMgr::BuildCacheFood()
                     continue;
             }
 
-            foodCache[(level - 1) / 10][category].push_back(itr.first);
+            foodCache[(level - 1) / 10][category].push_back(proto->ItemId);
             ++count;
         }
     }
@@ -2629,7 +3316,7 @@ void RandomItemMgr::BuildCacheFood()
     LOG_INFO("server.loading", " ");
 }
 
-void RandomItemMgr::BuildCachePotion()
+void RandomItemMgr::BuildCachePotion(std::vector<ItemTemplate const*> const& items)
 {
     uint32 const oldMSTime = getMSTime();
 
@@ -2638,55 +3325,9 @@ void RandomItemMgr::BuildCachePotion()
     constexpr uint32 MAX_POTION_LEVEL_DELTA = 13;
 
     uint32 count = 0;
-    ItemTemplateContainer const* itemTemplates = sObjectMgr->GetItemTemplateStore();
-    for (auto const& itr : *itemTemplates)
+    for (ItemTemplate const* proto : items)
     {
-        ItemTemplate const* proto = &itr.second;
-
-        // skip non-consumable items
-        if (proto->Class != ITEM_CLASS_CONSUMABLE)
-            continue;
-
-        // skip non-potion and non-flask subclasses
-        if (proto->SubClass != ITEM_SUBCLASS_POTION && proto->SubClass != ITEM_SUBCLASS_FLASK)
-            continue;
-
-        // skip bound items
-        if (proto->Bonding != NO_BIND)
-            continue;
-
-        // skip items that fail basic validatoin (level, duration, flags, etc.)
-        if (!IsValidItem(proto))
-            continue;
-
-        // skip items requiring a profession skill
-        if (proto->RequiredSkill)
-            continue;
-
         SpellInfo const* spellInfo = sSpellMgr->GetSpellInfo(proto->Spells[0].SpellId);
-        if (!spellInfo)
-            continue;
-
-        // skip potions whose primary effect is not heal or energize
-        if (spellInfo->Effects[EFFECT_0].Effect != SPELL_EFFECT_HEAL &&
-            spellInfo->Effects[EFFECT_0].Effect != SPELL_EFFECT_ENERGIZE)
-            continue;
-
-        // do not accept potions/flasks with more than one spell effects, only
-        // first one effect (EFFECT_0) should be set and eq. heal/energize
-        bool hasOtherEffects = false;
-        for (uint8 i = EFFECT_1; i < MAX_SPELL_EFFECTS; ++i)
-        {
-            if (spellInfo->Effects[i].Effect != 0)
-            {
-                hasOtherEffects = true;
-                break;
-            }
-        }
-
-        // skip potions with secondary spell effects
-        if (hasOtherEffects)
-            continue;
 
         uint32 requiredLevel = proto->RequiredLevel;
         uint32 effect = spellInfo->Effects[EFFECT_0].Effect;
@@ -2696,7 +3337,7 @@ void RandomItemMgr::BuildCachePotion()
             if (level > MAX_POTION_LEVEL_DELTA && level - requiredLevel > MAX_POTION_LEVEL_DELTA)
                 break;
 
-            potionCache[level][effect].push_back(itr.first);
+            potionCache[level][effect].push_back(proto->ItemId);
             ++count;
         }
     }
@@ -2705,7 +3346,7 @@ void RandomItemMgr::BuildCachePotion()
     LOG_INFO("server.loading", " ");
 }
 
-void RandomItemMgr::BuildCacheTrade()
+void RandomItemMgr::BuildCacheTrade(std::vector<ItemTemplate const*> const& items)
 {
     uint32 const oldMSTime = getMSTime();
 
@@ -2714,27 +3355,8 @@ void RandomItemMgr::BuildCacheTrade()
     constexpr uint32 MAX_TRADE_LEVEL_DELTA = 10;
 
     uint32 count = 0;
-    ItemTemplateContainer const* itemTemplates = sObjectMgr->GetItemTemplateStore();
-    for (auto const& itr : *itemTemplates)
+    for (ItemTemplate const* proto : items)
     {
-        ItemTemplate const* proto = &itr.second;
-
-        // skip non-trade-goods
-        if (proto->Class != ITEM_CLASS_TRADE_GOODS)
-            continue;
-
-        // skip bound items
-        if (proto->Bonding != NO_BIND)
-            continue;
-
-        // skip items that fail basic validatoin (level, duration, flags, etc.)
-        if (!IsValidItem(proto))
-            continue;
-
-        // skip items requiring a profession skill
-        if (proto->RequiredSkill)
-            continue;
-
         uint32 requiredLevel = proto->RequiredLevel;
         for (uint32 level = 1; level <= DEFAULT_MAX_LEVEL; level += 10)
         {
@@ -2753,7 +3375,7 @@ void RandomItemMgr::BuildCacheTrade()
                     continue;
             }
 
-            tradeCache[(level - 1) / 10].push_back(itr.first);
+            tradeCache[(level - 1) / 10].push_back(proto->ItemId);
             ++count;
         }
     }
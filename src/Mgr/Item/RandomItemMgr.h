@@ -10,6 +10,8 @@
 #include <array>
 #include <atomic>
 #include <map>
+#include <memory>
+#include <shared_mutex>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -19,6 +21,7 @@
 #include "ItemTemplate.h"
 
 class ChatHandler;
+class StatsWeightCalculator;
 
 struct ItemTemplate;
 
@@ -160,6 +163,39 @@ namespace std
 typedef std::unordered_map<BotEquipKey, RandomItemList> BotEquipCache;
 typedef std::unordered_map<InventoryType, RandomItemList> EquipByInventoryType;
 typedef std::unordered_map<uint32, EquipByInventoryType> BotEquipCacheNew;
+// Candidates of the factory level window of a level, by equipment slot and item quality.
+typedef std::array<std::array<RandomItemList, MAX_ITEM_QUALITY>, EQUIPMENT_SLOT_END> EquipBySlot;
+
+// Bot description for RandomItemMgr::GetBestEquipment. Ranked lists are shared by all bots with the same
+// profile, so it holds everything the candidate filter and the scores depend on.
+struct EquipProfile
+{
+    uint8 clazz = 0;
+    uint8 spec = 0;             // talent tab
+    uint32 level = 0;
+    uint32 quality = 0;         // best quality looked at, lower qualities fill up short lists
+    bool pvp = false;
+    uint32 armorMask = 0;       // 1 << ITEM_SUBCLASS_ARMOR_* the bot has the skill for
+    uint32 gearScoreLimit = 0;  // ranked separately per limit, 0 for no limit
+
+    uint64 GetKey(uint8 slot, uint32 itemQuality) const
+    {
+        return (static_cast<uint64>(clazz) << 56) | (static_cast<uint64>(spec) << 48) |
+               (static_cast<uint64>(level & 0xFFu) << 40) | (static_cast<uint64>(itemQuality & 0xFFu) << 32) |
+               (static_cast<uint64>(pvp) << 31) | (static_cast<uint64>(slot & 0x1Fu) << 24) |
+               (armorMask & 0xFFFFFFu);
+    }
+};
+
+struct RankedItem
+{
+    uint32 itemId;
+    int32 randomPropertyId;
+    float score;
+};
+
+typedef std::vector<RankedItem> RankedItemList;
+typedef std::array<RankedItemList, EQUIPMENT_SLOT_END> RankedEquipment;
 
 class RandomItemMgr
 {
@@ -193,6 +229,12 @@ public:
 
     [[nodiscard]] RandomItemList const& GetEquipment(uint32 level, uint8 clazz, uint8 slot, uint32 quality) const;
     [[nodiscard]] RandomItemList const& GetEquipmentNew(uint32 level, InventoryType invType) const;
+    // Best candidates of every equipment slot for a bot profile, highest score first, at most amount per
+    // slot. The lists of a profile are scored with the first asking bot's StatsWeightCalculator (without
+    // overflow and item set bonuses, which depend on the gear already worn) and reused for later bots.
+    [[nodiscard]] RankedEquipment GetBestEquipment(Player* bot, EquipProfile const& profile, uint32 amount);
+    [[nodiscard]] RankedItemList GetBestEquipment(Player* bot, EquipProfile const& profile, uint8 slot,
+                                                  uint32 amount);
     [[nodiscard]] uint32 GetRandomItem(uint32 level, RandomItemType type, RandomItemPredicate* predicate = nullptr) const;
     [[nodiscard]] uint32 GetAmmo(uint32 level, uint32 subClass) const;
     [[nodiscard]] uint32 GetRandomPotion(uint32 level, uint32 effect) const;
@@ -219,19 +261,42 @@ private:
     void InitViableSlots();
     void InitWeightLinks();
 
+    // Items each cache build of Init looks at, in item id order.
+    struct ItemCacheCandidates
+    {
+        std::vector<ItemTemplate const*> equipment;
+        std::vector<ItemTemplate const*> ammo;
+        std::vector<ItemTemplate const*> food;
+        std::vector<ItemTemplate const*> potions;
+        std::vector<ItemTemplate const*> trade;
+    };
+
     [[nodiscard]] bool LoadCacheEquip();
     [[nodiscard]] bool LoadCacheRandomItem();
     [[nodiscard]] bool LoadCacheRarity();
     void LoadEnchantmentPool();
 
+    // Binary snapshot of the caches built from the item store (see AiPlayerbot.ItemCacheFile).
+    [[nodiscard]] uint32 GetItemCacheChecksum() const;
+    [[nodiscard]] bool LoadCacheFile(uint32 checksum);
+    void SaveCacheFile(uint32 checksum) const;
+
+    void ScanItemTemplates(ItemCacheCandidates& candidates) const;
+    [[nodiscard]] bool IsEquipmentCandidate(ItemTemplate const* proto) const;
+    [[nodiscard]] static bool IsAmmoCandidate(ItemTemplate const* proto);
+    [[nodiscard]] static bool IsFoodCandidate(ItemTemplate const* proto);
+    [[nodiscard]] static bool IsPotionCandidate(ItemTemplate const* proto);
+    [[nodiscard]] static bool IsTradeCandidate(ItemTemplate const* proto);
+
     void BuildCacheRandomItem();
     void BuildCacheEquip();
-    void BuildCacheEquipNew();
+    void BuildCacheEquipNew(std::vector<ItemTemplate const*> const& items);
+    void BuildCacheEquipSlots();
     void BuildCacheItemInfo();
-    void BuildCacheAmmo();
-    void BuildCacheFood();
-    void BuildCachePotion();
-    void BuildCacheTrade();
+    void BuildCacheAmmo(std::vector<ItemTemplate const*> const& items);
+    void BuildCacheFood(std::vector<ItemTemplate const*> const& items);
+    void BuildCachePotion(std::vector<ItemTemplate const*> const& items);
+    void BuildCacheTrade(std::vector<ItemTemplate const*> const& items);
     void BuildCacheRarity();
 
     void DebugCacheRandomItem();
@@ -241,6 +306,13 @@ private:
     [[nodiscard]] bool CanEquipItem(ItemTemplate const* proto, uint32 level) const;
     [[nodiscard]] std::vector<EquipmentSlots> const* GetViableSlots(InventoryType invType) const;
     [[nodiscard]] uint32 NormalizeLevel(uint32 level) const;
+    [[nodiscard]] RankedItemList GetBestEquipment(std::unique_ptr<StatsWeightCalculator>& calculator, Player* bot,
+                                                  EquipProfile const& profile, uint8 slot, uint32 amount);
+    [[nodiscard]] RankedItemList const& GetRankedEquipment(std::unique_ptr<StatsWeightCalculator>& calculator,
+                                                           Player* bot, EquipProfile const& profile, uint8 slot,
+                                                           uint32 quality);
+    [[nodiscard]] RankedItemList BuildRankedEquipment(StatsWeightCalculator& calculator, EquipProfile const& profile,
+                                                      uint8 slot, uint32 quality) const;
 
 private:
     RandomItemMgr();
@@ -259,6 +331,10 @@ private:
 
     BotEquipCache equipCache;
     BotEquipCacheNew equipCacheNew;
+    std::unordered_map<uint32, EquipBySlot> equipSlotCache;
+    // By EquipProfile::GetKey, then by the gear score limit the list was filtered with.
+    std::unordered_map<uint64, std::unordered_map<uint32, RankedItemList>> rankedEquipCache;
+    std::shared_mutex rankedEquipLock;
 
     std::unordered_map<uint32, RandomItemCache> randomItemCache;
     std::unordered_map<RandomItemType, RandomItemPredicate*> predicates;
@@ -10,6 +10,7 @@
 #include "AiFactory.h"
 #include "DBCStores.h"
 #include "ItemEnchantmentMgr.h"
+#include "ItemStatsCache.h"
 #include "ItemTemplate.h"
 #include "ObjectMgr.h"
 #include "PlayerbotAI.h"
@@ -83,10 +84,6 @@ void StatsWeightCalculator::Reset()
 {
     collector_->Reset();
     weight_ = 0;
-    for (uint32 i = 0; i < STATS_TYPE_MAX; i++)
-    {
-        stats_weights_[i] = 0;
-    }
 }
 
 float StatsWeightCalculator::CalculateItem(uint32 itemId, int32 randomPropertyIds, int32 slot)
@@ -98,19 +95,16 @@ float StatsWeightCalculator::CalculateItem(uint32 itemId, int32 randomPropertyId
 
     Reset();
 
-    collector_->CollectItemStats(proto);
+    StatsVector stats = sItemStatsCache.GetItemStats(type_, cls, proto);
 
     if (randomPropertyIds != 0)
-        CalculateRandomProperty(randomPropertyIds, itemId);
+        stats.Add(sItemStatsCache.GetRandomPropertyStats(type_, cls, itemId, randomPropertyIds));
 
     if (enable_overflow_penalty_)
-        ApplyOverflowPenalty(player_);
+        ApplyOverflowPenalty(player_, stats);
 
     GenerateWeights(player_);
-    for (uint32 i = 0; i < STATS_TYPE_MAX; i++)
-    {
-        weight_ += stats_weights_[i] * collector_->stats[i];
-    }
+    weight_ += stats.Dot(stats_weights_);
 
     CalculateItemTypePenalty(proto);
 
@@ -148,65 +142,19 @@ float StatsWeightCalculator::CalculateEnchant(uint32 enchantId)
 
     collector_->CollectEnchantStats(enchant);
 
+    StatsVector stats;
+    for (uint32 i = 0; i < STATS_TYPE_MAX; i++)
+        stats[i] = collector_->stats[i];
+
     if (enable_overflow_penalty_)
-        ApplyOverflowPenalty(player_);
+        ApplyOverflowPenalty(player_, stats);
 
     GenerateWeights(player_);
-    for (uint32 i = 0; i < STATS_TYPE_MAX; i++)
-    {
-        weight_ += stats_weights_[i] * collector_->stats[i];
-    }
+    weight_ += stats.Dot(stats_weights_);
 
     return weight_;
 }
 
-void StatsWeightCalculator::CalculateRandomProperty(int32 randomPropertyId, uint32 itemId)
-{
-    if (randomPropertyId > 0)
-    {
-        ItemRandomPropertiesEntry const* item_rand = sItemRandomPropertiesStore.LookupEntry(randomPropertyId);
-        if (!item_rand)
-        {
-            return;
-        }
-
-        for (uint32 i = PROP_ENCHANTMENT_SLOT_0; i < MAX_ENCHANTMENT_SLOT; ++i)
-        {
-            uint32 enchantId = item_rand->Enchantment[i - PROP_ENCHANTMENT_SLOT_0];
-            SpellItemEnchantmentEntry const* enchant = sSpellItemEnchantmentStore.LookupEntry(enchantId);
-            if (enchant)
-                collector_->CollectEnchantStats(enchant);
-        }
-    }
-    else
-    {
-        ItemRandomSuffixEntry const* item_rand = sItemRandomSuffixStore.LookupEntry(-randomPropertyId);
-        if (!item_rand)
-        {
-            return;
-        }
-
-        for (uint32 i = PROP_ENCHANTMENT_SLOT_0; i < MAX_ENCHANTMENT_SLOT; ++i)
-        {
-            uint32 enchantId = item_rand->Enchantment[i - PROP_ENCHANTMENT_SLOT_0];
-            SpellItemEnchantmentEntry const* enchant = sSpellItemEnchantmentStore.LookupEntry(enchantId);
-            uint32 enchant_amount = 0;
-
-            for (int k = 0; k < MAX_ITEM_ENCHANTMENT_EFFECTS; ++k)
-            {
-                if (item_rand->Enchantment[k] == enchantId)
-                {
-                    enchant_amount = uint32((item_rand->AllocationPct[k] * GenerateEnchSuffixFactor(itemId)) / 10000);
-                    break;
-                }
-            }
-
-            if (enchant)
-                collector_->CollectEnchantStats(enchant, enchant_amount);
-        }
-    }
-}
-
 int32 StatsWeightCalculator::PickBestRandomPropertyId(uint32 itemId)
 {
     ItemTemplate const* proto = sObjectMgr->GetItemTemplate(itemId);
@@ -236,12 +184,7 @@ int32 StatsWeightCalculator::PickBestRandomPropertyId(uint32 itemId)
     {
         int32 candidate = isSuffix ? -static_cast<int32>(enchId) : static_cast<int32>(enchId);
 
-        collector_->Reset();
-        CalculateRandomProperty(candidate, itemId);
-
-        float score = 0.0f;
-        for (uint32 i = 0; i < STATS_TYPE_MAX; ++i)
-            score += stats_weights_[i] * collector_->stats[i];
+        float score = sItemStatsCache.GetRandomPropertyStats(type_, cls, itemId, candidate).Dot(stats_weights_);
 
         if (bestId == 0 || score > bestScore)
         {
@@ -250,14 +193,21 @@ int32 StatsWeightCalculator::PickBestRandomPropertyId(uint32 itemId)
         }
     }
 
-    collector_->Reset();
     return bestId;
 }
 
 void StatsWeightCalculator::GenerateWeights(Player* player)
 {
-    GenerateBasicWeights(player);
-    GenerateAdditionalWeights(player);
+    if (!base_weights_ready_)
+    {
+        stats_weights_ = StatsVector();
+        GenerateBasicWeights(player);
+        GenerateAdditionalWeights(player);
+        base_weights_ = stats_weights_;
+        base_weights_ready_ = true;
+    }
+
+    stats_weights_ = base_weights_;
     ApplyWeightFinetune(player);
 }
 
@@ -740,7 +690,7 @@ bool StatsWeightCalculator::NotBestArmorType(uint32 item_subclass_armor)
     return false;
 }
 
-void StatsWeightCalculator::ApplyOverflowPenalty(Player* player)
+void StatsWeightCalculator::ApplyOverflowPenalty(Player* player, StatsVector& stats)
 {
     {
         float hit_current, hit_overflow;
@@ -783,7 +733,7 @@ void StatsWeightCalculator::ApplyOverflowPenalty(Player* player)
             else
                 validPoints = 0;
         }
-        collector_->stats[STATS_TYPE_HIT] = std::min(collector_->stats[STATS_TYPE_HIT], validPoints);
+        stats[STATS_TYPE_HIT] = std::min(stats[STATS_TYPE_HIT], validPoints);
     }
 
     {
@@ -800,7 +750,7 @@ void StatsWeightCalculator::ApplyOverflowPenalty(Player* player)
             else
                 validPoints = 0;
 
-            collector_->stats[STATS_TYPE_EXPERTISE] = std::min(collector_->stats[STATS_TYPE_EXPERTISE], validPoints);
+            stats[STATS_TYPE_EXPERTISE] = std::min(stats[STATS_TYPE_EXPERTISE], validPoints);
         }
     }
 
@@ -817,7 +767,7 @@ void StatsWeightCalculator::ApplyOverflowPenalty(Player* player)
             else
                 validPoints = 0;
 
-            collector_->stats[STATS_TYPE_DEFENSE] = std::min(collector_->stats[STATS_TYPE_DEFENSE], validPoints);
+            stats[STATS_TYPE_DEFENSE] = std::min(stats[STATS_TYPE_DEFENSE], validPoints);
         }
     }
 
@@ -835,8 +785,7 @@ void StatsWeightCalculator::ApplyOverflowPenalty(Player* player)
             else
                 validPoints = 0;
 
-            collector_->stats[STATS_TYPE_ARMOR_PENETRATION] =
-                std::min(collector_->stats[STATS_TYPE_ARMOR_PENETRATION], validPoints);
+            stats[STATS_TYPE_ARMOR_PENETRATION] = std::min(stats[STATS_TYPE_ARMOR_PENETRATION], validPoints);
         }
     }
 }
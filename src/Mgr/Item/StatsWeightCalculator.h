@@ -7,6 +7,7 @@
 #ifndef PLAYERBOTS_STATSWEIGHTCALCULATOR_H
 #define PLAYERBOTS_STATSWEIGHTCALCULATOR_H
 
+#include "ItemStatsCache.h"
 #include "Player.h"
 #include "StatsCollector.h"
 
@@ -36,15 +37,22 @@ public:
     void SetOverflowPenalty(bool apply) { enable_overflow_penalty_ = apply; }
     void SetItemSetBonus(bool apply) { enable_item_set_bonus_ = apply; }
     void SetQualityBlend(bool apply) { enable_quality_blend_ = apply; }
-    void SetPvpSpec(bool isPvp) { pvpSpec_ = isPvp; }
-    void SetExcludeResilience(bool exclude) { exclude_resilience_ = exclude; }
+    void SetPvpSpec(bool isPvp)
+    {
+        pvpSpec_ = isPvp;
+        base_weights_ready_ = false;
+    }
+    void SetExcludeResilience(bool exclude)
+    {
+        exclude_resilience_ = exclude;
+        base_weights_ready_ = false;
+    }
 
     private:
     void GenerateWeights(Player* player);
     void GenerateBasicWeights(Player* player);
     void GenerateAdditionalWeights(Player* player);
 
-    void CalculateRandomProperty(int32 randomPropertyId, uint32 itemId);
     void CalculateItemSetMod(Player* player, ItemTemplate const* proto);
     void CalculateSocketBonus(Player* player, ItemTemplate const* proto);
 
@@ -53,7 +61,7 @@ public:
 
     bool NotBestArmorType(uint32 item_subclass_armor);
 
-    void ApplyOverflowPenalty(Player* player);
+    void ApplyOverflowPenalty(Player* player, StatsVector& stats);
     void ApplyWeightFinetune(Player* player);
 
 private:
@@ -69,7 +77,10 @@ private:
     bool enable_quality_blend_;
 
     float weight_;
-    float stats_weights_[STATS_TYPE_MAX];
+    StatsVector stats_weights_;
+    // Class, spec and talent weights, generated on first use; rating dependent finetuning is redone per item.
+    StatsVector base_weights_;
+    bool base_weights_ready_ = false;
     bool pvpSpec_ = false;
     bool exclude_resilience_ = false;
 };
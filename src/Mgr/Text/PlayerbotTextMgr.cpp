@@ -3,6 +3,8 @@
  * information; released under GNU GPL v2 license, redistribute/modify under version 2 of the License,
  * or (at your option) any later version.
  */
+#include <cctype>
+
 #include "DatabaseEnv.h"
 #include "WorldSessionMgr.h"
 #include "Random.h"
@@ -23,6 +25,134 @@ void PlayerbotTextMgr::replaceAll(std::string& str, const std::string& from, con
     }
 }
 
+std::string& BotTextPlaceholders::operator[](std::string_view name)
+{
+    std::string_view storedName;
+    uint32 placeholder = PlayerbotTextMgr::instance().GetPlaceholderId(name, &storedName);
+
+    for (Value& value : values)
+    {
+        if (value.placeholder == placeholder)
+            return value.value;
+    }
+
+    bool token = IsToken(name);
+    others |= !token;
+
+    return values.emplace_back(Value{placeholder, storedName, std::string(), token}).value;
+}
+
+bool BotTextPlaceholders::IsToken(std::string_view name)
+{
+    if (name.size() < 2 || name[0] != '%')
+        return false;
+
+    for (char c : name.substr(1))
+    {
+        if (!isalnum(static_cast<unsigned char>(c)) && c != '_')
+            return false;
+    }
+
+    return true;
+}
+
+void BotTextPlaceholders::ReplaceOthers(std::string& text) const
+{
+    if (!others)
+        return;
+
+    for (Value const& value : values)
+    {
+        if (!value.token)
+            PlayerbotTextMgr::replaceAll(text, std::string(value.name), value.value);
+    }
+}
+
+std::string const* BotTextPlaceholders::Find(uint32 placeholder) const
+{
+    for (Value const& value : values)
+    {
+        if (value.placeholder == placeholder)
+            return &value.value;
+    }
+
+    return nullptr;
+}
+
+std::string const* BotTextPlaceholders::FindPrefixOf(std::string_view token, uint32& nameLength) const
+{
+    std::string const* found = nullptr;
+    nameLength = 0;
+
+    for (Value const& value : values)
+    {
+        if (value.token && value.name.size() > nameLength && value.name.size() < token.size() &&
+            token.starts_with(value.name))
+        {
+            found = &value.value;
+            nameLength = value.name.size();
+        }
+    }
+
+    return found;
+}
+
+uint32 PlayerbotTextMgr::GetPlaceholderId(std::string_view name, std::string_view* storedName)
+{
+    std::string key(name);
+
+    {
+        std::shared_lock<std::shared_mutex> lock(placeholderMutex);
+        auto itr = placeholderIds.find(key);
+        if (itr != placeholderIds.end())
+        {
+            if (storedName)
+                *storedName = itr->first;
+            return itr->second;
+        }
+    }
+
+    std::unique_lock<std::shared_mutex> lock(placeholderMutex);
+    auto itr = placeholderIds.try_emplace(std::move(key), placeholderIds.size() + 1).first;
+    if (storedName)
+        *storedName = itr->first;
+    return itr->second;
+}
+
+void PlayerbotTextMgr::CompileBotText(BotTextEntry& entry)
+{
+    for (uint8 i = 0; i < TOTAL_LOCALES; ++i)
+    {
+        std::string const& text = entry.m_text[i];
+        std::vector<BotTextSegment>& segments = entry.m_segments[i];
+
+        size_t literal = 0;
+        size_t pos = 0;
+        while ((pos = text.find('%', pos)) != std::string::npos)
+        {
+            size_t end = pos + 1;
+            while (end < text.size() && (isalnum(static_cast<unsigned char>(text[end])) || text[end] == '_'))
+                ++end;
+
+            if (end == pos + 1)
+            {
+                ++pos;
+                continue;
+            }
+
+            if (pos > literal)
+                segments.push_back({uint32(literal), uint32(pos - literal), BotTextSegment::LITERAL});
+
+            std::string_view token(text.data() + pos, end - pos);
+            segments.push_back({uint32(pos), uint32(end - pos), GetPlaceholderId(token)});
+            literal = pos = end;
+        }
+
+        if (literal < text.size())
+            segments.push_back({uint32(literal), uint32(text.size() - literal), BotTextSegment::LITERAL});
+    }
+}
+
 void PlayerbotTextMgr::LoadBotTexts()
 {
     LOG_INFO("playerbots", "Loading playerbots texts...");
@@ -33,7 +163,7 @@ void PlayerbotTextMgr::LoadBotTexts()
     {
         do
         {
-            std::map<uint32, std::string> text;
+            std::array<std::string, TOTAL_LOCALES> text;
             Field* fields = result->Fetch();
             std::string name = fields[0].Get<std::string>();
             text[0] = fields[1].Get<std::string>();
@@ -44,11 +174,20 @@ void PlayerbotTextMgr::LoadBotTexts()
                 text[i] = fields[i + 3].Get<std::string>();
             }
 
-            botTexts[name].push_back(BotTextEntry(name, text, sayType, replyType));
+            BotTextEntry& entry = botTexts[name].emplace_back(name, std::move(text), sayType, replyType);
+            CompileBotText(entry);
             ++count;
         } while (result->NextRow());
     }
 
+    botTextReplies.clear();
+    auto const replies = botTexts.find("reply");
+    if (replies != botTexts.end())
+    {
+        for (BotTextEntry const& entry : replies->second)
+            botTextReplies[entry.m_replyType].push_back(&entry);
+    }
+
     LOG_INFO("playerbots", "{} playerbots texts loaded", count);
 }
 
@@ -71,39 +210,109 @@ void PlayerbotTextMgr::LoadBotTextChance()
     }
 }
 
+BotTextPlaceholders PlayerbotTextMgr::ToPlaceholders(std::map<std::string, std::string> const& placeholders)
+{
+    BotTextPlaceholders result;
+    for (auto const& [name, value] : placeholders)
+        result[name] = value;
+
+    return result;
+}
+
+void PlayerbotTextMgr::Render(BotTextEntry const& entry, BotTextPlaceholders const& placeholders, std::string& out)
+{
+    uint32 locale = GetLocalePriority();
+    if (entry.m_text[locale].empty())
+        locale = 0;
+
+    std::string const& text = entry.m_text[locale];
+
+    out.clear();
+    out.reserve(text.size());
+
+    for (BotTextSegment const& segment : entry.m_segments[locale])
+    {
+        std::string_view part(text.data() + segment.offset, segment.length);
+
+        if (segment.placeholder != BotTextSegment::LITERAL)
+        {
+            if (std::string const* value = placeholders.Find(segment.placeholder))
+            {
+                out.append(*value);
+                continue;
+            }
+
+            uint32 nameLength;
+            if (std::string const* value = placeholders.FindPrefixOf(part, nameLength))
+            {
+                out.append(*value);
+                part.remove_prefix(nameLength);
+            }
+        }
+
+        out.append(part);
+    }
+
+    placeholders.ReplaceOthers(out);
+}
+
 // general texts
 
-std::string PlayerbotTextMgr::GetBotText(std::string name)
+BotTextEntry const* PlayerbotTextMgr::GetRandomBotText(std::string const& name)
 {
     if (botTexts.empty())
     {
         LOG_ERROR("playerbots", "Can't get bot text {}! No bots texts loaded!", name);
-        return "";
+        return nullptr;
     }
 
-    if (botTexts[name].empty())
+    auto const itr = botTexts.find(name);
+    if (itr == botTexts.end() || itr->second.empty())
     {
         LOG_ERROR("playerbots", "Can't get bot text {}! No bots texts for this name!", name);
-        return "";
+        return nullptr;
     }
 
-    std::vector<BotTextEntry>& list = botTexts[name];
-    BotTextEntry textEntry = list[urand(0, list.size() - 1)];
-    return !textEntry.m_text[GetLocalePriority()].empty() ? textEntry.m_text[GetLocalePriority()] : textEntry.m_text[0];
+    std::vector<BotTextEntry> const& list = itr->second;
+    return &list[urand(0, list.size() - 1)];
 }
 
-std::string PlayerbotTextMgr::GetBotText(std::string name, std::map<std::string, std::string> placeholders)
+std::string PlayerbotTextMgr::GetBotText(std::string name)
 {
-    std::string botText = GetBotText(name);
-    if (botText.empty())
+    BotTextEntry const* textEntry = GetRandomBotText(name);
+    if (!textEntry)
         return "";
 
-    for (std::map<std::string, std::string>::iterator i = placeholders.begin(); i != placeholders.end(); ++i)
-        replaceAll(botText, i->first, i->second);
+    uint32 locale = GetLocalePriority();
+    return !textEntry->m_text[locale].empty() ? textEntry->m_text[locale] : textEntry->m_text[0];
+}
 
+std::string PlayerbotTextMgr::GetBotText(std::string name, std::map<std::string, std::string> placeholders)
+{
+    return GetBotText(name, ToPlaceholders(placeholders));
+}
+
+std::string PlayerbotTextMgr::GetBotText(std::string const& name, BotTextPlaceholders const& placeholders)
+{
+    std::string botText;
+    RenderBotText(name, placeholders, botText);
     return botText;
 }
 
+bool PlayerbotTextMgr::RenderBotText(std::string const& name, BotTextPlaceholders const& placeholders,
+                                     std::string& out)
+{
+    BotTextEntry const* textEntry = GetRandomBotText(name);
+    if (!textEntry)
+    {
+        out.clear();
+        return false;
+    }
+
+    Render(*textEntry, placeholders, out);
+    return !out.empty();
+}
+
 std::string PlayerbotTextMgr::GetBotTextOrDefault(std::string name, std::string defaultText,
     std::map<std::string, std::string> placeholders)
 {
@@ -129,29 +338,20 @@ std::string PlayerbotTextMgr::GetBotText(ChatReplyType replyType, std::map<std::
         LOG_ERROR("playerbots", "Can't get bot text reply {}! No bots texts loaded!", replyType);
         return "";
     }
-    if (botTexts["reply"].empty())
+    if (botTextReplies.empty())
     {
         LOG_ERROR("playerbots", "Can't get bot text reply {}! No bots texts replies!", replyType);
         return "";
     }
 
-    std::vector<BotTextEntry>& list = botTexts["reply"];
-    std::vector<BotTextEntry> proper_list;
-    for (auto text : list)
-    {
-        if (text.m_replyType == replyType)
-            proper_list.push_back(text);
-    }
-
-    if (proper_list.empty())
+    auto const itr = botTextReplies.find(replyType);
+    if (itr == botTextReplies.end())
         return "";
 
-    BotTextEntry textEntry = proper_list[urand(0, proper_list.size() - 1)];
-    std::string botText =
-        !textEntry.m_text[GetLocalePriority()].empty() ? textEntry.m_text[GetLocalePriority()] : textEntry.m_text[0];
-    for (auto& placeholder : placeholders)
-        replaceAll(botText, placeholder.first, placeholder.second);
+    std::vector<BotTextEntry const*> const& list = itr->second;
 
+    std::string botText;
+    Render(*list[urand(0, list.size() - 1)], ToPlaceholders(placeholders), botText);
     return botText;
 }
 
@@ -167,10 +367,11 @@ std::string PlayerbotTextMgr::GetBotText(ChatReplyType replyType, std::string na
 
 bool PlayerbotTextMgr::rollTextChance(std::string name)
 {
-    if (!botTextChance[name])
+    auto const itr = botTextChance.find(name);
+    if (itr == botTextChance.end() || !itr->second)
         return true;
 
-    return urand(0, 100) < botTextChance[name];
+    return urand(0, 100) < itr->second;
 }
 
 bool PlayerbotTextMgr::GetBotText(std::string name, std::string& text)
@@ -7,23 +7,67 @@
 #ifndef PLAYERBOTS_PLAYERBOTTEXTMGR_H
 #define PLAYERBOTS_PLAYERBOTTEXTMGR_H
 
+#include <array>
 #include <map>
+#include <shared_mutex>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 
 #include "Common.h"
 
+// A run of a bot text: literal text, or a %name placeholder when placeholder is set.
+struct BotTextSegment
+{
+    static constexpr uint32 LITERAL = 0;
+
+    uint32 offset;
+    uint32 length;
+    uint32 placeholder;
+};
+
 struct BotTextEntry
 {
-    BotTextEntry(std::string name, std::map<uint32, std::string> text, uint32 say_type, uint32 reply_type)
-        : m_name(name), m_text(text), m_sayType(say_type), m_replyType(reply_type)
+    BotTextEntry(std::string name, std::array<std::string, TOTAL_LOCALES> text, uint32 say_type, uint32 reply_type)
+        : m_name(name), m_text(std::move(text)), m_sayType(say_type), m_replyType(reply_type)
     {
     }
     std::string m_name;
-    std::map<uint32, std::string> m_text;
+    std::array<std::string, TOTAL_LOCALES> m_text;
+    // m_text split at its placeholders once at load, per locale
+    std::array<std::vector<BotTextSegment>, TOTAL_LOCALES> m_segments;
     uint32 m_sayType;
     uint32 m_replyType;
 };
 
+// Placeholder values for a bot text. Names are resolved to placeholder ids when set, rendering matches the
+// compiled segments against the ids. A reference returned by operator[] is valid until the next new name.
+class BotTextPlaceholders
+{
+public:
+    std::string& operator[](std::string_view name);
+
+    std::string const* Find(uint32 placeholder) const;
+    // Longest set name that starts the token, replaceAll used to substitute those (%item in %items).
+    std::string const* FindPrefixOf(std::string_view token, uint32& nameLength) const;
+    // Names that are not a %name token (like <target>) are substituted with replaceAll after rendering.
+    void ReplaceOthers(std::string& text) const;
+
+    static bool IsToken(std::string_view name);
+
+private:
+    struct Value
+    {
+        uint32 placeholder;
+        std::string_view name;
+        std::string value;
+        bool token;
+    };
+
+    std::vector<Value> values;
+    bool others = false;
+};
+
 struct ChatReplyData
 {
     ChatReplyData(uint32 guid, uint32 type, std::string chat) : m_type(type), m_guid(guid), m_chat(chat) {}
@@ -69,6 +113,9 @@ public:
     }
 
     std::string GetBotText(std::string name, std::map<std::string, std::string> placeholders);
+    std::string GetBotText(std::string const& name, BotTextPlaceholders const& placeholders);
+    // Renders a random text of name into out, reusing its capacity. False when there is no such text.
+    bool RenderBotText(std::string const& name, BotTextPlaceholders const& placeholders, std::string& out);
     std::string GetBotText(std::string name);
     std::string GetBotText(ChatReplyType replyType, std::map<std::string, std::string> placeholders);
     std::string GetBotText(ChatReplyType replyType, std::string name);
@@ -80,6 +127,8 @@ public:
     void LoadBotTextChance();
     static void replaceAll(std::string& str, const std::string& from, const std::string& to);
     bool rollTextChance(std::string text);
+    // Ids of %name placeholders, 0 (BotTextSegment::LITERAL) is never used. Thread safe.
+    uint32 GetPlaceholderId(std::string_view name, std::string_view* storedName = nullptr);
 
     uint32 GetLocalePriority();
     void AddLocalePriority(uint32 locale);
@@ -101,7 +150,15 @@ private:
     PlayerbotTextMgr(PlayerbotTextMgr&&) = delete;
     PlayerbotTextMgr& operator=(PlayerbotTextMgr&&) = delete;
 
+    static BotTextPlaceholders ToPlaceholders(std::map<std::string, std::string> const& placeholders);
+    void CompileBotText(BotTextEntry& entry);
+    BotTextEntry const* GetRandomBotText(std::string const& name);
+    void Render(BotTextEntry const& entry, BotTextPlaceholders const& placeholders, std::string& out);
+
     std::map<std::string, std::vector<BotTextEntry>> botTexts;
+    std::map<uint32, std::vector<BotTextEntry const*>> botTextReplies;
+    std::shared_mutex placeholderMutex;
+    std::unordered_map<std::string, uint32> placeholderIds;
     std::map<std::string, uint32> botTextChance;
     uint32 botTextLocalePriority[TOTAL_LOCALES];
 };
@@ -0,0 +1,386 @@
+/*
+ * This file is part of the mod-playerbots module for AzerothCore. See AUTHORS file for Copyright
+ * information; released under GNU GPL v2 license, redistribute/modify under version 2 of the License,
+ * or (at your option) any later version.
+ */
+
+#include "TravelDestinationIndex.h"
+
+#include <algorithm>
+#include <chrono>
+#include <queue>
+#include <unordered_set>
+
+#include "Chat.h"
+#include "DBCStructure.h"
+#include "Player.h"
+#include "Playerbots.h"
+#include "TravelMgr.h"
+
+namespace
+{
+    uint64 GetElapsed(std::chrono::steady_clock::time_point begin)
+    {
+        return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - begin)
+            .count();
+    }
+}
+
+void TravelDestinationIndex::Add(TravelDestination* dest, uint8 minLevel, uint8 maxLevel, uint8 teamMask)
+{
+    uint32 const order = destinationCount++;
+
+    for (WorldPosition* point : dest->getPoints(true))
+    {
+        uint32 const mapId = point->GetMapId();
+        int32 const cellX = GetCell(point->GetPositionX());
+        int32 const cellY = GetCell(point->GetPositionY());
+
+        cells[GetCellKey(mapId, cellX, cellY)].push_back({dest, order, point->GetPositionX(), point->GetPositionY(),
+                                                          point->GetPositionZ(), minLevel, maxLevel, teamMask});
+
+        auto [bounds, inserted] = mapBounds.try_emplace(mapId, Bounds{cellX, cellX, cellY, cellY});
+        if (!inserted)
+        {
+            bounds->second.minX = std::min(bounds->second.minX, cellX);
+            bounds->second.maxX = std::max(bounds->second.maxX, cellX);
+            bounds->second.minY = std::min(bounds->second.minY, cellY);
+            bounds->second.maxY = std::max(bounds->second.maxY, cellY);
+        }
+
+        ++pointCount;
+    }
+}
+
+void TravelDestinationIndex::Clear()
+{
+    cells.clear();
+    mapBounds.clear();
+    destinationCount = 0;
+    pointCount = 0;
+}
+
+std::vector<TravelDestination*> TravelDestinationIndex::GetInRadius(WorldPosition& pos, float radius, Player* bot) const
+{
+    std::vector<Candidate> found;
+    Collect(pos.GetMapId(), pos.GetPositionX(), pos.GetPositionY(), pos.GetPositionZ(), radius, 0.0f, bot, found);
+    CollectTransfers(pos, radius, bot, found);
+
+    // All points of a destination share its order, so duplicates end up next to each other.
+    std::sort(found.begin(), found.end(), [](Candidate const& a, Candidate const& b) { return a.order < b.order; });
+
+    std::vector<TravelDestination*> dests;
+    dests.reserve(found.size());
+    for (Candidate const& candidate : found)
+    {
+        if (dests.empty() || dests.back() != candidate.dest)
+            dests.push_back(candidate.dest);
+    }
+
+    return dests;
+}
+
+std::vector<TravelDestination*> TravelDestinationIndex::GetNearest(WorldPosition& pos, float radius, uint32 count,
+                                                                   Predicate const& predicate, Player* bot) const
+{
+    std::vector<TravelDestination*> nearest;
+    if (!count)
+        return nearest;
+
+    float const x = pos.GetPositionX();
+    float const y = pos.GetPositionY();
+    float const z = pos.GetPositionZ();
+    int32 const centerX = GetCell(x);
+    int32 const centerY = GetCell(y);
+
+    // Rings of cells around the position, past the last one every cell is out of radius or empty.
+    int32 maxRing = -1;
+    auto const bounds = mapBounds.find(pos.GetMapId());
+    if (bounds != mapBounds.end())
+    {
+        maxRing = std::min(int32(radius / SIZE_OF_GRIDS) + 1,
+                           std::max({centerX - bounds->second.minX, bounds->second.maxX - centerX,
+                                     centerY - bounds->second.minY, bounds->second.maxY - centerY}));
+    }
+
+    std::vector<Candidate> found;
+    CollectTransfers(pos, radius, bot, found);
+
+    std::priority_queue<Candidate, std::vector<Candidate>, std::greater<Candidate>> pending;
+    std::unordered_set<TravelDestination*> seen;
+
+    for (int32 ring = 0;; ++ring)
+    {
+        if (ring <= maxRing)
+        {
+            if (!ring)
+                CollectCells(pos.GetMapId(), x, y, z, radius, 0.0f, bot, centerX, centerX, centerY, centerY, found);
+            else
+            {
+                CollectCells(pos.GetMapId(), x, y, z, radius, 0.0f, bot, centerX - ring, centerX + ring,
+                             centerY - ring, centerY - ring, found);
+                CollectCells(pos.GetMapId(), x, y, z, radius, 0.0f, bot, centerX - ring, centerX + ring,
+                             centerY + ring, centerY + ring, found);
+                CollectCells(pos.GetMapId(), x, y, z, radius, 0.0f, bot, centerX - ring, centerX - ring,
+                             centerY - ring + 1, centerY + ring - 1, found);
+                CollectCells(pos.GetMapId(), x, y, z, radius, 0.0f, bot, centerX + ring, centerX + ring,
+                             centerY - ring + 1, centerY + ring - 1, found);
+            }
+        }
+
+        for (Candidate const& candidate : found)
+            pending.push(candidate);
+
+        found.clear();
+
+        // Cells of the next ring are at least this far away, so everything nearer is final.
+        bool const last = ring >= maxRing;
+        float const settled = last ? radius : ring * SIZE_OF_GRIDS;
+
+        while (!pending.empty() && pending.top().dist <= settled)
+        {
+            Candidate const candidate = pending.top();
+            pending.pop();
+
+            // The first time a destination comes up is its nearest point.
+            if (!seen.insert(candidate.dest).second)
+                continue;
+
+            if (!predicate(candidate.dest))
+                continue;
+
+            nearest.push_back(candidate.dest);
+            if (nearest.size() >= count)
+                return nearest;
+        }
+
+        if (last)
+            break;
+    }
+
+    return nearest;
+}
+
+int32 TravelDestinationIndex::GetCell(float coord) { return int32(std::floor(coord / SIZE_OF_GRIDS)); }
+
+uint64 TravelDestinationIndex::GetCellKey(uint32 mapId, int32 cellX, int32 cellY)
+{
+    return (uint64(mapId) << 32) | (uint32(uint16(cellX)) << 16) | uint16(cellY);
+}
+
+void TravelDestinationIndex::Collect(uint32 mapId, float x, float y, float z, float radius, float offset, Player* bot,
+                                     std::vector<Candidate>& out) const
+{
+    float const reach = radius - offset;
+    if (reach < 0.0f)
+        return;
+
+    CollectCells(mapId, x, y, z, radius, offset, bot, GetCell(x - reach), GetCell(x + reach), GetCell(y - reach),
+                 GetCell(y + reach), out);
+}
+
+void TravelDestinationIndex::CollectCells(uint32 mapId, float x, float y, float z, float radius, float offset,
+                                          Player* bot, int32 minCellX, int32 maxCellX, int32 minCellY,
+                                          int32 maxCellY, std::vector<Candidate>& out) const
+{
+    float const reach = radius - offset;
+    if (reach < 0.0f)
+        return;
+
+    auto const bounds = mapBounds.find(mapId);
+    if (bounds == mapBounds.end())
+        return;
+
+    minCellX = std::max(minCellX, bounds->second.minX);
+    maxCellX = std::min(maxCellX, bounds->second.maxX);
+    minCellY = std::max(minCellY, bounds->second.minY);
+    maxCellY = std::min(maxCellY, bounds->second.maxY);
+
+    float const reachSq = reach * reach;
+
+    for (int32 cellX = minCellX; cellX <= maxCellX; ++cellX)
+    {
+        for (int32 cellY = minCellY; cellY <= maxCellY; ++cellY)
+        {
+            auto const cell = cells.find(GetCellKey(mapId, cellX, cellY));
+            if (cell == cells.end())
+                continue;
+
+            for (Entry const& entry : cell->second)
+            {
+                float const dx = entry.x - x;
+                float const dy = entry.y - y;
+                float const dz = entry.z - z;
+                float const distSq = dx * dx + dy * dy + dz * dz;
+                if (distSq > reachSq)
+                    continue;
+
+                if (bot && !InBracket(entry, bot))
+                    continue;
+
+                out.push_back({std::sqrt(distSq) + offset, entry.order, entry.dest});
+            }
+        }
+    }
+}
+
+void TravelDestinationIndex::CollectTransfers(WorldPosition& pos, float radius, Player* bot,
+                                              std::vector<Candidate>& out) const
+{
+    // Same as TravelMgr::mapTransDistance: the point to the transfer on its map, the portal, then the transfer
+    // exit to pos.
+    uint32 const mapId = pos.GetMapId();
+    for (auto& [maps, transfers] : TravelMgr::instance().mapTransfersMap)
+    {
+        if (maps.second != mapId || maps.first == mapId || mapBounds.find(maps.first) == mapBounds.end())
+            continue;
+
+        for (mapTransfer& transfer : transfers)
+        {
+            float const offset = transfer.getPointTo()->distance(&pos) + transfer.getPortalLength();
+            if (offset > radius)
+                continue;
+
+            WorldPosition* from = transfer.getPointFrom();
+            Collect(maps.first, from->GetPositionX(), from->GetPositionY(), from->GetPositionZ(), radius, offset,
+                    bot, out);
+        }
+    }
+}
+
+bool TravelDestinationIndex::InBracket(Entry const& entry, Player* bot)
+{
+    uint8 const level = bot->GetLevel();
+    if (level < entry.minLevel || level > entry.maxLevel)
+        return false;
+
+    return entry.teamMask & (bot->GetTeamId() == TEAM_ALLIANCE ? FACTION_MASK_ALLIANCE : FACTION_MASK_HORDE);
+}
+
+bool TravelDestinationIndex::HandleConsoleCommand(ChatHandler* handler, char const* args)
+{
+    TravelMgr& travelMgr = TravelMgr::instance();
+
+    if (args && !strcmp(args, "load"))
+    {
+        if (!travelMgr.quests.empty())
+        {
+            handler->PSendSysMessage("Travel destinations are already loaded.");
+            return true;
+        }
+
+        handler->PSendSysMessage("Loading travel destinations, this takes a while.");
+        travelMgr.LoadQuestTravelTable();
+    }
+
+    std::vector<Player*> bots;
+    for (auto const& itr : sRandomPlayerbotMgr.GetAllBots())
+    {
+        if (itr.second && itr.second->IsInWorld())
+            bots.push_back(itr.second);
+    }
+
+    if (Player* selected = handler->getSelectedPlayer())
+        bots.push_back(selected);
+
+    if (bots.empty())
+    {
+        handler->PSendSysMessage("No bots online to query travel destinations from.");
+        return true;
+    }
+
+    struct Kind
+    {
+        char const* name;
+        TravelDestinationIndex const& index;
+        std::vector<TravelDestination*> dests;
+        float radius;
+    };
+
+    Kind kinds[] = {
+        {"quest givers", travelMgr.questGiverIndex,
+         std::vector<TravelDestination*>(travelMgr.questGivers.begin(), travelMgr.questGivers.end()), 5000.0f},
+        {"rpg npcs", travelMgr.rpgNpcIndex,
+         std::vector<TravelDestination*>(travelMgr.rpgNpcs.begin(), travelMgr.rpgNpcs.end()), 5000.0f},
+        {"grind mobs", travelMgr.grindMobIndex,
+         std::vector<TravelDestination*>(travelMgr.grindMobs.begin(), travelMgr.grindMobs.end()), 5000.0f},
+        {"bosses", travelMgr.bossMobIndex,
+         std::vector<TravelDestination*>(travelMgr.bossMobs.begin(), travelMgr.bossMobs.end()), 25000.0f},
+    };
+
+    handler->PSendSysMessage("Querying travel destinations from {} bots.", bots.size());
+
+    for (Kind& kind : kinds)
+    {
+        if (kind.dests.empty())
+        {
+            handler->PSendSysMessage("{}: none loaded (.playerbots debug travel load).", kind.name);
+            continue;
+        }
+
+        uint64 scanFound = 0;
+        uint64 indexFound = 0;
+        uint64 bracketFound = 0;
+        uint32 mismatches = 0;
+
+        auto begin = std::chrono::steady_clock::now();
+        std::vector<uint32> scanCounts;
+        for (Player* bot : bots)
+        {
+            WorldPosition botPos(bot);
+            uint32 inRadius = 0;
+            for (TravelDestination* dest : kind.dests)
+            {
+                if (dest->distanceTo(&botPos) <= kind.radius)
+                    ++inRadius;
+            }
+
+            scanCounts.push_back(inRadius);
+            scanFound += inRadius;
+        }
+
+        uint64 scanTime = GetElapsed(begin);
+        begin = std::chrono::steady_clock::now();
+
+        for (uint32 i = 0; i < bots.size(); ++i)
+        {
+            WorldPosition botPos(bots[i]);
+            uint32 inRadius = kind.index.GetInRadius(botPos, kind.radius).size();
+            indexFound += inRadius;
+            if (inRadius != scanCounts[i])
+                ++mismatches;
+        }
+
+        uint64 indexTime = GetElapsed(begin);
+        begin = std::chrono::steady_clock::now();
+
+        for (Player* bot : bots)
+        {
+            WorldPosition botPos(bot);
+            bracketFound += kind.index.GetInRadius(botPos, kind.radius, bot).size();
+        }
+
+        uint64 bracketTime = GetElapsed(begin);
+        begin = std::chrono::steady_clock::now();
+
+        for (Player* bot : bots)
+        {
+            WorldPosition botPos(bot);
+            kind.index.GetNearest(botPos, kind.radius, 1, [](TravelDestination*) { return true; });
+        }
+
+        uint64 nearestTime = GetElapsed(begin);
+
+        float const queries = bots.size();
+        handler->PSendSysMessage("{}: {} destinations, {} points, radius {:.0f}.", kind.name, kind.dests.size(),
+                                 kind.index.GetPointCount(), kind.radius);
+        handler->PSendSysMessage("    Scan: {:.1f}us per query, {:.1f} in radius.", scanTime / queries,
+                                 scanFound / queries);
+        handler->PSendSysMessage("    Index: {:.1f}us per query, {:.1f} in radius ({} mismatches), {:.1f}us and "
+                                 "{:.1f} in level and team bracket, nearest {:.1f}us.",
+                                 indexTime / queries, indexFound / queries, mismatches, bracketTime / queries,
+                                 bracketFound / queries, nearestTime / queries);
+    }
+
+    return true;
+}
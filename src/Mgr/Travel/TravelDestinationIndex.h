@@ -0,0 +1,101 @@
+/*
+ * This file is part of the mod-playerbots module for AzerothCore. See AUTHORS file for Copyright
+ * information; released under GNU GPL v2 license, redistribute/modify under version 2 of the License,
+ * or (at your option) any later version.
+ */
+
+#ifndef PLAYERBOTS_TRAVELDESTINATIONINDEX_H
+#define PLAYERBOTS_TRAVELDESTINATIONINDEX_H
+
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+#include "Common.h"
+
+class ChatHandler;
+class Player;
+class TravelDestination;
+class WorldPosition;
+
+// Spatial index over one kind of travel destination, built once the destinations are loaded.
+// Every point of a destination is put in a map grid sized cell of its map, together with the bot levels and
+// teams the destination can be active for. Queries only look at the cells around the position (and around
+// the map transfers leading to it) and skip destinations outside the bot's bracket before isActive is called.
+class TravelDestinationIndex
+{
+public:
+    typedef std::function<bool(TravelDestination*)> Predicate;
+
+    // teamMask uses the FACTION_MASK_ALLIANCE/FACTION_MASK_HORDE bits.
+    void Add(TravelDestination* dest, uint8 minLevel = 0, uint8 maxLevel = 255, uint8 teamMask = 0xFF);
+    void Clear();
+
+    uint32 GetDestinationCount() const { return destinationCount; }
+    uint32 GetPointCount() const { return pointCount; }
+
+    // Destinations with a point within radius of pos, the same distance TravelDestination::distanceTo uses,
+    // in the order they were added. With a bot only those in its level and team bracket are returned.
+    std::vector<TravelDestination*> GetInRadius(WorldPosition& pos, float radius, Player* bot = nullptr) const;
+    // Up to count destinations within radius passing predicate, nearest first. The predicate is only called
+    // on the destinations that are nearer than every one not yet looked at.
+    std::vector<TravelDestination*> GetNearest(WorldPosition& pos, float radius, uint32 count,
+                                               Predicate const& predicate, Player* bot = nullptr) const;
+
+    // Compares the indexed queries with the full scans over the loaded destinations, .playerbots debug travel
+    static bool HandleConsoleCommand(ChatHandler* handler, char const* args);
+
+private:
+    struct Entry
+    {
+        TravelDestination* dest;
+        uint32 order;
+        float x;
+        float y;
+        float z;
+        uint8 minLevel;
+        uint8 maxLevel;
+        uint8 teamMask;
+    };
+
+    struct Bounds
+    {
+        int32 minX;
+        int32 maxX;
+        int32 minY;
+        int32 maxY;
+    };
+
+    // A destination found by a query, dist is the distance of its nearest point found so far.
+    struct Candidate
+    {
+        float dist;
+        uint32 order;
+        TravelDestination* dest;
+
+        bool operator>(Candidate const& other) const
+        {
+            return dist != other.dist ? dist > other.dist : order > other.order;
+        }
+    };
+
+    static int32 GetCell(float coord);
+    static uint64 GetCellKey(uint32 mapId, int32 cellX, int32 cellY);
+
+    // Collects the entries of mapId within radius of (x, y, z), offset added to their distance.
+    void Collect(uint32 mapId, float x, float y, float z, float radius, float offset, Player* bot,
+                 std::vector<Candidate>& out) const;
+    void CollectCells(uint32 mapId, float x, float y, float z, float radius, float offset, Player* bot,
+                      int32 minCellX, int32 maxCellX, int32 minCellY, int32 maxCellY,
+                      std::vector<Candidate>& out) const;
+    // Entries on other maps reachable from pos through a map transfer within radius.
+    void CollectTransfers(WorldPosition& pos, float radius, Player* bot, std::vector<Candidate>& out) const;
+    static bool InBracket(Entry const& entry, Player* bot);
+
+    std::unordered_map<uint64, std::vector<Entry>> cells;
+    std::unordered_map<uint32, Bounds> mapBounds;
+    uint32 destinationCount = 0;
+    uint32 pointCount = 0;
+};
+
+#endif
@@ -6,6 +6,7 @@
 
 #include "TravelMgr.h"
 
+#include <cctype>
 #include <iomanip>
 #include <numeric>
 
@@ -14,6 +15,7 @@
 #include "Log.h"
 #include "ObjectAccessor.h"
 #include "TravelNode.h"
+#include "TravelRoutePlanner.h"
 #include "Talentspec.h"
 #include "ChatHelper.h"
 #include "MapCollisionData.h"
@@ -1499,6 +1501,7 @@ void TravelTarget::setTarget(TravelDestination* tDestination1, WorldPosition* wP
     groupCopy = groupCopy1;
     forced = false;
     radius = 0;
+    routePlan.reset();
 
     addVisitors();
 
@@ -1543,6 +1546,18 @@ float TravelTarget::distance(Player* bot)
     return wPosition->distance(&pos);
 }
 
+void TravelTarget::requestPath(Player* bot)
+{
+    if (routePlan || !wPosition)
+        return;
+
+    routePlan = TravelRoutePlanner::instance().queuePlan(WorldPosition(bot), *wPosition, bot);
+}
+
+bool TravelTarget::isPathPending() { return routePlan && !routePlan->isReady(); }
+
+TravelPath* TravelTarget::getPath() { return routePlan ? routePlan->getPath() : nullptr; }
+
 WorldPosition* TravelTarget::getPosition() { return wPosition; }
 
 TravelDestination* TravelTarget::getDestination() { return tDestination; }
@@ -1747,6 +1762,10 @@ void TravelMgr::Clear()
 
     questGivers.clear();
     quests.clear();
+
+    questGiverIndex.Clear();
+    questTakerIndex.Clear();
+    questObjectiveIndex.Clear();
 }
 
 void TravelMgr::logQuestError(uint32 errorNr, Quest* quest, uint32 objective, uint32 unitId, uint32 itemId)
@@ -2071,10 +2090,10 @@ void TravelMgr::LoadQuestTravelTable()
 
                     for (auto& guidP : e.second)
                     {
-                        WorldPosition point = guidP;
+                        WorldPosition* point = storeDestinationPoint(guidP);
                         for (auto tLoc : locs)
                         {
-                            tLoc->addPoint(&point);
+                            tLoc->addPoint(point);
                         }
                     }
                 }
@@ -2294,7 +2313,7 @@ void TravelMgr::LoadQuestTravelTable()
                 rLoc->setExpireDelay(5 * 60 * 1000);
                 rLoc->setMaxVisitors(15, 0);
 
-                rLoc->addPoint(&point);
+                rLoc->addPoint(storeDestinationPoint(point));
                 rpgNpcs.push_back(rLoc);
                 break;
             }
@@ -2308,7 +2327,7 @@ void TravelMgr::LoadQuestTravelTable()
             gLoc->setMaxVisitors(100, 0);
 
             point = WorldPosition(u.map, u.x, u.y, u.z, u.o);
-            gLoc->addPoint(&point);
+            gLoc->addPoint(storeDestinationPoint(point));
             grindMobs.push_back(gLoc);
         }
 
@@ -2321,7 +2340,7 @@ void TravelMgr::LoadQuestTravelTable()
             bLoc->setExpireDelay(5 * 60 * 1000);
             bLoc->setMaxVisitors(0, 0);
 
-            bLoc->addPoint(&point);
+            bLoc->addPoint(storeDestinationPoint(point));
             bossMobs.push_back(bLoc);
         }
     }
@@ -2362,9 +2381,11 @@ void TravelMgr::LoadQuestTravelTable()
             loc = iloc->second;
         }
 
-        loc->addPoint(&point);
+        loc->addPoint(storeDestinationPoint(point));
     }
 
+    buildDestinationIndexes();
+
     // Clear these logs files
     sPlayerbotAIConfig.openLog("zones.csv", "w");
     sPlayerbotAIConfig.openLog("creatures.csv", "w");
@@ -3968,6 +3989,298 @@ bool TravelMgr::getObjectiveStatus(Player* bot, Quest const* pQuest, uint32 obje
     return false;
 }
 
+// Destinations of dests within maxDistance of the bot, looked up in index while it covers all of them. Unless
+// inactive ones are wanted, only those in the level and team bracket of the bot are returned.
+template <class D>
+static std::vector<TravelDestination*> GetDestinationsInRange(TravelDestinationIndex const& index,
+                                                              std::vector<D*> const& dests, Player* bot,
+                                                              WorldPosition& botLocation, bool ignoreInactive,
+                                                              float maxDistance)
+{
+    if (maxDistance > 0 && !dests.empty() && index.GetDestinationCount() == dests.size())
+        return index.GetInRadius(botLocation, maxDistance, ignoreInactive ? nullptr : bot);
+
+    std::vector<TravelDestination*> inRange;
+    for (auto& dest : dests)
+    {
+        if (maxDistance > 0 && dest->distanceTo(&botLocation) > maxDistance)
+            continue;
+
+        inRange.push_back(dest);
+    }
+
+    return inRange;
+}
+
+char* strstri(char const* haystack, char const* needle);
+
+// Lowercase runs of letters and digits. A string containing a needle contains the needle's runs inside its own.
+static std::vector<std::string> GetNameTokens(std::string const& text)
+{
+    std::vector<std::string> tokens;
+    std::string token;
+
+    for (char c : text)
+    {
+        if (std::isalnum(static_cast<unsigned char>(c)))
+        {
+            token += static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+            continue;
+        }
+
+        if (!token.empty())
+            tokens.push_back(std::move(token));
+
+        token.clear();
+    }
+
+    if (!token.empty())
+        tokens.push_back(std::move(token));
+
+    return tokens;
+}
+
+static std::vector<uint32> IntersectPositions(std::vector<uint32> const& a, std::vector<uint32> const& b)
+{
+    std::vector<uint32> both;
+    std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(both));
+    return both;
+}
+
+static void SortPositions(std::vector<uint32>& positions)
+{
+    std::sort(positions.begin(), positions.end());
+    positions.erase(std::unique(positions.begin(), positions.end()), positions.end());
+}
+
+WorldPosition* TravelMgr::storeDestinationPoint(WorldPosition const& point)
+{
+    return &destinationPoints.emplace_back(point);
+}
+
+void TravelMgr::buildDestinationIndexes()
+{
+    questGiverIndex.Clear();
+    questTakerIndex.Clear();
+    questObjectiveIndex.Clear();
+    rpgNpcIndex.Clear();
+    grindMobIndex.Clear();
+    bossMobIndex.Clear();
+
+    // The brackets only hold what isActive requires of every bot, the rest is still checked per bot.
+    auto toLevel = [](int32 level) { return uint8(std::clamp(level, 0, 255)); };
+
+    auto questTeams = [](Quest const* quest) -> uint8
+    {
+        uint32 const races = quest ? quest->GetAllowableRaces() : 0;
+        uint8 teams = 0;
+        if (!races || (races & RACEMASK_ALLIANCE))
+            teams |= FACTION_MASK_ALLIANCE;
+        if (!races || (races & RACEMASK_HORDE))
+            teams |= FACTION_MASK_HORDE;
+
+        return teams;
+    };
+
+    // Same faction template masks as PrepareDestinationCache uses.
+    auto creatureTeams = [](CreatureTemplate const* cInfo, bool hostile) -> uint8
+    {
+        FactionTemplateEntry const* factionEntry =
+            cInfo ? sFactionTemplateStore.LookupEntry(cInfo->faction) : nullptr;
+        if (!factionEntry)
+            return FACTION_MASK_ALLIANCE | FACTION_MASK_HORDE;
+
+        uint8 teams = 0;
+        for (uint8 team : {FACTION_MASK_ALLIANCE, FACTION_MASK_HORDE})
+        {
+            bool const possible = hostile ? !((factionEntry->ourMask | factionEntry->friendlyMask) & team)
+                                          : !(factionEntry->hostileMask & team);
+            if (possible)
+                teams |= team;
+        }
+
+        return teams;
+    };
+
+    for (auto& dest : questGivers)
+    {
+        Quest const* quest = dest->GetQuestTemplate();
+        questGiverIndex.Add(dest, quest ? toLevel(quest->GetQuestLevel() - 4) : 0, 255, questTeams(quest));
+    }
+
+    for (auto& quest : quests)
+    {
+        for (auto& dest : quest.second->questTakers)
+            questTakerIndex.Add(dest);
+
+        for (auto& dest : quest.second->questObjectives)
+        {
+            Quest const* questTemplate = dest->GetQuestTemplate();
+            questObjectiveIndex.Add(dest, questTemplate ? toLevel(questTemplate->GetQuestLevel() - 1) : 0);
+        }
+    }
+
+    for (auto& positions : rpgNpcsByFlag)
+        positions.clear();
+
+    rpgNpcsByVendorItem.clear();
+    rpgNpcsByNameToken.clear();
+
+    auto addPosition = [](std::vector<uint32>& positions, uint32 position)
+    {
+        if (positions.empty() || positions.back() != position)
+            positions.push_back(position);
+    };
+
+    for (uint32 i = 0; i < rpgNpcs.size(); ++i)
+    {
+        RpgTravelDestination* dest = rpgNpcs[i];
+        CreatureTemplate const* cInfo = dest->GetCreatureTemplate();
+        rpgNpcIndex.Add(dest, 0, 255, creatureTeams(cInfo, false));
+
+        if (!cInfo)
+            continue;
+
+        for (uint32 bit = 0; bit < rpgNpcsByFlag.size(); ++bit)
+        {
+            if (cInfo->npcflag & (1u << bit))
+                rpgNpcsByFlag[bit].push_back(i);
+        }
+
+        if (VendorItemData const* vItems = sObjectMgr->GetNpcVendorItemList(cInfo->Entry))
+        {
+            for (auto vItem : vItems->m_items)
+                addPosition(rpgNpcsByVendorItem[vItem->item], i);
+        }
+
+        for (std::string const* text : {&cInfo->Name, &cInfo->SubName})
+        {
+            for (std::string& token : GetNameTokens(*text))
+                addPosition(rpgNpcsByNameToken[std::move(token)], i);
+        }
+    }
+
+    for (auto& dest : grindMobs)
+    {
+        CreatureTemplate const* cInfo = dest->GetCreatureTemplate();
+        if (cInfo)
+            grindMobIndex.Add(dest, toLevel(cInfo->maxlevel), toLevel(cInfo->maxlevel + 12),
+                              creatureTeams(cInfo, true));
+        else
+            grindMobIndex.Add(dest);
+    }
+
+    for (auto& dest : bossMobs)
+    {
+        CreatureTemplate const* cInfo = dest->getCreatureTemplate();
+        bossMobIndex.Add(dest, cInfo ? toLevel(cInfo->maxlevel - 3) : 0, 255, creatureTeams(cInfo, true));
+    }
+
+    LOG_INFO("playerbots", ">> Indexed {} quest, {} rpg, {} grind and {} boss destination points.",
+             questGiverIndex.GetPointCount() + questTakerIndex.GetPointCount() + questObjectiveIndex.GetPointCount(),
+             rpgNpcIndex.GetPointCount(), grindMobIndex.GetPointCount(), bossMobIndex.GetPointCount());
+}
+
+std::vector<RpgTravelDestination*> TravelMgr::getRpgNpcs(std::vector<NPCFlags> const& flags, std::string const& name,
+                                                         std::vector<uint32> const& items)
+{
+    std::vector<RpgTravelDestination*> npcs;
+
+    auto hasName = [&name](CreatureTemplate const* cInfo)
+    {
+        return name.empty() || strstri(cInfo->Name.c_str(), name.c_str()) ||
+               strstri(cInfo->SubName.c_str(), name.c_str());
+    };
+
+    // Not indexed yet, check every npc.
+    if (rpgNpcIndex.GetDestinationCount() != rpgNpcs.size())
+    {
+        for (auto& dest : rpgNpcs)
+        {
+            CreatureTemplate const* cInfo = dest->GetCreatureTemplate();
+            if (!cInfo)
+                continue;
+
+            if (std::none_of(flags.begin(), flags.end(), [cInfo](NPCFlags flag) { return cInfo->npcflag & flag; }))
+                continue;
+
+            if (!hasName(cInfo))
+                continue;
+
+            if (!items.empty())
+            {
+                VendorItemData const* vItems = sObjectMgr->GetNpcVendorItemList(cInfo->Entry);
+                auto const sells = [&items](auto const* vItem)
+                { return std::find(items.begin(), items.end(), vItem->item) != items.end(); };
+
+                if (!vItems || std::none_of(vItems->m_items.begin(), vItems->m_items.end(), sells))
+                    continue;
+            }
+
+            npcs.push_back(dest);
+        }
+
+        return npcs;
+    }
+
+    std::vector<uint32> found;
+    for (NPCFlags flag : flags)
+    {
+        for (uint32 bit = 0; bit < rpgNpcsByFlag.size(); ++bit)
+        {
+            if (flag & (1u << bit))
+                found.insert(found.end(), rpgNpcsByFlag[bit].begin(), rpgNpcsByFlag[bit].end());
+        }
+    }
+
+    SortPositions(found);
+
+    if (!items.empty() && !found.empty())
+    {
+        std::vector<uint32> selling;
+        for (uint32 item : items)
+        {
+            auto const itr = rpgNpcsByVendorItem.find(item);
+            if (itr != rpgNpcsByVendorItem.end())
+                selling.insert(selling.end(), itr->second.begin(), itr->second.end());
+        }
+
+        SortPositions(selling);
+        found = IntersectPositions(found, selling);
+    }
+
+    if (!name.empty() && !found.empty())
+    {
+        // Only npcs with a word containing the longest word of name can contain name, strstri confirms below.
+        std::vector<std::string> tokens = GetNameTokens(name);
+        auto const longest = std::max_element(tokens.begin(), tokens.end(),
+                                              [](std::string const& a, std::string const& b)
+                                              { return a.size() < b.size(); });
+
+        if (longest != tokens.end())
+        {
+            std::vector<uint32> named;
+            for (auto const& [token, positions] : rpgNpcsByNameToken)
+            {
+                if (token.find(*longest) != std::string::npos)
+                    named.insert(named.end(), positions.begin(), positions.end());
+            }
+
+            SortPositions(named);
+            found = IntersectPositions(found, named);
+        }
+    }
+
+    for (uint32 position : found)
+    {
+        RpgTravelDestination* dest = rpgNpcs[position];
+        if (hasName(dest->GetCreatureTemplate()))
+            npcs.push_back(dest);
+    }
+
+    return npcs;
+}
+
 std::vector<TravelDestination*> TravelMgr::getQuestTravelDestinations(Player* bot, int32 questId, bool ignoreFull,
                                                                       bool ignoreInactive, float maxDistance,
                                                                       bool ignoreObjectives)
@@ -3978,16 +4291,38 @@ std::vector<TravelDestination*> TravelMgr::getQuestTravelDestinations(Player* bo
 
     if (!questId)
     {
-        for (auto& dest : questGivers)
+        for (auto& dest : GetDestinationsInRange(questGiverIndex, questGivers, bot, botLocation, ignoreInactive,
+                                                 maxDistance))
         {
             if (!ignoreInactive && !dest->isActive(bot))
                 continue;
 
-            if (maxDistance > 0 && dest->distanceTo(&botLocation) > maxDistance)
-                continue;
-
             retTravelLocations.push_back(dest);
         }
+
+        if (maxDistance > 0 && questTakerIndex.GetDestinationCount())
+        {
+            Player* bracketBot = ignoreInactive ? nullptr : bot;
+            std::vector<TravelDestination*> dests = questTakerIndex.GetInRadius(botLocation, maxDistance, bracketBot);
+
+            if (!ignoreObjectives)
+            {
+                std::vector<TravelDestination*> objectives =
+                    questObjectiveIndex.GetInRadius(botLocation, maxDistance, bracketBot);
+                dests.insert(dests.end(), objectives.begin(), objectives.end());
+            }
+
+            for (auto& dest : dests)
+            {
+                if (!ignoreInactive && !dest->isActive(bot))
+                    continue;
+
+                retTravelLocations.push_back(dest);
+            }
+
+            return retTravelLocations;
+        }
+
         for (auto& quest : quests)
         {
             for (auto& dest : quest.second->questTakers)
@@ -4016,7 +4351,8 @@ std::vector<TravelDestination*> TravelMgr::getQuestTravelDestinations(Player* bo
     }
     else if (questId == -1)
     {
-        for (auto& dest : questGivers)
+        for (auto& dest : GetDestinationsInRange(questGiverIndex, questGivers, bot, botLocation, ignoreInactive,
+                                                 maxDistance))
         {
             if (!ignoreInactive && !dest->isActive(bot))
                 continue;
@@ -4024,9 +4360,6 @@ std::vector<TravelDestination*> TravelMgr::getQuestTravelDestinations(Player* bo
             if (dest->isFull(ignoreFull))
                 continue;
 
-            if (maxDistance > 0 && dest->distanceTo(&botLocation) > maxDistance)
-                continue;
-
             retTravelLocations.push_back(dest);
         }
     }
@@ -4077,7 +4410,7 @@ std::vector<TravelDestination*> TravelMgr::getRpgTravelDestinations(Player* bot,
 
     std::vector<TravelDestination*> retTravelLocations;
 
-    for (auto& dest : rpgNpcs)
+    for (auto& dest : GetDestinationsInRange(rpgNpcIndex, rpgNpcs, bot, botLocation, ignoreInactive, maxDistance))
     {
         if (!ignoreInactive && !dest->isActive(bot))
             continue;
@@ -4085,9 +4418,6 @@ std::vector<TravelDestination*> TravelMgr::getRpgTravelDestinations(Player* bot,
         if (dest->isFull(ignoreFull))
             continue;
 
-        if (maxDistance > 0 && dest->distanceTo(&botLocation) > maxDistance)
-            continue;
-
         retTravelLocations.push_back(dest);
     }
 
@@ -4122,7 +4452,7 @@ std::vector<TravelDestination*> TravelMgr::getGrindTravelDestinations(Player* bo
 
     std::vector<TravelDestination*> retTravelLocations;
 
-    for (auto& dest : grindMobs)
+    for (auto& dest : GetDestinationsInRange(grindMobIndex, grindMobs, bot, botLocation, ignoreInactive, maxDistance))
     {
         if (!ignoreInactive && !dest->isActive(bot))
             continue;
@@ -4130,7 +4460,25 @@ std::vector<TravelDestination*> TravelMgr::getGrindTravelDestinations(Player* bo
         if (dest->isFull(ignoreFull))
             continue;
 
-        if (maxDistance > 0 && dest->distanceTo(&botLocation) > maxDistance)
+        retTravelLocations.push_back(dest);
+    }
+
+    return retTravelLocations;
+}
+
+std::vector<TravelDestination*> TravelMgr::getBossTravelDestinations(Player* bot, bool ignoreFull, bool ignoreInactive,
+                                                                     float maxDistance)
+{
+    WorldPosition botLocation(bot);
+
+    std::vector<TravelDestination*> retTravelLocations;
+
+    for (auto& dest : GetDestinationsInRange(bossMobIndex, bossMobs, bot, botLocation, ignoreInactive, maxDistance))
+    {
+        if (!ignoreInactive && !dest->isActive(bot))
+            continue;
+
+        if (dest->isFull(ignoreFull))
             continue;
 
         retTravelLocations.push_back(dest);
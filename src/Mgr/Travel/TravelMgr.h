@@ -7,8 +7,11 @@
 #ifndef PLAYERBOTS_TRAVELMGR_H
 #define PLAYERBOTS_TRAVELMGR_H
 
+#include <array>
 #include <boost/functional/hash.hpp>
+#include <deque>
 #include <map>
+#include <memory>
 #include <random>
 
 #include "AiObject.h"
@@ -16,6 +19,7 @@
 #include "GameObject.h"
 #include "GridDefines.h"
 #include "PlayerbotAIConfig.h"
+#include "TravelDestinationIndex.h"
 
 class Creature;
 class GuidPosition;
@@ -23,6 +27,8 @@ class ObjectGuid;
 class Quest;
 class Player;
 class PlayerbotAI;
+class TravelPath;
+class TravelRoutePlan;
 
 struct QuestStatusData;
 
@@ -470,6 +476,8 @@ public:
 
     WorldPosition* getPointTo() { return &pointTo; }
 
+    float getPortalLength() { return portalLength; }
+
     bool isUseful(WorldPosition point) { return isFrom(point) || isTo(point); }
 
     float distance(WorldPosition point)
@@ -791,6 +799,11 @@ public:
 
     float distance(Player* bot);
 
+    // Node route to the target, planned off the map thread. The path is picked up on a later update.
+    void requestPath(Player* bot);
+    bool isPathPending();
+    TravelPath* getPath();
+
     WorldPosition* getPosition();
     TravelDestination* getDestination();
 
@@ -841,6 +854,8 @@ protected:
 
     TravelDestination* tDestination = nullptr;
     WorldPosition* wPosition = nullptr;
+
+    std::shared_ptr<TravelRoutePlan> routePlan;
 };
 
 // General container for all travel destinations.
@@ -922,6 +937,14 @@ public:
 
     void setNullTravelTarget(Player* player);
 
+    // Points of loaded destinations, destinations keep pointers to them.
+    WorldPosition* storeDestinationPoint(WorldPosition const& point);
+    void buildDestinationIndexes();
+    // Rpg npcs with any of flags, selling any of items and with name in their name or subname (the last two only
+    // when given), in rpgNpcs order.
+    std::vector<RpgTravelDestination*> getRpgNpcs(std::vector<NPCFlags> const& flags, std::string const& name = "",
+                                                  std::vector<uint32> const& items = {});
+
     void addMapTransfer(WorldPosition start, WorldPosition end, float portalDistance = 0.1f, bool makeShortcuts = true);
     void loadMapTransfers();
     float mapTransDistance(WorldPosition start, WorldPosition end);
@@ -956,11 +979,26 @@ public:
     std::vector<GrindTravelDestination*> grindMobs;
     std::vector<BossTravelDestination*> bossMobs;
 
+    // Built from the lists above (and the quest takers and objectives of all quests) once they are loaded.
+    TravelDestinationIndex questGiverIndex;
+    TravelDestinationIndex questTakerIndex;
+    TravelDestinationIndex questObjectiveIndex;
+    TravelDestinationIndex rpgNpcIndex;
+    TravelDestinationIndex grindMobIndex;
+    TravelDestinationIndex bossMobIndex;
+
+    // Inverted indexes over rpgNpcs, each holding ascending positions in rpgNpcs.
+    std::array<std::vector<uint32>, 32> rpgNpcsByFlag;                    // npcflag bit
+    std::unordered_map<uint32, std::vector<uint32>> rpgNpcsByVendorItem;  // item sold
+    std::unordered_map<std::string, std::vector<uint32>> rpgNpcsByNameToken;  // lowercase word of name or subname
+
     std::unordered_map<uint32, ExploreTravelDestination*> exploreLocs;
     std::unordered_map<uint32, QuestContainer*> quests;
 
     std::vector<std::tuple<uint32, uint8, uint8>> badVmap, badMmap;
 
+    std::deque<WorldPosition> destinationPoints;
+
     std::unordered_map<std::pair<uint32, uint32>, std::vector<mapTransfer>, boost::hash<std::pair<uint32, uint32>>>
         mapTransfersMap;
 
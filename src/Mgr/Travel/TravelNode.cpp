@@ -6,16 +6,76 @@
 
 #include "TravelNode.h"
 
+#include <algorithm>
+#include <boost/crc.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <functional>
 #include <iomanip>
+#include <queue>
 #include <regex>
+#include <thread>
 #include <unordered_set>
 
 #include "BudgetValues.h"
+#include "Chat.h"
 #include "PathGenerator.h"
 #include "Playerbots.h"
 #include "RaceMgr.h"
 #include "ServerFacade.h"
 #include "TransportMgr.h"
+#include "World.h"
+
+TravelNodeBotState::TravelNodeBotState(Player* bot)
+{
+    if (!bot)
+        return;
+
+    PlayerbotAI* botAI = GET_PLAYERBOT_AI(bot);
+
+    hasBot = true;
+    guid = bot->GetGUID();
+    alive = bot->IsAlive();
+    teamAlliance = bot->GetTeamId() == TEAM_ALLIANCE;
+    allianceFriend =
+        Unit::GetFactionReactionTo(bot->GetFactionTemplateEntry(), sFactionTemplateStore.LookupEntry(1)) > REP_NEUTRAL;
+    taxiCheater = bot->isTaxiCheater();
+    hearthReady = botAI && !bot->HasSpellCooldown(8690) && alive;
+    debugMove = botAI && botAI->HasStrategy("debug move", BOT_STATE_NON_COMBAT);
+    level = bot->GetLevel();
+
+    runSpeed = bot->GetSpeed(MOVE_RUN);
+    swimSpeed = bot->GetSpeed(MOVE_SWIM);
+    if (bot->HasSpell(1066))
+        swimSpeed *= 1.5;
+
+    if (!botAI)
+        gold = bot->GetMoney();
+    else
+    {
+        AiObjectContext* context = botAI->GetAiObjectContext();
+
+        if (botAI->HasCheat(BotCheatMask::gold))
+            gold = 10000000;
+        else
+            gold = AI_VALUE2(uint32, "free money for", (uint32)NeedMoneyFor::travel);
+
+        if (hearthReady)
+            homeBind = AI_VALUE(WorldPosition, "home bind");
+    }
+
+    if (!taxiCheater)
+    {
+        // Taxi node 0 does not exist and is not part of the taxi mask.
+        taxiNodes.resize(sTaxiNodesStore.GetNumRows(), false);
+        for (uint32 i = 1; i < taxiNodes.size(); ++i)
+            taxiNodes[i] = bot->m_taxi.IsTaximaskNodeKnown(i);
+    }
+}
 
 // TravelNodePath(float distance = 0.1f, float extraCost = 0, TravelNodePathType pathType = TravelNodePathType::walk,
 // uint32 pathObject = 0, bool calculated = false, std::vector<uint8> maxLevelCreature = { 0,0,0 }, float swimDistance =
@@ -100,7 +160,7 @@ void TravelNodePath::calculateCost(bool distanceOnly)
 }
 
 // The cost to travel this path.
-float TravelNodePath::getCost(Player* bot, uint32 cGold)
+float TravelNodePath::getCost(TravelNodeBotState const* bot, uint32 cGold)
 {
     float modifier = 1.0f;  // Global modifier
     float timeCost = 0.1f;
@@ -112,7 +172,7 @@ float TravelNodePath::getCost(Player* bot, uint32 cGold)
     {
         if (getPathType() == TravelNodePathType::flightPath && pathObject)
         {
-            if (!bot->IsAlive())
+            if (!bot->alive)
                 return -1;
 
             TaxiPathEntry const* taxiPath = sTaxiPathStore.LookupEntry(pathObject);
@@ -120,29 +180,24 @@ float TravelNodePath::getCost(Player* bot, uint32 cGold)
             if (!taxiPath)
                 return -1;
 
-            if (!bot->isTaxiCheater() && taxiPath->price > cGold)
+            if (!bot->taxiCheater && taxiPath->price > cGold)
                 return -1;
 
-            if (!bot->isTaxiCheater() && !bot->m_taxi.IsTaximaskNodeKnown(taxiPath->to))
+            if (!bot->taxiCheater && !bot->knowsTaxiNode(taxiPath->to))
                 return -1;
 
             TaxiNodesEntry const* startTaxiNode = sTaxiNodesStore.LookupEntry(taxiPath->from);
             TaxiNodesEntry const* endTaxiNode = sTaxiNodesStore.LookupEntry(taxiPath->to);
-            if (!startTaxiNode || !endTaxiNode ||
-                !startTaxiNode->MountCreatureID[bot->GetTeamId() == TEAM_ALLIANCE ? 1 : 0] ||
-                !endTaxiNode->MountCreatureID[bot->GetTeamId() == TEAM_ALLIANCE ? 1 : 0])
+            if (!startTaxiNode || !endTaxiNode || !startTaxiNode->MountCreatureID[bot->teamAlliance ? 1 : 0] ||
+                !endTaxiNode->MountCreatureID[bot->teamAlliance ? 1 : 0])
                 return -1;
         }
 
-        speed = bot->GetSpeed(MOVE_RUN);
-        swimSpeed = bot->GetSpeed(MOVE_SWIM);
+        speed = bot->runSpeed;
+        swimSpeed = bot->swimSpeed;
 
-        if (bot->HasSpell(1066))
-            swimSpeed *= 1.5;
-
-        uint32 level = bot->GetLevel();
-        bool isAlliance = Unit::GetFactionReactionTo(bot->GetFactionTemplateEntry(),
-                                                     sFactionTemplateStore.LookupEntry(1)) > REP_NEUTRAL;
+        uint32 level = bot->level;
+        bool isAlliance = bot->allianceFriend;
 
         int factionAnnoyance = 0;
         if (maxLevelCreature.size() > 0)
@@ -499,7 +554,7 @@ bool TravelNode::cropUselessLinks()
             }
             else
             {
-                TravelNodeRoute route = TravelNodeMap::instance().getRoute(firstNode, secondNode, false);
+                TravelNodeRoute route = TravelNodeMap::instance().getRoute(firstNode, secondNode, nullptr);
 
                 if (route.isEmpty())
                     continue;
@@ -547,7 +602,7 @@ bool TravelNode::cropUselessLinks()
                 }
                 else
                 {
-                    TravelNodeRoute route = TravelNodeMap::instance().getRoute(firstNode, secondNode, false);
+                    TravelNodeRoute route = TravelNodeMap::instance().getRoute(firstNode, secondNode, nullptr);
 
                     if (route.isEmpty())
                         continue;
@@ -1082,8 +1137,12 @@ TravelNode* TravelNodeMap::addNode(WorldPosition pos, std::string const prefered
 
     newNode = new TravelNode(pos, finalName, isImportant);
 
+    newNode->setRouteId(m_nodes.size());
     m_nodes.push_back(newNode);
 
+    clearLandmarks();
+    clearRouteCache();
+
     return newNode;
 }
 
@@ -1101,6 +1160,12 @@ void TravelNodeMap::removeNode(TravelNode* node)
     }
 
     m_nodes.erase(std::remove(m_nodes.begin(), m_nodes.end(), nullptr), m_nodes.end());
+
+    for (uint32 i = 0; i < m_nodes.size(); i++)
+        m_nodes[i]->setRouteId(i);
+
+    clearLandmarks();
+    clearRouteCache();
 }
 
 void TravelNodeMap::fullLinkNode(TravelNode* startNode, Unit* bot)
@@ -1168,9 +1233,411 @@ TravelNode* TravelNodeMap::getNode(WorldPosition pos, [[maybe_unused]] std::vect
     return nullptr;
 }
 
-TravelNodeRoute TravelNodeMap::getRoute(TravelNode* start, TravelNode* goal, Player* bot)
+// Route search buffers of the calling thread.
+static thread_local TravelNodeRouteSearch routeSearch;
+
+void TravelNodeRouteSearch::begin(std::vector<TravelNode*> const& mapNodes)
+{
+    nodes = &mapNodes;
+    extraNodes.clear();
+    heap.clear();
+    order = 0;
+    expanded = 0;
+
+    if (states.size() < nodes->size())
+        states.resize(nodes->size());
+
+    // Bump the generation so stale states are reset lazily on first touch.
+    if (++search == 0)
+    {
+        for (auto& state : states)
+            state.search = 0;
+        search = 1;
+    }
+}
+
+uint32 TravelNodeRouteSearch::getId(TravelNode* node)
+{
+    uint32 id = node->getRouteId();
+    if (id < nodes->size() && (*nodes)[id] == node)
+        return id;
+
+    // Portal and bot nodes are not part of the node map and get a temporary id behind it.
+    for (uint32 i = 0; i < extraNodes.size(); i++)
+        if (extraNodes[i] == node)
+            return nodes->size() + i;
+
+    extraNodes.push_back(node);
+    if (states.size() < nodes->size() + extraNodes.size())
+        states.resize(nodes->size() + extraNodes.size());
+
+    return nodes->size() + extraNodes.size() - 1;
+}
+
+TravelNodeRouteState& TravelNodeRouteSearch::getState(uint32 id)
+{
+    TravelNodeRouteState& state = states[id];
+    if (state.search != search)
+    {
+        state = TravelNodeRouteState();
+        state.search = search;
+    }
+
+    return state;
+}
+
+void TravelNodeRouteSearch::push(uint32 id)
+{
+    states[id].order = order++;
+    heap.push_back(id);
+    states[id].heapIndex = heap.size() - 1;
+    siftUp(heap.size() - 1);
+}
+
+void TravelNodeRouteSearch::update(uint32 id)
+{
+    states[id].order = order++;
+    siftUp(states[id].heapIndex);
+    siftDown(states[id].heapIndex);
+}
+
+uint32 TravelNodeRouteSearch::pop()
+{
+    uint32 top = heap.front();
+    uint32 last = heap.back();
+    heap.pop_back();
+    states[top].heapIndex = TravelNode::NO_ROUTE_ID;
+
+    if (!heap.empty())
+    {
+        place(0, last);
+        siftDown(0);
+    }
+
+    return top;
+}
+
+void TravelNodeRouteSearch::siftUp(uint32 pos)
+{
+    uint32 id = heap[pos];
+    while (pos > 0)
+    {
+        uint32 parentPos = (pos - 1) / 2;
+        if (!less(id, heap[parentPos]))
+            break;
+
+        place(pos, heap[parentPos]);
+        pos = parentPos;
+    }
+
+    place(pos, id);
+}
+
+void TravelNodeRouteSearch::siftDown(uint32 pos)
+{
+    uint32 id = heap[pos];
+    uint32 size = heap.size();
+    while (true)
+    {
+        uint32 child = pos * 2 + 1;
+        if (child >= size)
+            break;
+
+        if (child + 1 < size && less(heap[child + 1], heap[child]))
+            child++;
+
+        if (!less(heap[child], id))
+            break;
+
+        place(pos, heap[child]);
+        pos = child;
+    }
+
+    place(pos, id);
+}
+
+bool TravelNodeRouteCache::get(uint64 key, std::vector<TravelNode*>& nodes)
+{
+    Shard& shard = shards[key % SHARDS];
+    std::lock_guard<std::mutex> guard(shard.mtx);
+
+    auto itr = shard.index.find(key);
+    if (itr == shard.index.end())
+        return false;
+
+    shard.entries.splice(shard.entries.begin(), shard.entries, itr->second);
+    nodes = itr->second->second;
+
+    return true;
+}
+
+void TravelNodeRouteCache::put(uint64 key, std::vector<TravelNode*> const& nodes, uint32 capacity)
+{
+    uint32 shardCapacity = std::max(1u, capacity / SHARDS);
+
+    Shard& shard = shards[key % SHARDS];
+    std::lock_guard<std::mutex> guard(shard.mtx);
+
+    auto itr = shard.index.find(key);
+    if (itr != shard.index.end())
+    {
+        itr->second->second = nodes;
+        shard.entries.splice(shard.entries.begin(), shard.entries, itr->second);
+        return;
+    }
+
+    shard.entries.emplace_front(key, nodes);
+    shard.index[key] = shard.entries.begin();
+
+    while (shard.entries.size() > shardCapacity)
+    {
+        shard.index.erase(shard.entries.back().first);
+        shard.entries.pop_back();
+    }
+}
+
+void TravelNodeRouteCache::clear()
+{
+    for (auto& shard : shards)
+    {
+        std::lock_guard<std::mutex> guard(shard.mtx);
+        shard.entries.clear();
+        shard.index.clear();
+    }
+}
+
+TravelNodeRoute TravelNodeMap::getRoute(TravelNode* start, TravelNode* goal, TravelNodeBotState const& botState)
+{
+    if (start == goal)
+        return TravelNodeRoute();
+
+    if (m_recordRoutes)
+        recordRoute(start, goal);
+
+    TravelNodeBotState const* bot = botState.hasBot ? &botState : nullptr;
+
+    uint64 key;
+    if (!sPlayerbotAIConfig.travelRouteCacheSize || !getRouteCacheKey(start, goal, bot, key))
+        return searchRoute(start, goal, bot, true);
+
+    std::vector<TravelNode*> nodes;
+    if (m_routeCache.get(key, nodes) && isRouteUsable(nodes, bot))
+    {
+        m_routeCacheHits->add();
+        return TravelNodeRoute(nodes);
+    }
+
+    m_routeCacheMisses->add();
+
+    TravelNodeRoute route = searchRoute(start, goal, bot, true);
+
+    // Routes through per bot portal nodes can not be shared.
+    nodes = route.getNodes();
+    for (auto& node : nodes)
+        if (node->getRouteId() >= m_nodes.size() || m_nodes[node->getRouteId()] != node)
+            return route;
+
+    m_routeCache.put(key, nodes, sPlayerbotAIConfig.travelRouteCacheSize);
+
+    return route;
+}
+
+// Packs the node pair with coarse bot properties that change the link costs: money (log2 bracket), level
+// bracket, team and taxi cheat. Cached routes are re-validated with the exact bot.
+// Bots with a ready hearthstone are not cached: whether hearthing is the shortcut depends on where their home is,
+// and a route that did not hearth would be handed to every other hearth ready bot.
+bool TravelNodeMap::getRouteCacheKey(TravelNode* start, TravelNode* goal, TravelNodeBotState const* bot, uint64& key)
+{
+    static constexpr uint32 idBits = 24;
+
+    uint32 startId = start->getRouteId();
+    uint32 goalId = goal->getRouteId();
+
+    if (startId >= m_nodes.size() || m_nodes[startId] != start || goalId >= m_nodes.size() || m_nodes[goalId] != goal)
+        return false;
+
+    if (startId >= (1u << idBits) || goalId >= (1u << idBits))
+        return false;
+
+    if (bot && bot->hearthReady)
+        return false;
+
+    uint64 botBits = 0;
+    if (bot)
+    {
+        uint32 goldBracket = 0;
+        for (uint32 gold = bot->gold; gold; gold >>= 1)
+            goldBracket++;
+
+        botBits = 1;                                                    // bit 0: has bot
+        botBits |= uint64(goldBracket) << 1;                            // bits 1-6
+        botBits |= uint64(std::min<uint32>(bot->level / 10, 15)) << 7;  // bits 7-10
+        botBits |= uint64(bot->teamAlliance) << 11;                     // bit 11
+        botBits |= uint64(bot->taxiCheater) << 12;                      // bit 12
+    }
+
+    key = uint64(startId) | (uint64(goalId) << idBits) | (botBits << (idBits * 2));
+
+    return true;
+}
+
+// Checks a cached route against the exact bot state (known flight paths, money, alive).
+bool TravelNodeMap::isRouteUsable(std::vector<TravelNode*> const& nodes, TravelNodeBotState const* bot)
+{
+    uint32 gold = bot ? bot->gold : 0;
+    for (uint32 i = 0; i + 1 < nodes.size(); i++)
+    {
+        auto link = nodes[i]->getLinks()->find(nodes[i + 1]);
+        if (link == nodes[i]->getLinks()->end())
+            return false;
+
+        if (link->second->getCost(bot, gold) <= 0)
+            return false;
+
+        if (bot && !bot->taxiCheater)
+            gold -= link->second->getPrice();
+    }
+
+    return true;
+}
+
+TravelNode* TravelNodeMap::getTeleportNode(ObjectGuid guid, uint32 id)
+{
+    std::lock_guard<std::mutex> guard(m_teleportMtx);
+
+    auto botNodes = teleportNodes.find(guid);
+    if (botNodes == teleportNodes.end())
+        return nullptr;
+
+    auto node = botNodes->second.find(id);
+    return node == botNodes->second.end() ? nullptr : node->second;
+}
+
+void TravelNodeMap::setTeleportNode(ObjectGuid guid, uint32 id, TravelNode* node)
+{
+    std::lock_guard<std::mutex> guard(m_teleportMtx);
+    teleportNodes[guid][id] = node;
+}
+
+TravelNodeRoute TravelNodeMap::searchRoute(TravelNode* start, TravelNode* goal, TravelNodeBotState const* bot,
+                                           bool useLandmarks)
+{
+    float botSpeed = bot ? bot->runSpeed : 7.0f;
+    // Landmark distances count walks in yards and other paths at 7 yards per second (getMinCost). Dividing by
+    // the fastest speed getCost can use for this bot keeps the bound below the real cost of every link.
+    float landmarkSpeed = bot ? std::max({7.0f, bot->runSpeed, bot->swimSpeed}) : 8.0f;
+
+    if (start == goal)
+        return TravelNodeRoute();
+
+    // A* over dense route ids with reusable per-thread buffers.
+    TravelNodeRouteSearch& search = routeSearch;
+    search.begin(m_nodes);
+
+    // The landmark (ALT) bound only applies when the goal is part of the node map the table was built for.
+    uint32 goalId = goal->getRouteId();
+    if (!useLandmarks || !hasLandmarks() || goalId >= m_nodes.size() || m_nodes[goalId] != goal)
+        goalId = TravelNode::NO_ROUTE_ID;
+
+    uint32 startId = search.getId(start);
+    search.getState(startId).currentGold = bot ? bot->gold : 0;
+
+    if (bot && bot->hearthReady)
+    {
+        TravelNode* homeNode = TravelNodeMap::instance().getNode(bot->homeBind, nullptr, 10.0f);
+        if (homeNode)
+        {
+            PortalNode* portNode = (PortalNode*)getTeleportNode(bot->guid, 8690);
+            if (!portNode)
+            {
+                portNode = new PortalNode(start);
+
+                setTeleportNode(bot->guid, 8690, portNode);
+            }
+
+            portNode->SetPortal(start, homeNode, 8690);
+
+            uint32 portId = search.getId(portNode);
+            TravelNodeRouteState& portState = search.getState(portId);
+
+            portState.m_g = 10 * MINUTE;
+            portState.m_f = portState.m_g + portNode->fDist(goal) / botSpeed;
+
+            search.push(portId);
+        }
+    }
+
+    if (search.empty() && !start->hasRouteTo(goal))
+        return TravelNodeRoute();
+
+    search.push(startId);
+
+    while (!search.empty())
+    {
+        uint32 currentId = search.pop();  // pop n node from open for which f is minimal
+        TravelNode* currentNode = search.getNode(currentId);
+        TravelNodeRouteState& current = search.getState(currentId);
+
+        current.close = true;
+        search.addExpanded();
+
+        float currentG = current.m_g;
+        uint32 currentGold = current.currentGold;
+
+        if (currentNode == goal || (currentNode->getMapId() != start->getMapId() && currentNode->isWalking()))
+        {
+            std::vector<TravelNode*> path;
+
+            for (uint32 id = currentId; id != TravelNode::NO_ROUTE_ID; id = search.getState(id).parent)
+                path.push_back(search.getNode(id));
+
+            reverse(path.begin(), path.end());
+
+            return TravelNodeRoute(path);
+        }
+
+        for (auto const& link : *currentNode->getLinks())  // for each successor n' of n
+        {
+            TravelNode* linkNode = link.first;
+            float linkCost = link.second->getCost(bot, currentGold);
+
+            if (linkCost <= 0)
+                continue;
+
+            uint32 childId = search.getId(linkNode);
+            TravelNodeRouteState& child = search.getState(childId);
+            bool childOpen = search.isOpen(childId);
+
+            float g = currentG + linkCost;  // stance from start + distance between the two nodes
+            if ((childOpen || child.close) && child.m_g <= g)  // n' is already in open or closed with a lower cost g(n')
+                continue;                                       // consider next successor
+
+            float h = linkNode->fDist(goal) / botSpeed;
+            if (goalId != TravelNode::NO_ROUTE_ID && childId < m_nodes.size())
+                h = std::max(h, getLandmarkDistance(childId, goalId) / landmarkSpeed);
+
+            child.m_g = g;
+            child.m_f = g + h;  // compute f(n')
+            child.parent = currentId;
+
+            if (bot && !bot->taxiCheater)
+                child.currentGold = currentGold - link.second->getPrice();
+
+            child.close = false;
+
+            if (childOpen)
+                search.update(childId);
+            else
+                search.push(childId);
+        }
+    }
+
+    return TravelNodeRoute();
+}
+
+TravelNodeRoute TravelNodeMap::getRouteLegacy(TravelNode* start, TravelNode* goal, TravelNodeBotState const* bot)
 {
-    float botSpeed = bot ? bot->GetSpeed(MOVE_RUN) : 7.0f;
+    float botSpeed = bot ? bot->runSpeed : 7.0f;
 
     if (start == goal)
         return TravelNodeRoute();
@@ -1190,32 +1657,18 @@ TravelNodeRoute TravelNodeMap::getRoute(TravelNode* start, TravelNode* goal, Pla
 
     if (bot)
     {
-        PlayerbotAI* botAI = GET_PLAYERBOT_AI(bot);
-        if (botAI)
-        {
-            if (botAI->HasCheat(BotCheatMask::gold))
-                startStub->currentGold = 10000000;
-            else
-            {
-                AiObjectContext* context = botAI->GetAiObjectContext();
-                startStub->currentGold = AI_VALUE2(uint32, "free money for", (uint32)NeedMoneyFor::travel);
-            }
-        }
-        else
-            startStub->currentGold = bot->GetMoney();
+        startStub->currentGold = bot->gold;
 
-        if (!bot->HasSpellCooldown(8690) && bot->IsAlive())
+        if (bot->hearthReady)
         {
-            AiObjectContext* context = botAI->GetAiObjectContext();
-
-            TravelNode* homeNode = TravelNodeMap::instance().getNode(AI_VALUE(WorldPosition, "home bind"), nullptr, 10.0f);
+            TravelNode* homeNode = TravelNodeMap::instance().getNode(bot->homeBind, nullptr, 10.0f);
             if (homeNode)
             {
-                PortalNode* portNode = (PortalNode*)TravelNodeMap::instance().teleportNodes[bot->GetGUID()][8690];
+                PortalNode* portNode = (PortalNode*)getTeleportNode(bot->guid, 8690);
                 {
                     portNode = new PortalNode(start);
 
-                    TravelNodeMap::instance().teleportNodes[bot->GetGUID()][8690] = portNode;
+                    setTeleportNode(bot->guid, 8690, portNode);
                 }
 
                 portNode->SetPortal(start, homeNode, 8690);
@@ -1297,7 +1750,7 @@ TravelNodeRoute TravelNodeMap::getRoute(TravelNode* start, TravelNode* goal, Pla
             childNode->m_h = h;
             childNode->parent = currentNode;
 
-            if (bot && !bot->isTaxiCheater())
+            if (bot && !bot->taxiCheater)
                 childNode->currentGold = currentNode->currentGold - link.second->getPrice();
 
             if (childNode->close)
@@ -1316,53 +1769,192 @@ TravelNodeRoute TravelNodeMap::getRoute(TravelNode* start, TravelNode* goal, Pla
     return TravelNodeRoute();
 }
 
-TravelNodeRoute TravelNodeMap::getRoute(WorldPosition startPos, WorldPosition endPos,
-                                        std::vector<WorldPosition>& startPath, Player* bot)
+void TravelNodeMap::recordRoute(TravelNode* start, TravelNode* goal)
 {
-    if (m_nodes.empty())
-        return TravelNodeRoute();
-
-    std::vector<WorldPosition> newStartPath;
-    std::vector<TravelNode*> startNodes = m_nodes, endNodes = m_nodes;
+    static constexpr uint32 maxRecordedRoutes = 10000;
 
-    if (!startNodes.size() || !endNodes.size())
-         return TravelNodeRoute();
+    uint32 startId = start->getRouteId();
+    uint32 goalId = goal->getRouteId();
 
-    // Partial sort to get the closest 5 nodes at the begin of the array.
-    std::partial_sort(startNodes.begin(), startNodes.begin() + 5, startNodes.end(),
-                      [startPos](TravelNode* i, TravelNode* j) { return i->fDist(startPos) < j->fDist(startPos); });
+    if (startId == TravelNode::NO_ROUTE_ID || goalId == TravelNode::NO_ROUTE_ID)
+        return;
 
-    std::partial_sort(endNodes.begin(), endNodes.begin() + 5, endNodes.end(),
-                      [endPos](TravelNode* i, TravelNode* j) { return i->fDist(endPos) < j->fDist(endPos); });
+    std::lock_guard<std::mutex> guard(m_routeRecordMtx);
+    if (m_routeRecord.size() < maxRecordedRoutes)
+        m_routeRecord.push_back(std::make_pair(std::make_pair(startId, start), std::make_pair(goalId, goal)));
+}
 
-    // Cycle over the combinations of these 5 nodes.
-    uint32 startI = 0, endI = 0;
-    while (startI < 5 && endI < 5)
+// Replays the recorded start/goal pairs through the legacy and the indexed A* and compares the routes.
+void TravelNodeMap::benchRoutes(ChatHandler* handler, uint32 iterations)
+{
+    std::vector<std::pair<std::pair<uint32, TravelNode*>, std::pair<uint32, TravelNode*>>> pairs;
     {
-        TravelNode* startNode = startNodes[startI];
-        TravelNode* endNode = endNodes[endI];
+        std::lock_guard<std::mutex> guard(m_routeRecordMtx);
+        pairs = m_routeRecord;
+    }
 
-        WorldPosition startNodePosition = *startNode->getPosition();
-        WorldPosition endNodePosition = *endNode->getPosition();
+    bool wasRecording = m_recordRoutes.exchange(false);
 
-        float maxStartDistance = startNode->isTransport() ? 20.0f : sPlayerbotAIConfig.targetPosRecalcDistance;
+    uint32 replayed = 0, mismatches = 0, landmarkChanged = 0;
+    uint64 legacyTime = 0, indexedTime = 0, landmarkTime = 0, expanded = 0, landmarkExpanded = 0;
 
-        TravelNodeRoute route = getRoute(startNode, endNode, bot);
+    m_nMapMtx.lock_shared();
 
-        if (!route.isEmpty())
-        {
-            // Check if the bot can actually walk to this start position.
-            newStartPath = startPath;
-            if (startNodePosition.cropPathTo(newStartPath, maxStartDistance) ||
-                startNode->getPosition()->isPathTo(newStartPath = startPos.getPathTo(startNodePosition, nullptr),
-                                                   maxStartDistance))
-            {
-                startPath = newStartPath;
-                return route;
-            }
+    for (auto const& pair : pairs)
+    {
+        // Skip pairs whose nodes were removed or moved since they were recorded.
+        if (pair.first.first >= m_nodes.size() || m_nodes[pair.first.first] != pair.first.second ||
+            pair.second.first >= m_nodes.size() || m_nodes[pair.second.first] != pair.second.second)
+            continue;
 
-            startI++;
-        }
+        TravelNode* start = pair.first.second;
+        TravelNode* goal = pair.second.second;
+        TravelNodeRoute legacyRoute, route, landmarkRoute;
+
+        auto begin = std::chrono::steady_clock::now();
+        for (uint32 i = 0; i < iterations; i++)
+            legacyRoute = getRouteLegacy(start, goal);
+
+        auto middle = std::chrono::steady_clock::now();
+        for (uint32 i = 0; i < iterations; i++)
+            route = searchRoute(start, goal, nullptr, false);
+
+        expanded += routeSearch.getExpanded();
+
+        auto landmarkBegin = std::chrono::steady_clock::now();
+        for (uint32 i = 0; i < iterations; i++)
+            landmarkRoute = searchRoute(start, goal, nullptr, true);
+
+        auto end = std::chrono::steady_clock::now();
+
+        landmarkExpanded += routeSearch.getExpanded();
+
+        legacyTime += std::chrono::duration_cast<std::chrono::microseconds>(middle - begin).count();
+        indexedTime += std::chrono::duration_cast<std::chrono::microseconds>(landmarkBegin - middle).count();
+        landmarkTime += std::chrono::duration_cast<std::chrono::microseconds>(end - landmarkBegin).count();
+
+        if (route.getNodes() != legacyRoute.getNodes())
+            mismatches++;
+
+        if (landmarkRoute.getNodes() != route.getNodes())
+            landmarkChanged++;
+
+        replayed++;
+    }
+
+    m_nMapMtx.unlock_shared();
+    m_recordRoutes = wasRecording;
+
+    if (!replayed)
+    {
+        handler->PSendSysMessage("No recorded routes to replay ({} recorded).", pairs.size());
+        return;
+    }
+
+    float runs = float(replayed) * iterations;
+    handler->PSendSysMessage("Replayed {} of {} recorded routes x{}: legacy {:.1f}us, indexed {:.1f}us per route.",
+                             replayed, pairs.size(), iterations, legacyTime / runs, indexedTime / runs);
+    handler->PSendSysMessage("Indexed search expanded {:.1f} nodes per route, {} routes differ from legacy.",
+                             float(expanded) / replayed, mismatches);
+
+    if (!hasLandmarks())
+    {
+        handler->PSendSysMessage("No route landmarks loaded, use .playerbots debug route landmarks to build them.");
+        return;
+    }
+
+    handler->PSendSysMessage("Landmark search expanded {:.1f} nodes per route ({:.1f}us), {} routes changed.",
+                             float(landmarkExpanded) / replayed, landmarkTime / runs, landmarkChanged);
+}
+
+bool TravelNodeMap::HandleConsoleCommand(ChatHandler* handler, char const* args)
+{
+    TravelNodeMap& nodeMap = TravelNodeMap::instance();
+    std::string const cmd = args ? args : "";
+
+    if (cmd == "record")
+    {
+        nodeMap.m_recordRoutes = !nodeMap.m_recordRoutes;
+        handler->PSendSysMessage("Route recording {}.", nodeMap.m_recordRoutes ? "enabled" : "disabled");
+        return true;
+    }
+
+    if (cmd == "clear")
+    {
+        std::lock_guard<std::mutex> guard(nodeMap.m_routeRecordMtx);
+        nodeMap.m_routeRecord.clear();
+        handler->PSendSysMessage("Recorded routes cleared.");
+        return true;
+    }
+
+    if (cmd == "landmarks")
+    {
+        nodeMap.m_nMapMtx.lock();
+        nodeMap.calculateLandmarks();
+        nodeMap.m_nMapMtx.unlock();
+        handler->PSendSysMessage("Built {} route landmarks for {} nodes.", nodeMap.m_landmarks.size(),
+                                 nodeMap.m_nodes.size());
+        return true;
+    }
+
+    if (cmd.rfind("bench", 0) == 0)
+    {
+        uint32 iterations = cmd.size() > 6 ? std::max(1, atoi(cmd.substr(6).c_str())) : 10;
+        nodeMap.benchRoutes(handler, iterations);
+        return true;
+    }
+
+    handler->PSendSysMessage("Usage: .playerbots debug route record/clear/landmarks/bench [iterations]");
+    return true;
+}
+
+TravelNodeRoute TravelNodeMap::getRoute(WorldPosition startPos, WorldPosition endPos,
+                                        std::vector<WorldPosition>& startPath, TravelNodeBotState const& bot)
+{
+    if (m_nodes.empty())
+        return TravelNodeRoute();
+
+    std::vector<WorldPosition> newStartPath;
+    std::vector<TravelNode*> startNodes = m_nodes, endNodes = m_nodes;
+
+    if (!startNodes.size() || !endNodes.size())
+         return TravelNodeRoute();
+
+    // Partial sort to get the closest 5 nodes at the begin of the array.
+    std::partial_sort(startNodes.begin(), startNodes.begin() + 5, startNodes.end(),
+                      [startPos](TravelNode* i, TravelNode* j) { return i->fDist(startPos) < j->fDist(startPos); });
+
+    std::partial_sort(endNodes.begin(), endNodes.begin() + 5, endNodes.end(),
+                      [endPos](TravelNode* i, TravelNode* j) { return i->fDist(endPos) < j->fDist(endPos); });
+
+    // Cycle over the combinations of these 5 nodes.
+    uint32 startI = 0, endI = 0;
+    while (startI < 5 && endI < 5)
+    {
+        TravelNode* startNode = startNodes[startI];
+        TravelNode* endNode = endNodes[endI];
+
+        WorldPosition startNodePosition = *startNode->getPosition();
+        WorldPosition endNodePosition = *endNode->getPosition();
+
+        float maxStartDistance = startNode->isTransport() ? 20.0f : sPlayerbotAIConfig.targetPosRecalcDistance;
+
+        TravelNodeRoute route = getRoute(startNode, endNode, bot);
+
+        if (!route.isEmpty())
+        {
+            // Check if the bot can actually walk to this start position.
+            newStartPath = startPath;
+            if (startNodePosition.cropPathTo(newStartPath, maxStartDistance) ||
+                startNode->getPosition()->isPathTo(newStartPath = startPos.getPathTo(startNodePosition, nullptr),
+                                                   maxStartDistance))
+            {
+                startPath = newStartPath;
+                return route;
+            }
+
+            startI++;
+        }
 
         // Prefer a differnt end-node.
         endI++;
@@ -1375,13 +1967,14 @@ TravelNodeRoute TravelNodeMap::getRoute(WorldPosition startPos, WorldPosition en
         }
     }
 
-    if (bot && !bot->HasSpellCooldown(8690))
+    if (bot.hasBot && bot.hearthReady)
     {
         startPath.clear();
-        TravelNode* botNode = TravelNodeMap::instance().teleportNodes[bot->GetGUID()][0];
+        TravelNode* botNode = getTeleportNode(bot.guid, 0);
+        if (!botNode)
         {
             botNode = new TravelNode(startPos, "Bot Pos", false);
-            TravelNodeMap::instance().teleportNodes[bot->GetGUID()][0] = botNode;
+            setTeleportNode(bot.guid, 0, botNode);
         }
 
         botNode->setPoint(startPos);
@@ -1401,10 +1994,9 @@ TravelNodeRoute TravelNodeMap::getRoute(WorldPosition startPos, WorldPosition en
     return TravelNodeRoute();
 }
 
-TravelPath TravelNodeMap::getFullPath(WorldPosition startPos, WorldPosition endPos, Player* bot)
+TravelPath TravelNodeMap::getFullPath(WorldPosition startPos, WorldPosition endPos, TravelNodeBotState const& bot)
 {
     TravelPath movePath;
-    PlayerbotAI* botAI = GET_PLAYERBOT_AI(bot);
     std::vector<WorldPosition> beginPath, endPath;
 
     beginPath = endPos.getPathFromPath({startPos}, nullptr, 40);
@@ -1415,7 +2007,7 @@ TravelPath TravelNodeMap::getFullPath(WorldPosition startPos, WorldPosition endP
     //[[Node pathfinding system]]
     // We try to find nodes near the bot and near the end position that have a route between them.
     // Then bot has to move towards/along the route.
-    TravelNodeMap::instance().m_nMapMtx.lock_shared();
+    std::shared_lock<std::shared_timed_mutex> guard(TravelNodeMap::instance().m_nMapMtx);
 
     // Find the route of nodes starting at a node closest to the start position and ending at a node closest to the
     // endposition. Also returns longPath: The path from the start position to the first node in the route.
@@ -1426,7 +2018,7 @@ TravelPath TravelNodeMap::getFullPath(WorldPosition startPos, WorldPosition endP
 
     if (sPlayerbotAIConfig.hasLog("bot_pathfinding.csv"))
     {
-        if (botAI->HasStrategy("debug move", BOT_STATE_NON_COMBAT))
+        if (bot.debugMove)
         {
             sPlayerbotAIConfig.openLog("bot_pathfinding.csv", "w");
             sPlayerbotAIConfig.log("bot_pathfinding.csv", route.print().str().c_str());
@@ -1438,15 +2030,13 @@ TravelPath TravelNodeMap::getFullPath(WorldPosition startPos, WorldPosition endP
 
     if (sPlayerbotAIConfig.hasLog("bot_pathfinding.csv"))
     {
-        if (botAI->HasStrategy("debug move", BOT_STATE_NON_COMBAT))
+        if (bot.debugMove)
         {
             sPlayerbotAIConfig.openLog("bot_pathfinding.csv", "w");
             sPlayerbotAIConfig.log("bot_pathfinding.csv", movePath.print().str().c_str());
         }
     }
 
-    TravelNodeMap::instance().m_nMapMtx.unlock_shared();
-
     return movePath;
 }
 
@@ -1575,13 +2165,16 @@ void TravelNodeMap::manageNodes(Unit* bot, bool mapFull)
             }
         }
 
+        if (rePrint)
+            clearRouteCache();
+
         if (rePrint && (mapFull || !urand(0, 20)))
             printMap();
 
         m_nMapMtx.unlock();
     }
 
-    TravelNodeMap::instance().m_nMapMtx.lock_shared();
+    std::shared_lock<std::shared_timed_mutex> guard(TravelNodeMap::instance().m_nMapMtx);
 
     if (!rePrint && mapFull)
         printMap();
@@ -1861,21 +2454,84 @@ void TravelNodeMap::generateNodes()
     generateZoneMeanNodes();
 }
 
-void TravelNodeMap::generateWalkPaths()
+namespace
 {
-    // Pathfinder
-    std::vector<WorldPosition> ppath;
+    // Runs work(0) .. work(count - 1) on the generation threads. Every item must only change its own data so the
+    // result does not depend on the thread that picked it up. Logs progress and an estimate of the time left.
+    void runGenerationStep(std::string const step, uint32 count, std::function<void(uint32)> const& work)
+    {
+        uint32 threads = sPlayerbotAIConfig.travelNodeGenerationThreads;
+        if (!threads)
+            threads = std::max(1u, std::thread::hardware_concurrency());
 
-    std::map<uint32, bool> nodeMaps;
+        threads = std::min(threads, count);
 
-    for (auto& startNode : TravelNodeMap::instance().getNodes())
-    {
-        nodeMaps[startNode->getMapId()] = true;
+        std::atomic<uint32> next{0};
+        std::atomic<uint32> done{0};
+
+        auto worker = [&]()
+        {
+            for (uint32 i = next++; i < count; i = next++)
+            {
+                work(i);
+                done++;
+            }
+        };
+
+        std::vector<std::thread> workers;
+        for (uint32 i = 1; i < threads; ++i)
+            workers.emplace_back(worker);
+
+        if (threads > 1)
+        {
+            // This thread reports progress while the others work.
+            auto start = std::chrono::steady_clock::now();
+            auto lastLog = start;
+
+            while (done < count)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+                auto now = std::chrono::steady_clock::now();
+                uint32 finished = done;
+                if (now - lastLog < std::chrono::seconds(10) || finished == count)
+                    continue;
+
+                lastLog = now;
+
+                uint64 elapsed = std::chrono::duration_cast<std::chrono::seconds>(now - start).count();
+                uint64 left = finished ? elapsed * (count - finished) / finished : 0;
+
+                LOG_INFO("playerbots", "{}: {}/{} ({}%), about {}s left", step, finished, count,
+                         uint64(finished) * 100 / count, left);
+            }
+        }
+        else
+            worker();
+
+        for (auto& thread : workers)
+            thread.join();
     }
+}
+
+void TravelNodeMap::generateWalkPaths()
+{
+    std::map<uint32, uint32> nodeMaps;
+
+    for (auto& startNode : TravelNodeMap::instance().getNodes())
+        nodeMaps[startNode->getMapId()]++;
 
+    // Paths never cross maps, so each map is linked on its own thread. The biggest maps are started first.
+    std::vector<uint32> mapIds;
     for (auto& map : nodeMaps)
+        mapIds.push_back(map.first);
+
+    std::stable_sort(mapIds.begin(), mapIds.end(),
+                     [&nodeMaps](uint32 i, uint32 j) { return nodeMaps[i] > nodeMaps[j]; });
+
+    runGenerationStep("Calculating walkable paths", mapIds.size(), [&mapIds](uint32 i)
     {
-        for (auto& startNode : TravelNodeMap::instance().getNodes(WorldPosition(map.first, 1, 1)))
+        for (auto& startNode : TravelNodeMap::instance().getNodes(WorldPosition(mapIds[i], 1, 1)))
         {
             if (startNode->isLinked())
                 continue;
@@ -1896,7 +2552,7 @@ void TravelNodeMap::generateWalkPaths()
 
             startNode->setLinked(true);
         }
-    }
+    });
 
     LOG_INFO("playerbots", ">> Generated paths for {} nodes.", TravelNodeMap::instance().getNodes().size());
 }
@@ -2004,10 +2660,14 @@ void TravelNodeMap::removeUselessPaths()
 
         LOG_INFO("playerbots", "Iteration {}, removed {}", it, rem);
     }
+
+    clearRouteCache();
 }
 
 void TravelNodeMap::calculatePathCosts()
 {
+    std::vector<TravelNodePath*> paths;
+
     for (auto& startNode : TravelNodeMap::instance().getNodes())
     {
         for (auto& path : *startNode->getLinks())
@@ -2020,13 +2680,164 @@ void TravelNodeMap::calculatePathCosts()
             if (nodePath->getCalculated())
                 continue;
 
-            nodePath->calculateCost();
+            paths.push_back(nodePath);
         }
     }
 
+    // Each cost only depends on its own path points.
+    runGenerationStep("Calculating path costs", paths.size(), [&paths](uint32 i) { paths[i]->calculateCost(); });
+
     LOG_INFO("playerbots", ">> Calculated pathcost for {} nodes.", TravelNodeMap::instance().getNodes().size());
 }
 
+// Selects landmark nodes and stores the shortest path lower bounds from and to each of them (ALT heuristic).
+// Link costs are the cheapest any bot can get (TravelNodePath::getMinCost) so the bound never exceeds the real cost.
+void TravelNodeMap::calculateLandmarks()
+{
+    clearLandmarks();
+
+    uint32 nodeCount = m_nodes.size();
+    if (nodeCount < ROUTE_LANDMARKS)
+        return;
+
+    // Forward and reverse adjacency in compressed (CSR) form.
+    std::vector<uint32> outStart(nodeCount + 1, 0), inStart(nodeCount + 1, 0);
+    for (auto& node : m_nodes)
+        for (auto& link : *node->getLinks())
+        {
+            if (link.first->getRouteId() >= nodeCount)
+                continue;
+
+            outStart[node->getRouteId() + 1]++;
+            inStart[link.first->getRouteId() + 1]++;
+        }
+
+    for (uint32 i = 0; i < nodeCount; i++)
+    {
+        outStart[i + 1] += outStart[i];
+        inStart[i + 1] += inStart[i];
+    }
+
+    std::vector<std::pair<uint32, float>> outLinks(outStart.back()), inLinks(inStart.back());
+    std::vector<uint32> outPos(outStart.begin(), outStart.end() - 1), inPos(inStart.begin(), inStart.end() - 1);
+    for (auto& node : m_nodes)
+        for (auto& link : *node->getLinks())
+        {
+            uint32 from = node->getRouteId(), to = link.first->getRouteId();
+            if (to >= nodeCount)
+                continue;
+
+            float cost = link.second->getMinCost();
+            outLinks[outPos[from]++] = std::make_pair(to, cost);
+            inLinks[inPos[to]++] = std::make_pair(from, cost);
+        }
+
+    auto dijkstra = [nodeCount](uint32 source, std::vector<uint32> const& start,
+                                std::vector<std::pair<uint32, float>> const& links, std::vector<float>& dist)
+    {
+        typedef std::pair<float, uint32> QueueEntry;
+        std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<QueueEntry>> queue;
+
+        dist.assign(nodeCount, std::numeric_limits<float>::infinity());
+        dist[source] = 0.0f;
+        queue.push(std::make_pair(0.0f, source));
+
+        while (!queue.empty())
+        {
+            QueueEntry entry = queue.top();
+            queue.pop();
+
+            if (entry.first > dist[entry.second])
+                continue;
+
+            for (uint32 i = start[entry.second]; i < start[entry.second + 1]; i++)
+            {
+                float d = entry.first + links[i].second;
+                if (d < dist[links[i].first])
+                {
+                    dist[links[i].first] = d;
+                    queue.push(std::make_pair(d, links[i].first));
+                }
+            }
+        }
+    };
+
+    std::vector<float> distFrom, distTo;
+    std::vector<float> landmarkFrom(nodeCount * ROUTE_LANDMARKS, -1.0f), landmarkTo(nodeCount * ROUTE_LANDMARKS, -1.0f);
+    std::vector<float> nearest(nodeCount, std::numeric_limits<float>::infinity());
+    std::vector<uint32> landmarks;
+
+    // Farthest point selection: each landmark is the reachable node furthest from all previous ones.
+    dijkstra(0, outStart, outLinks, distFrom);
+    uint32 next = 0;
+    for (uint32 i = 0; i < nodeCount; i++)
+        if (distFrom[i] != std::numeric_limits<float>::infinity() && distFrom[i] > distFrom[next])
+            next = i;
+
+    while (landmarks.size() < ROUTE_LANDMARKS)
+    {
+        uint32 l = landmarks.size();
+        landmarks.push_back(next);
+
+        dijkstra(next, outStart, outLinks, distFrom);
+        dijkstra(next, inStart, inLinks, distTo);
+
+        for (uint32 i = 0; i < nodeCount; i++)
+        {
+            if (distFrom[i] != std::numeric_limits<float>::infinity())
+                landmarkFrom[i * ROUTE_LANDMARKS + l] = distFrom[i];
+            if (distTo[i] != std::numeric_limits<float>::infinity())
+                landmarkTo[i * ROUTE_LANDMARKS + l] = distTo[i];
+
+            nearest[i] = std::min(nearest[i], std::min(distFrom[i], distTo[i]));
+        }
+
+        // Unreachable nodes (other continents) are preferred so every part of the graph gets a landmark.
+        next = 0;
+        for (uint32 i = 0; i < nodeCount; i++)
+            if (nearest[i] > nearest[next])
+                next = i;
+
+        if (nearest[next] == 0.0f)
+            break;
+    }
+
+    m_landmarks = landmarks;
+    m_landmarkFrom = landmarkFrom;
+    m_landmarkTo = landmarkTo;
+
+    clearRouteCache();
+
+    LOG_INFO("playerbots", ">> Calculated {} route landmarks for {} nodes.", m_landmarks.size(), nodeCount);
+}
+
+float TravelNodeMap::getLandmarkDistance(uint32 nodeId, uint32 goalId)
+{
+    float const* nodeFrom = &m_landmarkFrom[nodeId * ROUTE_LANDMARKS];
+    float const* nodeTo = &m_landmarkTo[nodeId * ROUTE_LANDMARKS];
+    float const* goalFrom = &m_landmarkFrom[goalId * ROUTE_LANDMARKS];
+    float const* goalTo = &m_landmarkTo[goalId * ROUTE_LANDMARKS];
+
+    // Triangle inequality: d(n, goal) >= d(L, goal) - d(L, n) and d(n, goal) >= d(n, L) - d(goal, L).
+    float bound = 0.0f;
+    for (uint32 l = 0; l < m_landmarks.size(); l++)
+    {
+        if (goalFrom[l] >= 0.0f && nodeFrom[l] >= 0.0f)
+            bound = std::max(bound, goalFrom[l] - nodeFrom[l]);
+        if (nodeTo[l] >= 0.0f && goalTo[l] >= 0.0f)
+            bound = std::max(bound, nodeTo[l] - goalTo[l]);
+    }
+
+    return bound;
+}
+
+void TravelNodeMap::clearLandmarks()
+{
+    m_landmarks.clear();
+    m_landmarkFrom.clear();
+    m_landmarkTo.clear();
+}
+
 void TravelNodeMap::generatePaths()
 {
     LOG_INFO("playerbots", "-Calculating walkable paths");
@@ -2039,6 +2850,8 @@ void TravelNodeMap::generatePaths()
     calculatePathCosts();
     LOG_INFO("playerbots", "-Generating taxi paths");
     generateTaxiPaths();
+    LOG_INFO("playerbots", "-Calculating route landmarks");
+    calculateLandmarks();
 }
 
 void TravelNodeMap::generateAll()
@@ -2059,6 +2872,14 @@ void TravelNodeMap::generateAll()
         hasToFullGen = false;
         hasToSave = true;
     }
+    else if (!hasLandmarks() && !m_nodes.empty())
+    {
+        LOG_INFO("playerbots", "-Calculating route landmarks");
+        calculateLandmarks();
+        hasToSave = true;
+    }
+
+    clearRouteCache();
 }
 
 void TravelNodeMap::printMap()
@@ -2260,11 +3081,47 @@ void TravelNodeMap::saveNodeStore()
         LOG_INFO("playerbots", ">> Saved {} travelNode Paths, {} points.", paths, points);
     }
 
-    PlayerbotsDatabase.CommitTransaction(trans);
+    trans->Append("DELETE FROM playerbots_travelnode_landmark");
+
+    if (hasLandmarks())
+    {
+        // Multi-row inserts, one statement per 1000 rows.
+        std::ostringstream out;
+        uint32 rows = 0;
+        for (uint32 l = 0; l < m_landmarks.size(); l++)
+        {
+            for (uint32 i = 0; i < anodes.size(); i++)
+            {
+                out << (rows % 1000 ? "," : "INSERT INTO playerbots_travelnode_landmark (landmark, node_id, "
+                                            "distance_from, distance_to) VALUES ");
+                out << "(" << l << "," << i << "," << m_landmarkFrom[i * ROUTE_LANDMARKS + l] << ","
+                    << m_landmarkTo[i * ROUTE_LANDMARKS + l] << ")";
+
+                if (++rows % 1000 == 0)
+                {
+                    trans->Append(out.str().c_str());
+                    out.str("");
+                }
+            }
+        }
+
+        if (rows % 1000)
+            trans->Append(out.str().c_str());
+
+        LOG_INFO("playerbots", ">> Saved {} travelNode landmarks.", m_landmarks.size());
+    }
+
+    // Committed before the snapshot is written, its header records the row counts of the saved tables.
+    PlayerbotsDatabase.DirectCommitTransaction(trans);
+
+    saveNodeStoreFile();
 }
 
 void TravelNodeMap::loadNodeStore()
 {
+    if (loadNodeStoreFile())
+        return;
+
     std::string const query = "SELECT id, name, map_id, x, y, z, linked FROM playerbots_travelnode";
 
     std::unordered_map<uint32, TravelNode*> saveNodes;
@@ -2368,6 +3225,453 @@ void TravelNodeMap::loadNodeStore()
             LOG_ERROR("playerbots", ">> Error loading travelNode paths.");
         }
     }
+
+    {
+        if (QueryResult result = PlayerbotsDatabase.Query(
+                "SELECT landmark, node_id, distance_from, distance_to FROM playerbots_travelnode_landmark"))
+        {
+            std::vector<float> landmarkFrom(m_nodes.size() * ROUTE_LANDMARKS, -1.0f);
+            std::vector<float> landmarkTo(m_nodes.size() * ROUTE_LANDMARKS, -1.0f);
+            std::vector<uint32> landmarks;
+
+            do
+            {
+                Field* fields = result->Fetch();
+
+                uint32 l = fields[0].Get<uint8>();
+                auto nodeItr = saveNodes.find(fields[1].Get<uint32>());
+
+                if (l >= ROUTE_LANDMARKS || nodeItr == saveNodes.end())
+                    continue;
+
+                uint32 id = nodeItr->second->getRouteId();
+                landmarkFrom[id * ROUTE_LANDMARKS + l] = fields[2].Get<float>();
+                landmarkTo[id * ROUTE_LANDMARKS + l] = fields[3].Get<float>();
+
+                if (landmarks.size() <= l)
+                    landmarks.resize(l + 1, 0);
+
+                if (fields[2].Get<float>() == 0.0f && fields[3].Get<float>() == 0.0f)
+                    landmarks[l] = id;
+
+            } while (result->NextRow());
+
+            m_landmarks = landmarks;
+            m_landmarkFrom = landmarkFrom;
+            m_landmarkTo = landmarkTo;
+
+            LOG_INFO("playerbots", ">> Loaded {} travelNode landmarks.", m_landmarks.size());
+        }
+    }
+
+    if (!m_nodes.empty())
+        saveNodeStoreFile();
+}
+
+namespace
+{
+    // Binary node store. All sections are 4 byte aligned and follow the header in this order: nodes, link offsets
+    // (nodeCount + 1, links of node i are [offset[i], offset[i + 1])), links, path points, landmark route ids,
+    // landmark distances from and to (nodeCount * ROUTE_LANDMARKS each, only with landmarks) and the node names.
+    constexpr uint32 NODE_STORE_MAGIC = 0x4E544250;  // "PBTN"
+    constexpr uint32 NODE_STORE_VERSION = 2;
+
+    // Shape of the travel node tables the store was written from. A store whose tables changed since (an SQL
+    // update imported into the database) is not loaded, the database stays authoritative.
+    struct NodeStoreFingerprint
+    {
+        uint64 nodeRows;
+        uint64 maxNodeId;
+        uint64 linkRows;
+        uint64 pointRows;
+        uint64 landmarkRows;
+
+        bool operator==(NodeStoreFingerprint const&) const = default;
+    };
+
+    struct NodeStoreHeader
+    {
+        uint32 magic;
+        uint32 version;
+        uint32 nodeCount;
+        uint32 linkCount;
+        uint32 pointCount;
+        uint32 landmarkCount;
+        uint32 nameBytes;
+        uint32 checksum;  // crc32 of everything after the header
+        NodeStoreFingerprint database;
+    };
+
+    struct NodeStoreNode
+    {
+        uint32 mapId;
+        float x, y, z;
+        uint32 nameOffset;
+        uint32 nameLength;
+        uint8 linked;
+        uint8 padding[3];
+    };
+
+    struct NodeStoreLink
+    {
+        uint32 toNode;
+        uint32 pathObject;
+        float distance;
+        float swimDistance;
+        float extraCost;
+        uint32 firstPoint;
+        uint32 pointCount;
+        uint8 pathType;
+        uint8 calculated;
+        uint8 maxLevelCreature[3];
+        uint8 padding[3];
+    };
+
+    struct NodeStorePoint
+    {
+        uint32 mapId;
+        float x, y, z;
+    };
+
+    static_assert(sizeof(NodeStoreHeader) == 72 && sizeof(NodeStoreNode) == 28 && sizeof(NodeStoreLink) == 36 &&
+                      sizeof(NodeStorePoint) == 16,
+                  "Node store records are written as is and must not change size");
+
+    std::string getNodeStorePath()
+    {
+        std::string const& fileName = sPlayerbotAIConfig.travelNodeStoreFile;
+        if (fileName.empty() || std::filesystem::path(fileName).is_absolute())
+            return fileName;
+
+        return sWorld->GetDataPath() + fileName;
+    }
+
+    NodeStoreFingerprint getNodeStoreFingerprint()
+    {
+        NodeStoreFingerprint fingerprint = {};
+
+        if (QueryResult result = PlayerbotsDatabase.Query(
+                "SELECT CAST((SELECT COUNT(*) FROM playerbots_travelnode) AS UNSIGNED), "
+                "CAST((SELECT IFNULL(MAX(id), 0) FROM playerbots_travelnode) AS UNSIGNED), "
+                "CAST((SELECT COUNT(*) FROM playerbots_travelnode_link) AS UNSIGNED), "
+                "CAST((SELECT COUNT(*) FROM playerbots_travelnode_path) AS UNSIGNED), "
+                "CAST((SELECT COUNT(*) FROM playerbots_travelnode_landmark) AS UNSIGNED)"))
+        {
+            Field* fields = result->Fetch();
+            fingerprint.nodeRows = fields[0].Get<uint64>();
+            fingerprint.maxNodeId = fields[1].Get<uint64>();
+            fingerprint.linkRows = fields[2].Get<uint64>();
+            fingerprint.pointRows = fields[3].Get<uint64>();
+            fingerprint.landmarkRows = fields[4].Get<uint64>();
+        }
+
+        return fingerprint;
+    }
+}
+
+bool TravelNodeMap::saveNodeStoreFile()
+{
+    std::string const fileName = getNodeStorePath();
+    if (fileName.empty())
+        return false;
+
+    std::vector<NodeStoreNode> nodes(m_nodes.size());
+    std::vector<uint32> linkOffsets;
+    std::vector<NodeStoreLink> links;
+    std::vector<NodeStorePoint> points;
+    std::string names;
+
+    linkOffsets.reserve(m_nodes.size() + 1);
+    linkOffsets.push_back(0);
+
+    for (uint32 i = 0; i < m_nodes.size(); i++)
+    {
+        TravelNode* node = m_nodes[i];
+        std::string const name = node->getName();
+
+        NodeStoreNode& nodeRecord = nodes[i];
+        nodeRecord.mapId = node->getMapId();
+        nodeRecord.x = node->getX();
+        nodeRecord.y = node->getY();
+        nodeRecord.z = node->getZ();
+        nodeRecord.nameOffset = names.size();
+        nodeRecord.nameLength = name.size();
+        nodeRecord.linked = node->isLinked();
+        names += name;
+
+        // Links in target order so the same graph always gives the same file.
+        std::vector<std::pair<uint32, TravelNodePath*>> nodeLinks;
+        for (auto& link : *node->getLinks())
+        {
+            uint32 toNode = link.first->getRouteId();
+            if (toNode < m_nodes.size() && m_nodes[toNode] == link.first)
+                nodeLinks.push_back(std::make_pair(toNode, link.second));
+        }
+
+        std::sort(nodeLinks.begin(), nodeLinks.end(),
+                  [](auto const& i, auto const& j) { return i.first < j.first; });
+
+        for (auto& [toNode, path] : nodeLinks)
+        {
+            std::vector<uint8> maxLevelCreature = path->getMaxLevelCreature();
+            std::vector<WorldPosition> ppath = path->getPath();
+
+            NodeStoreLink linkRecord = {};
+            linkRecord.toNode = toNode;
+            linkRecord.pathObject = path->getPathObject();
+            linkRecord.distance = path->getDistance();
+            linkRecord.swimDistance = path->getSwimDistance();
+            linkRecord.extraCost = path->getExtraCost();
+            linkRecord.firstPoint = points.size();
+            linkRecord.pointCount = ppath.size();
+            linkRecord.pathType = static_cast<uint8>(path->getPathType());
+            linkRecord.calculated = path->getCalculated();
+            for (uint32 l = 0; l < 3 && l < maxLevelCreature.size(); l++)
+                linkRecord.maxLevelCreature[l] = maxLevelCreature[l];
+
+            for (auto& point : ppath)
+                points.push_back(
+                    {point.GetMapId(), point.GetPositionX(), point.GetPositionY(), point.GetPositionZ()});
+
+            links.push_back(linkRecord);
+        }
+
+        linkOffsets.push_back(links.size());
+    }
+
+    bool landmarks = hasLandmarks();
+
+    NodeStoreHeader header = {};
+    header.magic = NODE_STORE_MAGIC;
+    header.version = NODE_STORE_VERSION;
+    header.nodeCount = nodes.size();
+    header.linkCount = links.size();
+    header.pointCount = points.size();
+    header.landmarkCount = landmarks ? m_landmarks.size() : 0;
+    header.nameBytes = names.size();
+    header.database = getNodeStoreFingerprint();
+
+    std::vector<std::pair<void const*, size_t>> sections = {
+        {nodes.data(), nodes.size() * sizeof(NodeStoreNode)},
+        {linkOffsets.data(), linkOffsets.size() * sizeof(uint32)},
+        {links.data(), links.size() * sizeof(NodeStoreLink)},
+        {points.data(), points.size() * sizeof(NodeStorePoint)}};
+
+    if (landmarks)
+    {
+        sections.push_back({m_landmarks.data(), m_landmarks.size() * sizeof(uint32)});
+        sections.push_back({m_landmarkFrom.data(), m_landmarkFrom.size() * sizeof(float)});
+        sections.push_back({m_landmarkTo.data(), m_landmarkTo.size() * sizeof(float)});
+    }
+
+    sections.push_back({names.data(), names.size()});
+
+    boost::crc_32_type crc;
+    for (auto& section : sections)
+        crc.process_bytes(section.first, section.second);
+
+    header.checksum = crc.checksum();
+
+    // Write next to the old file and swap, a crash never leaves a half written store behind.
+    std::string const tmpName = fileName + ".tmp";
+    {
+        std::ofstream out(tmpName, std::ios::binary | std::ios::trunc);
+
+        out.write(reinterpret_cast<char const*>(&header), sizeof(header));
+        for (auto& section : sections)
+            out.write(static_cast<char const*>(section.first), section.second);
+
+        if (!out)
+        {
+            LOG_ERROR("playerbots", ">> Could not write travelNode store file {}.", tmpName);
+            return false;
+        }
+    }
+
+    std::remove(fileName.c_str());
+    if (std::rename(tmpName.c_str(), fileName.c_str()))
+    {
+        LOG_ERROR("playerbots", ">> Could not replace travelNode store file {}.", fileName);
+        return false;
+    }
+
+    LOG_INFO("playerbots", ">> Saved {} travelNodes, {} paths, {} points to {}.", nodes.size(), links.size(),
+             points.size(), fileName);
+
+    return true;
+}
+
+// Reads the store straight from the mapped file. Everything is validated before the first node is created, a bad
+// or outdated file is ignored and the nodes are loaded from the database instead.
+bool TravelNodeMap::loadNodeStoreFile()
+{
+    std::string const fileName = getNodeStorePath();
+    std::error_code error;
+    if (fileName.empty() || !m_nodes.empty() || !std::filesystem::exists(fileName, error))
+        return false;
+
+    uint32 loadTime = getMSTime();
+
+    boost::interprocess::file_mapping file;
+    boost::interprocess::mapped_region region;
+    try
+    {
+        file = boost::interprocess::file_mapping(fileName.c_str(), boost::interprocess::read_only);
+        region = boost::interprocess::mapped_region(file, boost::interprocess::read_only);
+    }
+    catch (boost::interprocess::interprocess_exception const& e)
+    {
+        LOG_ERROR("playerbots", ">> Could not map travelNode store file {}: {}", fileName, e.what());
+        return false;
+    }
+
+    char const* data = static_cast<char const*>(region.get_address());
+    uint64 size = region.get_size();
+
+    if (size < sizeof(NodeStoreHeader))
+    {
+        LOG_ERROR("playerbots", ">> TravelNode store file {} is truncated.", fileName);
+        return false;
+    }
+
+    NodeStoreHeader const* header = reinterpret_cast<NodeStoreHeader const*>(data);
+    if (header->magic != NODE_STORE_MAGIC || header->version != NODE_STORE_VERSION)
+    {
+        LOG_ERROR("playerbots", ">> TravelNode store file {} has an unknown format or version.", fileName);
+        return false;
+    }
+
+    uint64 nodeCount = header->nodeCount;
+    uint64 linkCount = header->linkCount;
+    uint64 pointCount = header->pointCount;
+    uint64 landmarkCount = header->landmarkCount;
+    uint64 landmarkValues = landmarkCount ? nodeCount * ROUTE_LANDMARKS : 0;
+
+    uint64 expectedSize = sizeof(NodeStoreHeader) + nodeCount * sizeof(NodeStoreNode) +
+                          (nodeCount + 1) * sizeof(uint32) + linkCount * sizeof(NodeStoreLink) +
+                          pointCount * sizeof(NodeStorePoint) + landmarkCount * sizeof(uint32) +
+                          2 * landmarkValues * sizeof(float) + header->nameBytes;
+
+    if (size != expectedSize || landmarkCount > ROUTE_LANDMARKS)
+    {
+        LOG_ERROR("playerbots", ">> TravelNode store file {} has a bad size.", fileName);
+        return false;
+    }
+
+    boost::crc_32_type crc;
+    crc.process_bytes(data + sizeof(NodeStoreHeader), size - sizeof(NodeStoreHeader));
+    if (crc.checksum() != header->checksum)
+    {
+        LOG_ERROR("playerbots", ">> TravelNode store file {} has a bad checksum.", fileName);
+        return false;
+    }
+
+    if (header->database != getNodeStoreFingerprint())
+    {
+        LOG_INFO("playerbots", ">> TravelNode tables changed since {} was written, loading them from the database.",
+                 fileName);
+        return false;
+    }
+
+    char const* section = data + sizeof(NodeStoreHeader);
+    NodeStoreNode const* nodes = reinterpret_cast<NodeStoreNode const*>(section);
+    section += nodeCount * sizeof(NodeStoreNode);
+    uint32 const* linkOffsets = reinterpret_cast<uint32 const*>(section);
+    section += (nodeCount + 1) * sizeof(uint32);
+    NodeStoreLink const* links = reinterpret_cast<NodeStoreLink const*>(section);
+    section += linkCount * sizeof(NodeStoreLink);
+    NodeStorePoint const* points = reinterpret_cast<NodeStorePoint const*>(section);
+    section += pointCount * sizeof(NodeStorePoint);
+    uint32 const* landmarks = reinterpret_cast<uint32 const*>(section);
+    section += landmarkCount * sizeof(uint32);
+    float const* landmarkFrom = reinterpret_cast<float const*>(section);
+    section += landmarkValues * sizeof(float);
+    float const* landmarkTo = reinterpret_cast<float const*>(section);
+    section += landmarkValues * sizeof(float);
+    char const* names = section;
+
+    bool valid = linkOffsets[0] == 0 && linkOffsets[nodeCount] == linkCount;
+    for (uint64 i = 0; valid && i < nodeCount; i++)
+        valid = linkOffsets[i] <= linkOffsets[i + 1] &&
+                uint64(nodes[i].nameOffset) + nodes[i].nameLength <= header->nameBytes;
+    for (uint64 i = 0; valid && i < linkCount; i++)
+        valid = links[i].toNode < nodeCount && uint64(links[i].firstPoint) + links[i].pointCount <= pointCount;
+    for (uint64 i = 0; valid && i < landmarkCount; i++)
+        valid = landmarks[i] < nodeCount;
+
+    if (!valid)
+    {
+        LOG_ERROR("playerbots", ">> TravelNode store file {} has bad node references.", fileName);
+        return false;
+    }
+
+    m_nodes.reserve(nodeCount);
+    for (uint32 i = 0; i < nodeCount; i++)
+    {
+        NodeStoreNode const& nodeRecord = nodes[i];
+
+        TravelNode* node = new TravelNode(WorldPosition(nodeRecord.mapId, nodeRecord.x, nodeRecord.y, nodeRecord.z),
+                                          std::string(names + nodeRecord.nameOffset, nodeRecord.nameLength), true);
+        node->setRouteId(i);
+
+        if (nodeRecord.linked)
+            node->setLinked(true);
+        else
+            hasToGen = true;
+
+        m_nodes.push_back(node);
+    }
+
+    for (uint32 i = 0; i < nodeCount; i++)
+    {
+        TravelNode* node = m_nodes[i];
+        node->getPaths()->reserve(linkOffsets[i + 1] - linkOffsets[i]);
+        node->getLinks()->reserve(linkOffsets[i + 1] - linkOffsets[i]);
+
+        for (uint32 l = linkOffsets[i]; l < linkOffsets[i + 1]; l++)
+        {
+            NodeStoreLink const& linkRecord = links[l];
+
+            TravelNodePath* path = node->setPathTo(
+                m_nodes[linkRecord.toNode],
+                TravelNodePath(linkRecord.distance, linkRecord.extraCost, linkRecord.pathType, linkRecord.pathObject,
+                               linkRecord.calculated,
+                               {linkRecord.maxLevelCreature[0], linkRecord.maxLevelCreature[1],
+                                linkRecord.maxLevelCreature[2]},
+                               linkRecord.swimDistance),
+                true);
+
+            if (!linkRecord.calculated)
+                hasToGen = true;
+
+            if (!path || !linkRecord.pointCount)
+                continue;
+
+            std::vector<WorldPosition> ppath;
+            ppath.reserve(linkRecord.pointCount);
+            for (uint32 p = linkRecord.firstPoint; p < linkRecord.firstPoint + linkRecord.pointCount; p++)
+                ppath.push_back(WorldPosition(points[p].mapId, points[p].x, points[p].y, points[p].z));
+
+            path->setPath(ppath);
+
+            if (path->getCalculated())
+                path->setComplete(true);
+        }
+    }
+
+    if (landmarkCount)
+    {
+        m_landmarks.assign(landmarks, landmarks + landmarkCount);
+        m_landmarkFrom.assign(landmarkFrom, landmarkFrom + landmarkValues);
+        m_landmarkTo.assign(landmarkTo, landmarkTo + landmarkValues);
+    }
+
+    clearRouteCache();
+
+    LOG_INFO("playerbots", ">> Loaded {} travelNodes, {} paths, {} points from {} in {} ms.", nodeCount, linkCount,
+             pointCount, fileName, GetMSTimeDiffToNow(loadTime));
+
+    return true;
 }
 
 void TravelNodeMap::calcMapOffset()
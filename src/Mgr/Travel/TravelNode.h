@@ -7,10 +7,17 @@
 #ifndef PLAYERBOTS_TRAVELNODE_H
 #define PLAYERBOTS_TRAVELNODE_H
 
+#include <atomic>
+#include <limits>
+#include <list>
+#include <mutex>
 #include <shared_mutex>
 
+#include "PerfMonitor.h"
 #include "TravelMgr.h"
 
+class ChatHandler;
+
 // THEORY
 //
 //  Pathfinding in (c)mangos is based on detour recast an opensource nashmesh creation and pathfinding codebase.
@@ -63,6 +70,30 @@ enum class TravelNodePathType : uint8
     teleportSpell = 5
 };
 
+// The bot properties route planning depends on. Taken on the map thread so the search itself can run on any thread.
+struct TravelNodeBotState
+{
+    TravelNodeBotState() = default;
+    explicit TravelNodeBotState(Player* bot);
+
+    bool knowsTaxiNode(uint32 taxiNode) const { return taxiNode < taxiNodes.size() && taxiNodes[taxiNode]; }
+
+    bool hasBot = false;
+    ObjectGuid guid;
+    bool alive = false;
+    bool teamAlliance = false;    // Team, picks the flight master mount.
+    bool allianceFriend = false;  // Faction reaction, picks the hostile creature levels.
+    bool taxiCheater = false;
+    bool hearthReady = false;
+    bool debugMove = false;
+    uint32 level = 0;
+    uint32 gold = 0;
+    float runSpeed = 7.0f;
+    float swimSpeed = 4.0f;
+    WorldPosition homeBind;
+    std::vector<bool> taxiNodes;
+};
+
 // A connection between two nodes.
 class TravelNodePath
 {
@@ -140,9 +171,12 @@ public:
 
     void calculateCost(bool distanceOnly = false);
 
-    float getCost(Player* bot = nullptr, uint32 cGold = 0);
+    float getCost(TravelNodeBotState const* bot = nullptr, uint32 cGold = 0);
     uint32 getPrice();
 
+    // Lowest cost any bot can get for this path, in yards at base run speed. Used for the landmark heuristic.
+    float getMinCost() { return pathType == TravelNodePathType::walk ? distance : extraCost * 7.0f; }
+
 private:
     // Does the path have all the points to get to the destination?
     bool complete = false;
@@ -203,9 +237,13 @@ public:
         important = baseNode->important;
     }
 
+    // Dense index of this node in TravelNodeMap::getNodes(), used by the route search.
+    static constexpr uint32 NO_ROUTE_ID = std::numeric_limits<uint32>::max();
+
     // Setters
     void setLinked(bool linked1) { linked = linked1; }
     void setPoint(WorldPosition point1) { point = point1; }
+    void setRouteId(uint32 routeId1) { routeId = routeId1; }
 
     // Getters
     std::string const getName() { return nodeName; };
@@ -214,6 +252,7 @@ public:
     std::unordered_map<TravelNode*, TravelNodePath*>* getLinks() { return &links; }
     bool isImportant() { return important; };
     bool isLinked() { return linked; }
+    uint32 getRouteId() { return routeId; }
 
     bool isTransport()
     {
@@ -339,6 +378,9 @@ protected:
     // This node has been checked for nearby links
     bool linked = false;
 
+    // Index in the node map or NO_ROUTE_ID for nodes that live outside of it (portal and bot nodes).
+    uint32 routeId = NO_ROUTE_ID;
+
     // This node is a (moving) transport.
     // bool transport = false;
     // Entry of transport.
@@ -474,6 +516,90 @@ public:
     uint32 currentGold = 0;
 };
 
+// Per node A* state of a route search, indexed by route id.
+struct TravelNodeRouteState
+{
+    float m_f = 0.0f, m_g = 0.0f;
+    uint32 parent = TravelNode::NO_ROUTE_ID;
+    uint32 currentGold = 0;
+    uint32 heapIndex = TravelNode::NO_ROUTE_ID;  // Position in the open heap or NO_ROUTE_ID when not open.
+    uint32 order = 0;                            // Insertion order, breaks ties between equal f.
+    uint32 search = 0;                           // Search generation that last touched this state.
+    bool close = false;
+};
+
+// Reusable A* buffers with an indexed binary min-heap (decrease-key) over route ids.
+// One instance lives per thread so route queries do not allocate once the buffers are warm.
+class TravelNodeRouteSearch
+{
+public:
+    void begin(std::vector<TravelNode*> const& mapNodes);
+
+    uint32 getId(TravelNode* node);
+    TravelNode* getNode(uint32 id) { return id < nodes->size() ? (*nodes)[id] : extraNodes[id - nodes->size()]; }
+    TravelNodeRouteState& getState(uint32 id);
+
+    bool empty() { return heap.empty(); }
+    bool isOpen(uint32 id) { return states[id].heapIndex != TravelNode::NO_ROUTE_ID; }
+    void push(uint32 id);
+    void update(uint32 id);
+    uint32 pop();
+
+    uint32 getExpanded() { return expanded; }
+    void addExpanded() { ++expanded; }
+
+private:
+    bool less(uint32 i, uint32 j)
+    {
+        TravelNodeRouteState const& a = states[i];
+        TravelNodeRouteState const& b = states[j];
+        return a.m_f < b.m_f || (a.m_f == b.m_f && a.order < b.order);
+    }
+
+    void place(uint32 pos, uint32 id)
+    {
+        heap[pos] = id;
+        states[id].heapIndex = pos;
+    }
+
+    void siftUp(uint32 pos);
+    void siftDown(uint32 pos);
+
+    std::vector<TravelNode*> const* nodes = nullptr;
+    std::vector<TravelNode*> extraNodes;
+    std::vector<TravelNodeRouteState> states;
+    std::vector<uint32> heap;
+    uint32 search = 0;
+    uint32 order = 0;
+    uint32 expanded = 0;
+};
+
+// Bounded LRU of finished routes shared by all bots, sharded to keep lock contention low.
+class TravelNodeRouteCache
+{
+public:
+    bool get(uint64 key, std::vector<TravelNode*>& nodes);
+    void put(uint64 key, std::vector<TravelNode*> const& nodes, uint32 capacity);
+    void clear();
+
+private:
+    static constexpr uint32 SHARDS = 16;
+
+    typedef std::list<std::pair<uint64, std::vector<TravelNode*>>> EntryList;
+
+    struct Shard
+    {
+        std::mutex mtx;
+        EntryList entries;  // Most recently used first.
+        std::unordered_map<uint64, EntryList::iterator> index;
+    };
+
+    Shard shards[SHARDS];
+};
+
+// Number of landmark nodes used for the ALT route heuristic.
+static constexpr uint32 ROUTE_LANDMARKS = 8;
+
 // The container of all nodes.
 class TravelNodeMap
 {
@@ -506,6 +632,7 @@ public:
 
     // Get all nodes
     std::vector<TravelNode*> getNodes() { return m_nodes; }
+    bool hasNodes() { return !m_nodes.empty(); }
     std::vector<TravelNode*> getNodes(WorldPosition pos, float range = -1);
 
     // Find nearest node.
@@ -538,18 +665,39 @@ public:
     }
 
     // Finds the best nodePath between two nodes
-    TravelNodeRoute getRoute(TravelNode* start, TravelNode* goal, Player* bot = nullptr);
+    TravelNodeRoute getRoute(TravelNode* start, TravelNode* goal, Player* bot = nullptr)
+    {
+        return getRoute(start, goal, TravelNodeBotState(bot));
+    }
+    TravelNodeRoute getRoute(TravelNode* start, TravelNode* goal, TravelNodeBotState const& bot);
+
+    // Original sort based A*, kept as reference for the route benchmark.
+    TravelNodeRoute getRouteLegacy(TravelNode* start, TravelNode* goal, TravelNodeBotState const* bot = nullptr);
 
     // Find the best node between two positions
     TravelNodeRoute getRoute(WorldPosition startPos, WorldPosition endPos, std::vector<WorldPosition>& startPath,
-                             Player* bot = nullptr);
+                             Player* bot = nullptr)
+    {
+        return getRoute(startPos, endPos, startPath, TravelNodeBotState(bot));
+    }
+    TravelNodeRoute getRoute(WorldPosition startPos, WorldPosition endPos, std::vector<WorldPosition>& startPath,
+                             TravelNodeBotState const& bot);
 
     // Find the full path between those locations
-    static TravelPath getFullPath(WorldPosition startPos, WorldPosition endPos, Player* bot = nullptr);
+    static TravelPath getFullPath(WorldPosition startPos, WorldPosition endPos, Player* bot = nullptr)
+    {
+        return getFullPath(startPos, endPos, TravelNodeBotState(bot));
+    }
+    // Only reads the bot state, so it is safe to call off the map thread (see TravelRoutePlanner).
+    // A bot should not have more than one search running at a time since it reuses its own portal nodes.
+    static TravelPath getFullPath(WorldPosition startPos, WorldPosition endPos, TravelNodeBotState const& bot);
 
     // Manage/update nodes
     void manageNodes(Unit* bot, bool mapFull = false);
 
+    // Drops all cached routes, needed whenever nodes or links change.
+    void clearRouteCache() { m_routeCache.clear(); }
+
     void setHasToGen() { hasToGen = true; }
 
     void generateNpcNodes();
@@ -563,6 +711,7 @@ public:
     void removeLowNodes();
     void removeUselessPaths();
     void calculatePathCosts();
+    void calculateLandmarks();
     void generateTaxiPaths();
     void generatePaths();
 
@@ -574,6 +723,10 @@ public:
     void saveNodeStore();
     void loadNodeStore();
 
+    // Binary snapshot of the node store (see AiPlayerbot.TravelNodeStoreFile). The database stays authoritative.
+    bool saveNodeStoreFile();
+    bool loadNodeStoreFile();
+
     bool cropUselessNode(TravelNode* startNode);
     TravelNode* addZoneLinkNode(TravelNode* startNode);
     TravelNode* addRandomExtNode(TravelNode* startNode);
@@ -585,8 +738,10 @@ public:
     void InitTaxiGraph();
     std::vector<uint32> FindTaxiPath(uint32 fromNode, uint32 toNode);
 
+    // .playerbots debug route record/bench/clear
+    static bool HandleConsoleCommand(ChatHandler* handler, char const* args);
+
     std::shared_timed_mutex m_nMapMtx;
-    std::unordered_map<ObjectGuid, std::unordered_map<uint32, TravelNode*>> teleportNodes;
 
 private:
     TravelNodeMap() = default;
@@ -608,10 +763,43 @@ private:
     std::unordered_map<uint32, std::vector<uint32>> taxiGraph;
     std::map<uint32, std::map<uint32, std::vector<uint32>>> taxiPathCache;
 
+    TravelNodeRoute searchRoute(TravelNode* start, TravelNode* goal, TravelNodeBotState const* bot, bool useLandmarks);
+    bool getRouteCacheKey(TravelNode* start, TravelNode* goal, TravelNodeBotState const* bot, uint64& key);
+    bool isRouteUsable(std::vector<TravelNode*> const& nodes, TravelNodeBotState const* bot);
+
+    // Per bot nodes (hearthstone portal, bot position) kept between searches. Searches run on several threads.
+    TravelNode* getTeleportNode(ObjectGuid guid, uint32 id);
+    void setTeleportNode(ObjectGuid guid, uint32 id, TravelNode* node);
+
+    bool hasLandmarks() { return !m_landmarks.empty() && m_landmarkFrom.size() == m_nodes.size() * ROUTE_LANDMARKS; }
+    float getLandmarkDistance(uint32 nodeId, uint32 goalId);
+    void clearLandmarks();
+
+    void recordRoute(TravelNode* start, TravelNode* goal);
+    void benchRoutes(ChatHandler* handler, uint32 iterations);
+
     std::vector<TravelNode*> m_nodes;
 
     std::vector<std::pair<uint32, WorldPosition>> mapOffsets;
 
+    std::mutex m_teleportMtx;
+    std::unordered_map<ObjectGuid, std::unordered_map<uint32, TravelNode*>> teleportNodes;
+
+    // Landmark route ids and per node lower bounds from/to each landmark (node * ROUTE_LANDMARKS + landmark).
+    // Negative values mark unreachable pairs.
+    std::vector<uint32> m_landmarks;
+    std::vector<float> m_landmarkFrom;
+    std::vector<float> m_landmarkTo;
+
+    TravelNodeRouteCache m_routeCache;
+    PerformanceCounter* m_routeCacheHits = sPerfMonitor.GetCounter("TravelNodeMap route cache hit");
+    PerformanceCounter* m_routeCacheMisses = sPerfMonitor.GetCounter("TravelNodeMap route cache miss");
+
+    // Recorded start/goal pairs (route id + node) for the route benchmark.
+    std::atomic<bool> m_recordRoutes{false};
+    std::mutex m_routeRecordMtx;
+    std::vector<std::pair<std::pair<uint32, TravelNode*>, std::pair<uint32, TravelNode*>>> m_routeRecord;
+
     bool hasToSave = false;
     bool hasToGen = false;
     bool hasToFullGen = false;
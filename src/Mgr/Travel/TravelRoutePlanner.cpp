@@ -0,0 +1,160 @@
+/*
+ * This file is part of the mod-playerbots module for AzerothCore. See AUTHORS file for Copyright
+ * information; released under GNU GPL v2 license, redistribute/modify under version 2 of the License,
+ * or (at your option) any later version.
+ */
+
+#include "TravelRoutePlanner.h"
+
+#include <chrono>
+
+#include "Log.h"
+#include "Playerbots.h"
+
+bool TravelRoutePlan::isReady()
+{
+    if (ready)
+        return true;
+
+    if (!future.valid() || future.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        return false;
+
+    path = future.get();
+    ready = true;
+
+    return true;
+}
+
+std::shared_ptr<TravelRoutePlan> TravelRoutePlanner::queuePlan(WorldPosition startPos, WorldPosition endPos,
+                                                               Player* bot)
+{
+    std::shared_ptr<TravelRoutePlan> plan = std::make_shared<TravelRoutePlan>(startPos, endPos);
+
+    // Everything the search needs from the bot is read here, on the bot's map thread.
+    TravelNodeBotState botState(bot);
+
+    m_queued->add();
+
+    if (!sPlayerbotAIConfig.travelRoutePlannerThreads)
+    {
+        plan->path = TravelNodeMap::getFullPath(startPos, endPos, botState);
+        plan->ready = true;
+        m_planned->add();
+        return plan;
+    }
+
+    ObjectGuid const guid = bot->GetGUID();
+    std::weak_ptr<TravelRoutePlan> weakPlan = plan;
+    std::packaged_task<TravelPath()> task(
+        [this, weakPlan, startPos, endPos, botState = std::move(botState)]()
+        {
+            // Dropped by its travel target (retargeted) while it waited, nobody reads the result.
+            if (weakPlan.expired())
+                return TravelPath();
+
+            TravelPath path = TravelNodeMap::getFullPath(startPos, endPos, botState);
+            m_planned->add();
+            return path;
+        });
+
+    plan->future = task.get_future();
+
+    {
+        std::lock_guard<std::mutex> guard(m_queueMtx);
+
+        // Shutting down: hand back an empty path, the bot falls back to normal movement.
+        if (m_stopping)
+        {
+            plan->future = std::future<TravelPath>();
+            plan->ready = true;
+            return plan;
+        }
+
+        if (m_workers.empty())
+            startWorkers(sPlayerbotAIConfig.travelRoutePlannerThreads);
+
+        // Another plan of this bot is queued or running, this one starts when it is done.
+        auto waiting = m_waiting.find(guid);
+        if (waiting != m_waiting.end())
+        {
+            waiting->second.push_back(QueuedPlan{guid, std::move(task)});
+            return plan;
+        }
+
+        m_waiting[guid];
+        m_queue.push_back(QueuedPlan{guid, std::move(task)});
+    }
+
+    m_queueCv.notify_one();
+
+    return plan;
+}
+
+uint32 TravelRoutePlanner::getQueueSize()
+{
+    std::lock_guard<std::mutex> guard(m_queueMtx);
+    return m_queue.size();
+}
+
+void TravelRoutePlanner::startWorkers(uint32 threads)
+{
+    LOG_INFO("playerbots", "Starting {} travel route planner threads", threads);
+
+    for (uint32 i = 0; i < threads; ++i)
+        m_workers.emplace_back(&TravelRoutePlanner::workerLoop, this);
+}
+
+// Workers finish the queue before exiting so no plan is left with a broken future.
+void TravelRoutePlanner::workerLoop()
+{
+    while (true)
+    {
+        QueuedPlan queued;
+
+        {
+            std::unique_lock<std::mutex> lock(m_queueMtx);
+            m_queueCv.wait(lock, [this] { return m_stopping || !m_queue.empty(); });
+
+            if (m_queue.empty())
+                return;
+
+            queued = std::move(m_queue.front());
+            m_queue.pop_front();
+        }
+
+        queued.task();
+
+        {
+            std::lock_guard<std::mutex> guard(m_queueMtx);
+
+            // Hand the bot over to its next waiting plan, if any.
+            auto waiting = m_waiting.find(queued.guid);
+            if (waiting->second.empty())
+            {
+                m_waiting.erase(waiting);
+                continue;
+            }
+
+            m_queue.push_back(std::move(waiting->second.front()));
+            waiting->second.pop_front();
+        }
+
+        m_queueCv.notify_one();
+    }
+}
+
+void TravelRoutePlanner::stop()
+{
+    {
+        std::lock_guard<std::mutex> guard(m_queueMtx);
+        m_stopping = true;
+    }
+
+    m_queueCv.notify_all();
+
+    for (auto& worker : m_workers)
+        if (worker.joinable())
+            worker.join();
+
+    m_workers.clear();
+}
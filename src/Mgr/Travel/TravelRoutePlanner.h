@@ -0,0 +1,95 @@
+/*
+ * This file is part of the mod-playerbots module for AzerothCore. See AUTHORS file for Copyright
+ * information; released under GNU GPL v2 license, redistribute/modify under version 2 of the License,
+ * or (at your option) any later version.
+ */
+
+#ifndef PLAYERBOTS_TRAVELROUTEPLANNER_H
+#define PLAYERBOTS_TRAVELROUTEPLANNER_H
+
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "TravelNode.h"
+
+class Player;
+
+// A full path requested from the route planner. Owned by the travel target that asked for it.
+class TravelRoutePlan
+{
+public:
+    TravelRoutePlan(WorldPosition startPos, WorldPosition endPos) : startPos(startPos), endPos(endPos) {}
+
+    // Picks up the finished path. Only called from the bot's own update.
+    bool isReady();
+
+    WorldPosition getStart() { return startPos; }
+    WorldPosition getEnd() { return endPos; }
+    TravelPath* getPath() { return isReady() ? &path : nullptr; }
+
+private:
+    friend class TravelRoutePlanner;
+
+    WorldPosition startPos;
+    WorldPosition endPos;
+    std::future<TravelPath> future;
+    TravelPath path;
+    bool ready = false;
+};
+
+// Runs TravelNodeMap::getFullPath on worker threads so long routes never stall a map update.
+// The bot state is copied on the calling thread; workers only read the node graph under its shared lock.
+// Plans of one bot run one after the other, since every search of a bot reuses that bot's portal and
+// position nodes (TravelNodeMap::getTeleportNode).
+class TravelRoutePlanner
+{
+public:
+    static TravelRoutePlanner& instance()
+    {
+        static TravelRoutePlanner instance;
+        return instance;
+    }
+
+    std::shared_ptr<TravelRoutePlan> queuePlan(WorldPosition startPos, WorldPosition endPos, Player* bot);
+
+    uint32 getQueueSize();
+
+    void stop();
+
+private:
+    TravelRoutePlanner() = default;
+    ~TravelRoutePlanner() { stop(); }
+
+    TravelRoutePlanner(const TravelRoutePlanner&) = delete;
+    TravelRoutePlanner& operator=(const TravelRoutePlanner&) = delete;
+
+    void startWorkers(uint32 threads);
+    void workerLoop();
+
+    std::mutex m_queueMtx;
+    std::condition_variable m_queueCv;
+    struct QueuedPlan
+    {
+        ObjectGuid guid;
+        std::packaged_task<TravelPath()> task;
+    };
+
+    std::deque<QueuedPlan> m_queue;
+    // Bots with a plan queued or running, with the plans waiting for it to finish.
+    std::unordered_map<ObjectGuid, std::deque<QueuedPlan>> m_waiting;
+    std::vector<std::thread> m_workers;
+    bool m_stopping = false;
+
+    PerformanceCounter* m_queued = sPerfMonitor.GetCounter("TravelRoutePlanner plans queued");
+    PerformanceCounter* m_planned = sPerfMonitor.GetCounter("TravelRoutePlanner plans finished");
+};
+
+#define sTravelRoutePlanner TravelRoutePlanner::instance()
+
+#endif
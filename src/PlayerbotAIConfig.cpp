@@ -161,6 +161,7 @@ bool PlayerbotAIConfig::Initialize()
     randomBotRpgChance = sConfigMgr->GetOption<float>("AiPlayerbot.RandomBotRpgChance", 0.20f);
 
     iterationsPerTick = sConfigMgr->GetOption<int32>("AiPlayerbot.IterationsPerTick", 10);
+    tickValueCache = sConfigMgr->GetOption<bool>("AiPlayerbot.TickValueCache", true);
 
     allowAccountBots = sConfigMgr->GetOption<bool>("AiPlayerbot.AllowAccountBots", true);
     allowGuildBots = sConfigMgr->GetOption<bool>("AiPlayerbot.AllowGuildBots", true);
@@ -220,6 +221,8 @@ bool PlayerbotAIConfig::Initialize()
     LoadSet<std::set<uint32>>(
         sConfigMgr->GetOption<std::string>("AiPlayerbot.UnobtainableItems", "12468,44869,44870,46978"),
         unobtainableItems);
+    itemCacheThreads = sConfigMgr->GetOption<uint32>("AiPlayerbot.ItemCacheThreads", 0);
+    itemCacheFile = sConfigMgr->GetOption<std::string>("AiPlayerbot.ItemCacheFile", "");
 
     botAutologin = sConfigMgr->GetOption<bool>("AiPlayerbot.BotAutologin", false);
     randomBotAutologin = sConfigMgr->GetOption<bool>("AiPlayerbot.RandomBotAutologin", true);
@@ -246,6 +249,8 @@ bool PlayerbotAIConfig::Initialize()
         sConfigMgr->GetOption<int32>("AiPlayerbot.PermanentlyInWorldTime", 1 * YEAR);
     randomBotTeleportDistance = sConfigMgr->GetOption<int32>("AiPlayerbot.RandomBotTeleportDistance", 100);
     randomBotsPerInterval = sConfigMgr->GetOption<int32>("AiPlayerbot.RandomBotsPerInterval", 60);
+    randomBotLoginPrefetch = sConfigMgr->GetOption<uint32>("AiPlayerbot.RandomBotLoginPrefetch", 200);
+    randomBotLoginMaxUpdateTime = sConfigMgr->GetOption<uint32>("AiPlayerbot.RandomBotLoginMaxUpdateTime", 100);
     minRandomBotsPriceChangeInterval =
         sConfigMgr->GetOption<int32>("AiPlayerbot.MinRandomBotsPriceChangeInterval", 2 * HOUR);
     maxRandomBotsPriceChangeInterval =
@@ -442,6 +447,9 @@ bool PlayerbotAIConfig::Initialize()
     commandSeparator = sConfigMgr->GetOption<std::string>("AiPlayerbot.CommandSeparator", "\\\\");
 
     commandServerPort = sConfigMgr->GetOption<int32>("AiPlayerbot.CommandServerPort", 8888);
+    eventJournalFlushInterval = sConfigMgr->GetOption<uint32>("AiPlayerbot.EventJournalFlushInterval", 5000);
+    eventJournalMaxSize = sConfigMgr->GetOption<uint32>("AiPlayerbot.EventJournalMaxSize", 1000);
+    botStateSavesPerTick = sConfigMgr->GetOption<uint32>("AiPlayerbot.BotStateSavesPerTick", 10);
     perfMonEnabled = sConfigMgr->GetOption<bool>("AiPlayerbot.PerfMonEnabled", false);
 
     useGroundMountAtMinLevel = sConfigMgr->GetOption<int32>("AiPlayerbot.UseGroundMountAtMinLevel", 20);
@@ -455,6 +463,12 @@ bool PlayerbotAIConfig::Initialize()
     botTaxiGapMs = sConfigMgr->GetOption<uint32>("AiPlayerbot.BotTaxiGapMs", 200);
     botTaxiGapJitterMs = sConfigMgr->GetOption<uint32>("AiPlayerbot.BotTaxiGapJitterMs", 100);
 
+    travelRouteCacheSize = sConfigMgr->GetOption<uint32>("AiPlayerbot.TravelRouteCacheSize", 8192);
+    travelRoutePlannerThreads = sConfigMgr->GetOption<uint32>("AiPlayerbot.TravelRoutePlannerThreads", 2);
+    travelNodeGenerationThreads = sConfigMgr->GetOption<uint32>("AiPlayerbot.TravelNodeGenerationThreads", 0);
+    travelNodeStoreFile =
+        sConfigMgr->GetOption<std::string>("AiPlayerbot.TravelNodeStoreFile", "playerbots_travelnodes.bin");
+
     LOG_INFO("server.loading", "Loading TalentSpecs...");
 
     for (uint32 cls = 1; cls < MAX_CLASSES; ++cls)
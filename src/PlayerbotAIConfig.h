@@ -120,6 +120,8 @@ public:
     std::set<uint32> disallowedGameObjects;
     std::set<uint32> attunementQuests;
     std::set<uint32> unobtainableItems;
+    uint32 itemCacheThreads;
+    std::string itemCacheFile;
 
     uint32 openGoSpell;
     bool randomBotAutologin;
@@ -160,6 +162,8 @@ public:
     uint32 permanentlyInWorldTime;
     uint32 minRandomBotPvpTime, maxRandomBotPvpTime;
     uint32 randomBotsPerInterval;
+    uint32 randomBotLoginPrefetch;
+    uint32 randomBotLoginMaxUpdateTime;
     uint32 minRandomBotsPriceChangeInterval, maxRandomBotsPriceChangeInterval;
     uint32 disabledWithoutRealPlayerLoginDelay, disabledWithoutRealPlayerLogoutDelay;
     bool randomBotJoinLfg;
@@ -312,6 +316,7 @@ public:
     uint32 guildTaskKillTaskDistance;
 
     uint32 iterationsPerTick;
+    bool tickValueCache;
 
     std::mutex m_logMtx;
     bool enableAutoTradeOnItemMention;
@@ -335,6 +340,9 @@ public:
     std::vector<worldBuff> worldBuffs;
 
     uint32 commandServerPort;
+    uint32 eventJournalFlushInterval;
+    uint32 eventJournalMaxSize;
+    uint32 botStateSavesPerTick;
     bool perfMonEnabled;
     bool summonWhenGroup;
     ShowHideCosmetic randomBotShowHelmet;
@@ -449,6 +457,11 @@ public:
     uint32 botTaxiGapMs;
     uint32 botTaxiGapJitterMs;
 
+    uint32 travelRouteCacheSize;
+    uint32 travelRoutePlannerThreads;
+    uint32 travelNodeGenerationThreads;
+    std::string travelNodeStoreFile;
+
     std::string const GetTimestampStr();
     bool hasLog(std::string const fileName)
     {
@@ -15,11 +15,16 @@
 
 #include "BattleGroundTactics.h"
 #include "Chat.h"
+#include "EngineBenchmark.h"
 #include "GuildTaskMgr.h"
+#include "ItemStatsBenchmark.h"
 #include "PerfMonitor.h"
 #include "PlayerbotMgr.h"
+#include "PlayerbotWorldThreadProcessor.h"
 #include "RandomPlayerbotMgr.h"
 #include "ScriptMgr.h"
+#include "TravelDestinationIndex.h"
+#include "TravelNode.h"
 
 using namespace Acore::ChatCommands;
 
@@ -32,6 +37,11 @@ public:
     {
         static ChatCommandTable playerbotsDebugCommandTable = {
             {"bg", HandleDebugBGCommand, SEC_GAMEMASTER, Console::Yes},
+            {"engine", HandleDebugEngineCommand, SEC_GAMEMASTER, Console::No},
+            {"route", HandleDebugRouteCommand, SEC_GAMEMASTER, Console::Yes},
+            {"stats", HandleDebugStatsCommand, SEC_GAMEMASTER, Console::No},
+            {"travel", HandleDebugTravelCommand, SEC_GAMEMASTER, Console::Yes},
+            {"worldops", HandleDebugWorldOpsCommand, SEC_GAMEMASTER, Console::Yes},
         };
 
         static ChatCommandTable playerbotsAccountCommandTable = {
@@ -111,6 +121,31 @@ public:
         return BGTactics::HandleConsoleCommand(handler, args);
     }
 
+    static bool HandleDebugEngineCommand(ChatHandler* handler, char const* args)
+    {
+        return EngineBenchmark::HandleConsoleCommand(handler, args);
+    }
+
+    static bool HandleDebugRouteCommand(ChatHandler* handler, char const* args)
+    {
+        return TravelNodeMap::HandleConsoleCommand(handler, args);
+    }
+
+    static bool HandleDebugStatsCommand(ChatHandler* handler, char const* args)
+    {
+        return ItemStatsBenchmark::HandleConsoleCommand(handler, args);
+    }
+
+    static bool HandleDebugTravelCommand(ChatHandler* handler, char const* args)
+    {
+        return TravelDestinationIndex::HandleConsoleCommand(handler, args);
+    }
+
+    static bool HandleDebugWorldOpsCommand(ChatHandler* handler, char const* args)
+    {
+        return PlayerbotWorldThreadProcessor::HandleConsoleCommand(handler, args);
+    }
+
     static bool HandleSetSecurityKeyCommand(ChatHandler* handler, char const* args)
     {
         if (!args || !*args)
@@ -11,6 +11,21 @@
 #include "ObjectGuid.h"
 #include <memory>
 
+/**
+ * @brief Scheduling class of an operation, each class has its own queue in PlayerbotWorldThreadProcessor
+ *
+ * Classes are served in order. An operation waiting longer than its deadline is served before the
+ * operations of higher classes, so lower classes cannot starve under load.
+ */
+enum PlayerbotOperationClass : uint8
+{
+    OPERATION_CLASS_CRITICAL = 0,  // Login and cleanup bookkeeping other operations depend on
+    OPERATION_CLASS_INTERACTIVE,   // A real player is waiting for the result
+    OPERATION_CLASS_NORMAL,        // Group, arena and BG operations of bots
+    OPERATION_CLASS_BACKGROUND,    // Statistics, logging
+    MAX_OPERATION_CLASS
+};
+
 /**
  * @brief Base class for thread-unsafe operations that must be executed in the world thread
  *
@@ -60,6 +75,47 @@ public:
      */
     virtual uint32 GetPriority() const { return 10; }
 
+    /**
+     * @brief Get the scheduling class of this operation
+     *
+     * Called by the queueing thread, must only use the operation's own data.
+     * Defaults to a class derived from GetPriority(): 100 is critical, 50 and above normal, the rest background.
+     *
+     * @return Operation class
+     */
+    virtual PlayerbotOperationClass GetOperationClass() const
+    {
+        uint32 priority = GetPriority();
+        if (priority >= 100)
+            return OPERATION_CLASS_CRITICAL;
+
+        return priority >= 50 ? OPERATION_CLASS_NORMAL : OPERATION_CLASS_BACKGROUND;
+    }
+
+    /**
+     * @brief Get the longest time this operation should wait in the queue
+     *
+     * Late operations are served before the operations of higher classes and counted as deadline misses.
+     *
+     * @return Deadline in milliseconds after queueing
+     */
+    virtual uint32 GetDeadlineMs() const { return GetDefaultDeadlineMs(GetOperationClass()); }
+
+    static uint32 GetDefaultDeadlineMs(PlayerbotOperationClass operationClass)
+    {
+        switch (operationClass)
+        {
+            case OPERATION_CLASS_CRITICAL:
+                return 100;
+            case OPERATION_CLASS_INTERACTIVE:
+                return 250;
+            case OPERATION_CLASS_NORMAL:
+                return 1000;
+            default:
+                return 5000;
+        }
+    }
+
     /**
      * @brief Get a human-readable name for this operation
      *
@@ -78,6 +134,17 @@ public:
      * @return true if operation should be executed, false to skip
      */
     virtual bool IsValid() const { return true; }
+
+    /**
+     * @brief Get a key identifying duplicates of this operation (optional)
+     *
+     * Operations of the same type with the same non zero key are idempotent, when several of them are
+     * dequeued back to back only the first is executed. For example several invites of the same target
+     * into the same bot's group.
+     *
+     * @return Coalesce key, or 0 if the operation must always be executed
+     */
+    virtual uint64 GetCoalesceKey() const { return 0; }
 };
 
 /**
@@ -27,8 +27,8 @@
 class GroupInviteOperation : public PlayerbotOperation
 {
 public:
-    GroupInviteOperation(ObjectGuid botGuid, ObjectGuid targetGuid)
-        : m_botGuid(botGuid), m_targetGuid(targetGuid)
+    GroupInviteOperation(ObjectGuid botGuid, ObjectGuid targetGuid, bool interactive = false)
+        : m_botGuid(botGuid), m_targetGuid(targetGuid), m_interactive(interactive)
     {
     }
 
@@ -99,8 +99,18 @@ public:
 
     uint32 GetPriority() const override { return 50; }  // High priority (player-facing)
 
+    PlayerbotOperationClass GetOperationClass() const override
+    {
+        return m_interactive ? OPERATION_CLASS_INTERACTIVE : PlayerbotOperation::GetOperationClass();
+    }
+
     std::string GetName() const override { return "GroupInvite"; }
 
+    uint64 GetCoalesceKey() const override
+    {
+        return (uint64(m_botGuid.GetCounter()) << 32) | m_targetGuid.GetCounter();
+    }
+
     bool IsValid() const override
     {
         // Check if bot still exists and is online
@@ -112,6 +122,7 @@ public:
 private:
     ObjectGuid m_botGuid;
     ObjectGuid m_targetGuid;
+    bool m_interactive;  // Invite into the group of a real player
 };
 
 // Remove member from group
@@ -202,6 +213,8 @@ public:
 
     std::string GetName() const override { return "GroupConvertToRaid"; }
 
+    uint64 GetCoalesceKey() const override { return m_botGuid.GetCounter(); }
+
     bool IsValid() const override
     {
         Player* bot = ObjectAccessor::FindPlayer(m_botGuid);
@@ -5,25 +5,93 @@
  */
 
 #include <algorithm>
+#include <chrono>
+#include <sstream>
+#include <typeindex>
 
 #include "PlayerbotWorldThreadProcessor.h"
 
+#include "Chat.h"
 #include "Timer.h"
 #include "Log.h"
 
-void PlayerbotWorldThreadProcessor::Update(uint32 diff)
+namespace
 {
-    if (!m_enabled)
-        return;
+    char const* const OPERATION_CLASS_NAMES[MAX_OPERATION_CLASS] = {"critical", "interactive", "normal",
+                                                                   "background"};
+}
+
+void PlayerbotWorldThreadProcessor::OperationRing::Init(uint32 capacity)
+{
+    m_cells.reset(new Cell[capacity]);
+    m_mask = capacity - 1;
+
+    for (uint32 i = 0; i < capacity; ++i)
+        m_cells[i].sequence.store(i, std::memory_order_relaxed);
+}
+
+bool PlayerbotWorldThreadProcessor::OperationRing::Push(QueuedOperation const& queued)
+{
+    uint64 pos = m_enqueuePos.load(std::memory_order_relaxed);
+
+    while (true)
+    {
+        Cell& cell = m_cells[pos & m_mask];
+        uint64 const sequence = cell.sequence.load(std::memory_order_acquire);
+        int64 const diff = static_cast<int64>(sequence) - static_cast<int64>(pos);
+
+        if (diff == 0)
+        {
+            // Cell is free, claim the position
+            if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                cell.queued = queued;
+                cell.sequence.store(pos + 1, std::memory_order_release);
+                return true;
+            }
+        }
+        else if (diff < 0)
+            return false;  // Full, the consumer has not freed this cell yet
+        else
+            pos = m_enqueuePos.load(std::memory_order_relaxed);
+    }
+}
+
+PlayerbotWorldThreadProcessor::QueuedOperation const* PlayerbotWorldThreadProcessor::OperationRing::Peek() const
+{
+    Cell const& cell = m_cells[m_dequeuePos & m_mask];
+    uint64 const sequence = cell.sequence.load(std::memory_order_acquire);
+
+    // Not published yet (empty, or a producer is between claiming and filling the cell)
+    if (static_cast<int64>(sequence) - static_cast<int64>(m_dequeuePos + 1) < 0)
+        return nullptr;
+
+    return &cell.queued;
+}
+
+bool PlayerbotWorldThreadProcessor::OperationRing::Pop(QueuedOperation& queued)
+{
+    if (!Peek())
+        return false;
 
-    // Accumulate time
-    m_timeSinceLastUpdate += diff;
+    Cell& cell = m_cells[m_dequeuePos & m_mask];
+    queued = cell.queued;
+    cell.queued = QueuedOperation();
+    cell.sequence.store(m_dequeuePos + m_mask + 1, std::memory_order_release);
+    ++m_dequeuePos;
 
-    // Don't process too frequently to reduce overhead
-    if (m_timeSinceLastUpdate < m_updateInterval)
+    size.fetch_sub(1, std::memory_order_relaxed);
+    return true;
+}
+
+void PlayerbotWorldThreadProcessor::Update(uint32 /*diff*/)
+{
+    if (!m_enabled)
         return;
 
-    m_timeSinceLastUpdate = 0;
+    // Nothing queued, checked without touching the rings
+    if (!m_queueSize.load(std::memory_order_relaxed))
+        return;
 
     // Check queue health (warn if getting full)
     CheckQueueHealth();
@@ -40,70 +108,137 @@ bool PlayerbotWorldThreadProcessor::QueueOperation(std::unique_ptr<PlayerbotOper
         return false;
     }
 
-    std::lock_guard<std::mutex> lock(m_queueMutex);
+    PlayerbotOperationClass operationClass = operation->GetOperationClass();
+    if (operationClass >= MAX_OPERATION_CLASS)
+        operationClass = OPERATION_CLASS_BACKGROUND;
+
+    OperationRing& ring = m_rings[operationClass];
 
-    // Check if queue is full
-    if (m_operationQueue.size() >= m_maxQueueSize)
+    // Counted before the operation is published, so the consumer never sees more operations than counted
+    ring.size.fetch_add(1, std::memory_order_relaxed);
+    uint32 const queueSize = m_queueSize.fetch_add(1, std::memory_order_relaxed) + 1;
+
+    QueuedOperation queued;
+    queued.operation = operation.get();
+    queued.queuedTime = getMSTime();
+    queued.deadlineMs = operation->GetDeadlineMs();
+
+    if (!ring.Push(queued))
     {
+        ring.size.fetch_sub(1, std::memory_order_relaxed);
+        m_queueSize.fetch_sub(1, std::memory_order_relaxed);
+
         LOG_ERROR("playerbots",
-                  "PlayerbotWorldThreadProcessor queue is full ({} operations). Dropping operation: {}",
-                  m_maxQueueSize, operation->GetName());
+                  "PlayerbotWorldThreadProcessor {} queue is full ({} operations). Dropping operation: {}",
+                  OPERATION_CLASS_NAMES[operationClass], m_maxQueueSize, operation->GetName());
 
-        std::lock_guard<std::mutex> statsLock(m_statsMutex);
-        m_stats.totalOperationsSkipped++;
+        m_stats.totalOperationsSkipped.fetch_add(1, std::memory_order_relaxed);
         return false;
     }
 
-    // Queue the operation
-    m_operationQueue.push(std::move(operation));
+    // Owned by the ring now
+    operation.release();
 
     // Update statistics
+    uint32 maxQueueSize = m_stats.maxQueueSize.load(std::memory_order_relaxed);
+    while (queueSize > maxQueueSize &&
+           !m_stats.maxQueueSize.compare_exchange_weak(maxQueueSize, queueSize, std::memory_order_relaxed))
     {
-        std::lock_guard<std::mutex> statsLock(m_statsMutex);
-        m_stats.currentQueueSize = static_cast<uint32>(m_operationQueue.size());
-        m_stats.maxQueueSize = std::max(m_stats.maxQueueSize, m_stats.currentQueueSize);
     }
 
     return true;
 }
 
-void PlayerbotWorldThreadProcessor::ProcessBatch()
+std::unique_ptr<PlayerbotOperation> PlayerbotWorldThreadProcessor::Dequeue()
 {
-    // Extract a batch of operations from the queue
-    std::vector<std::unique_ptr<PlayerbotOperation>> batch;
-    batch.reserve(m_batchSize);
+    uint32 const now = getMSTime();
 
+    // Late operations first so lower classes cannot starve, else strictly by class
+    int32 selected = -1;
+    for (uint8 i = 0; i < MAX_OPERATION_CLASS && selected < 0; ++i)
     {
-        std::lock_guard<std::mutex> lock(m_queueMutex);
-
-        // Extract up to batchSize operations
-        while (!m_operationQueue.empty() && batch.size() < m_batchSize)
-        {
-            batch.push_back(std::move(m_operationQueue.front()));
-            m_operationQueue.pop();
-        }
+        QueuedOperation const* head = m_rings[i].Peek();
+        if (head && getMSTimeDiff(head->queuedTime, now) > head->deadlineMs)
+            selected = i;
+    }
 
-        // Update current queue size stat
-        std::lock_guard<std::mutex> statsLock(m_statsMutex);
-        m_stats.currentQueueSize = static_cast<uint32>(m_operationQueue.size());
+    for (uint8 i = 0; i < MAX_OPERATION_CLASS && selected < 0; ++i)
+    {
+        if (m_rings[i].Peek())
+            selected = i;
     }
 
-    // Execute operations outside of lock to avoid blocking queue
+    QueuedOperation queued;
+    if (selected < 0 || !m_rings[selected].Pop(queued))
+        return nullptr;
+
+    m_queueSize.fetch_sub(1, std::memory_order_relaxed);
+
+    // Queueing delay of the class
+    AtomicClassStatistics& stats = m_stats.classes[selected];
+    uint32 const latency = getMSTimeDiff(queued.queuedTime, now);
+
+    stats.operationsDequeued.fetch_add(1, std::memory_order_relaxed);
+    if (latency > queued.deadlineMs)
+        stats.deadlineMisses.fetch_add(1, std::memory_order_relaxed);
+    if (latency > stats.maxLatencyMs.load(std::memory_order_relaxed))
+        stats.maxLatencyMs.store(latency, std::memory_order_relaxed);
+
+    uint32 bucket = 0;
+    while (latency > LATENCY_BUCKETS_MS[bucket])
+        ++bucket;
+    stats.latencyHistogram[bucket].fetch_add(1, std::memory_order_relaxed);
+
+    return std::unique_ptr<PlayerbotOperation>(queued.operation);
+}
+
+void PlayerbotWorldThreadProcessor::ProcessBatch()
+{
+    auto const begin = std::chrono::steady_clock::now();
+    auto const budget = std::chrono::microseconds(m_updateBudgetUs);
+
+    // Type and coalesce key of the previous operation. Only back-to-back duplicates are dropped, an operation
+    // of another type in between (e.g. a removal between two invites of the same bot) may have undone it.
+    std::type_index lastType = typeid(void);
+    uint64 lastKey = 0;
+
+    uint32 processed = 0;
     uint32 totalExecutionTime = 0;
-    for (auto& operation : batch)
+    bool overBudget = false;
+
+    while (processed < m_batchSize)
     {
+        if (std::chrono::steady_clock::now() - begin >= budget)
+        {
+            overBudget = true;
+            break;
+        }
+
+        std::unique_ptr<PlayerbotOperation> operation = Dequeue();
         if (!operation)
-            continue;
+            break;
+
+        ++processed;
 
         try
         {
+            uint64 const key = operation->GetCoalesceKey();
+            std::type_index const type = typeid(*operation);
+            if (key && key == lastKey && type == lastType)
+            {
+                LOG_DEBUG("playerbots", "Coalesced duplicate operation: {}", operation->GetName());
+                m_stats.totalOperationsCoalesced.fetch_add(1, std::memory_order_relaxed);
+                continue;
+            }
+
+            lastType = type;
+            lastKey = key;
+
             // Check if operation is still valid
             if (!operation->IsValid())
             {
                 LOG_DEBUG("playerbots", "Skipping invalid operation: {}", operation->GetName());
-
-                std::lock_guard<std::mutex> statsLock(m_statsMutex);
-                m_stats.totalOperationsSkipped++;
+                m_stats.totalOperationsSkipped.fetch_add(1, std::memory_order_relaxed);
                 continue;
             }
 
@@ -121,83 +256,140 @@ void PlayerbotWorldThreadProcessor::ProcessBatch()
                 LOG_WARN("playerbots", "Slow operation: {} took {}ms", operation->GetName(), executionTime);
 
             // Update statistics
-            std::lock_guard<std::mutex> statsLock(m_statsMutex);
             if (success)
-                m_stats.totalOperationsProcessed++;
+                m_stats.totalOperationsProcessed.fetch_add(1, std::memory_order_relaxed);
             else
             {
-                m_stats.totalOperationsFailed++;
+                m_stats.totalOperationsFailed.fetch_add(1, std::memory_order_relaxed);
                 LOG_DEBUG("playerbots", "Operation failed: {}", operation->GetName());
             }
         }
         catch (std::exception const& e)
         {
             LOG_ERROR("playerbots", "Exception in operation {}: {}", operation->GetName(), e.what());
-
-            std::lock_guard<std::mutex> statsLock(m_statsMutex);
-            m_stats.totalOperationsFailed++;
+            m_stats.totalOperationsFailed.fetch_add(1, std::memory_order_relaxed);
         }
         catch (...)
         {
             LOG_ERROR("playerbots", "Unknown exception in operation {}", operation->GetName());
-
-            std::lock_guard<std::mutex> statsLock(m_statsMutex);
-            m_stats.totalOperationsFailed++;
+            m_stats.totalOperationsFailed.fetch_add(1, std::memory_order_relaxed);
         }
     }
 
+    // Adapt the batch size: shrink when the budget ran out, grow when the whole batch fit and work is left
+    if (overBudget)
+        m_batchSize = std::max(m_minBatchSize, m_batchSize / 2);
+    else if (processed == m_batchSize && m_queueSize.load(std::memory_order_relaxed))
+        m_batchSize = std::min(m_maxBatchSize, m_batchSize * 2);
+
     // Update average execution time
-    if (!batch.empty())
+    if (processed)
     {
-        std::lock_guard<std::mutex> statsLock(m_statsMutex);
-        uint32 avgTime = totalExecutionTime / static_cast<uint32>(batch.size());
-        // Exponential moving average
-        m_stats.averageExecutionTimeMs =
-            (m_stats.averageExecutionTimeMs * 9 + avgTime) / 10;  // 90% old, 10% new
+        uint32 avgTime = totalExecutionTime / processed;
+        // Exponential moving average, only written by the world thread
+        uint32 average = m_stats.averageExecutionTimeMs.load(std::memory_order_relaxed);
+        m_stats.averageExecutionTimeMs.store((average * 9 + avgTime) / 10,  // 90% old, 10% new
+                                             std::memory_order_relaxed);
     }
 }
 
 void PlayerbotWorldThreadProcessor::CheckQueueHealth()
 {
-    uint32 queueSize = GetQueueSize();
     uint32 threshold = (m_maxQueueSize * m_queueWarningThreshold) / 100;
 
-    if (queueSize >= threshold)
+    for (uint8 i = 0; i < MAX_OPERATION_CLASS; ++i)
     {
-        LOG_WARN("playerbots",
-                 "PlayerbotWorldThreadProcessor queue is {}% full ({}/{}). "
-                 "Consider increasing update frequency or batch size.",
-                 (queueSize * 100) / m_maxQueueSize, queueSize, m_maxQueueSize);
+        uint32 queueSize = m_rings[i].size.load(std::memory_order_relaxed);
+        if (queueSize >= threshold)
+        {
+            LOG_WARN("playerbots",
+                     "PlayerbotWorldThreadProcessor {} queue is {}% full ({}/{}). "
+                     "Processing {} operations per update.",
+                     OPERATION_CLASS_NAMES[i], (queueSize * 100) / m_maxQueueSize, queueSize, m_maxQueueSize,
+                     m_batchSize);
+        }
     }
 }
 
 uint32 PlayerbotWorldThreadProcessor::GetQueueSize() const
 {
-    std::lock_guard<std::mutex> lock(m_queueMutex);
-    return static_cast<uint32>(m_operationQueue.size());
+    return m_queueSize.load(std::memory_order_relaxed);
 }
 
 void PlayerbotWorldThreadProcessor::ClearQueue()
 {
-    std::lock_guard<std::mutex> lock(m_queueMutex);
+    uint32 cleared = 0;
+    for (OperationRing& ring : m_rings)
+    {
+        QueuedOperation queued;
+        while (ring.Pop(queued))
+        {
+            delete queued.operation;
+            m_queueSize.fetch_sub(1, std::memory_order_relaxed);
+            ++cleared;
+        }
+    }
 
-    uint32 cleared = static_cast<uint32>(m_operationQueue.size());
     if (cleared > 0)
-        LOG_INFO("playerbots", "Clearing {} queued operations", cleared);
+        LOG_INFO("playerbots", "Cleared {} queued operations", cleared);
+}
 
-    // Clear the queue
-    while (!m_operationQueue.empty())
+PlayerbotWorldThreadProcessor::Statistics PlayerbotWorldThreadProcessor::GetStatistics() const
+{
+    Statistics stats;
+    stats.totalOperationsProcessed = m_stats.totalOperationsProcessed.load(std::memory_order_relaxed);
+    stats.totalOperationsFailed = m_stats.totalOperationsFailed.load(std::memory_order_relaxed);
+    stats.totalOperationsSkipped = m_stats.totalOperationsSkipped.load(std::memory_order_relaxed);
+    stats.totalOperationsCoalesced = m_stats.totalOperationsCoalesced.load(std::memory_order_relaxed);
+    stats.currentQueueSize = GetQueueSize();
+    stats.maxQueueSize = m_stats.maxQueueSize.load(std::memory_order_relaxed);
+    stats.averageExecutionTimeMs = m_stats.averageExecutionTimeMs.load(std::memory_order_relaxed);
+    stats.batchSize = m_batchSize;
+
+    for (uint8 i = 0; i < MAX_OPERATION_CLASS; ++i)
     {
-        m_operationQueue.pop();
+        AtomicClassStatistics const& source = m_stats.classes[i];
+        ClassStatistics& target = stats.classes[i];
+        target.operationsDequeued = source.operationsDequeued.load(std::memory_order_relaxed);
+        target.deadlineMisses = source.deadlineMisses.load(std::memory_order_relaxed);
+        target.currentQueueSize = m_rings[i].size.load(std::memory_order_relaxed);
+        target.maxLatencyMs = source.maxLatencyMs.load(std::memory_order_relaxed);
+        for (uint32 j = 0; j < LATENCY_BUCKETS_MS.size(); ++j)
+            target.latencyHistogram[j] = source.latencyHistogram[j].load(std::memory_order_relaxed);
     }
 
-    // Reset queue size stat
-    std::lock_guard<std::mutex> statsLock(m_statsMutex);
-    m_stats.currentQueueSize = 0;
+    return stats;
 }
 
-PlayerbotWorldThreadProcessor::Statistics PlayerbotWorldThreadProcessor::GetStatistics() const
+bool PlayerbotWorldThreadProcessor::HandleConsoleCommand(ChatHandler* handler, char const* /*args*/)
 {
-    std::lock_guard<std::mutex> statsLock(m_statsMutex);
-    return m_stats;  // Return a copy
+    Statistics stats = instance().GetStatistics();
+
+    handler->PSendSysMessage("World thread operations: {} processed, {} failed, {} skipped, {} coalesced.",
+                             stats.totalOperationsProcessed, stats.totalOperationsFailed,
+                             stats.totalOperationsSkipped, stats.totalOperationsCoalesced);
+    handler->PSendSysMessage("Queued: {} (max {}), batch size {}, average execution {}ms.", stats.currentQueueSize,
+                             stats.maxQueueSize, stats.batchSize, stats.averageExecutionTimeMs);
+
+    for (uint8 i = 0; i < MAX_OPERATION_CLASS; ++i)
+    {
+        ClassStatistics const& classStats = stats.classes[i];
+
+        std::ostringstream histogram;
+        for (uint32 j = 0; j < LATENCY_BUCKETS_MS.size(); ++j)
+        {
+            if (LATENCY_BUCKETS_MS[j] == UINT32_MAX)
+                histogram << " >" << LATENCY_BUCKETS_MS[j - 1] << ":" << classStats.latencyHistogram[j];
+            else
+                histogram << " <=" << LATENCY_BUCKETS_MS[j] << ":" << classStats.latencyHistogram[j];
+        }
+
+        handler->PSendSysMessage("{}: {} queued, {} dequeued, {} late (deadline {}ms), max wait {}ms, wait ms{}",
+                                 OPERATION_CLASS_NAMES[i], classStats.currentQueueSize,
+                                 classStats.operationsDequeued, classStats.deadlineMisses,
+                                 PlayerbotOperation::GetDefaultDeadlineMs(PlayerbotOperationClass(i)),
+                                 classStats.maxLatencyMs, histogram.str());
+    }
+
+    return true;
 }
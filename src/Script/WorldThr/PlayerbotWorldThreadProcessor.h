@@ -7,13 +7,15 @@
 #ifndef PLAYERBOTS_PLAYERBOTWORLDTHREADPROCESSOR_H
 #define PLAYERBOTS_PLAYERBOTWORLDTHREADPROCESSOR_H
 
+#include <array>
+#include <atomic>
 #include <memory>
-#include <mutex>
-#include <queue>
 
 #include "Log.h"
 #include "PlayerbotOperation.h"
 
+class ChatHandler;
+
 /**
  * @brief Processes thread-unsafe bot operations in the world thread
  *
@@ -24,8 +26,9 @@
  * Architecture:
  * - Map threads queue operations via QueueOperation()
  * - World thread processes operations via Update() (called from WorldScript::OnUpdate)
- * - Operations are processed in priority order
- * - Thread-safe queue protected by mutex
+ * - One queue per PlayerbotOperationClass, served in class order; operations past their deadline first
+ * - Each queue is a lock-free bounded ring, many producers (map threads) and a single consumer (world thread)
+ * - Each Update() spends at most a time budget, the batch size adapts to the cost of the operations
  *
  * Usage:
  *   auto op = std::make_unique<MyOperation>(botGuid, params);
@@ -45,7 +48,7 @@ public:
      * @brief Update and process queued operations (called from world thread)
      *
      * This method should be called from WorldScript::OnUpdate hook, which runs in the world thread.
-     * It processes a batch of queued operations.
+     * It processes a batch of queued operations within the update time budget.
      *
      * @param diff Time since last update in milliseconds
      */
@@ -54,7 +57,7 @@ public:
     /**
      * @brief Queue an operation for execution in the world thread
      *
-     * Thread-safe method that can be called from any thread (typically map threads).
+     * Thread-safe and lock-free, can be called from any thread (typically map threads).
      * The operation will be executed later during Update().
      *
      * @param operation Unique pointer to the operation (ownership is transferred)
@@ -74,25 +77,45 @@ public:
     /**
      * @brief Clear all queued operations
      *
-     * Used during shutdown or emergency situations.
+     * Used during shutdown or emergency situations. Must be called from the world thread (the consumer).
      */
     void ClearQueue();
 
     /**
      * @brief Get statistics about operation processing
      */
+    // Upper bounds (ms) of the queueing delay histogram buckets, the last bucket takes everything above
+    static constexpr std::array<uint32, 8> LATENCY_BUCKETS_MS = {10, 50, 100, 250, 500, 1000, 5000, UINT32_MAX};
+
+    struct ClassStatistics
+    {
+        uint64 operationsDequeued = 0;
+        uint64 deadlineMisses = 0;
+        uint32 currentQueueSize = 0;
+        uint32 maxLatencyMs = 0;
+        std::array<uint64, LATENCY_BUCKETS_MS.size()> latencyHistogram = {};
+    };
+
     struct Statistics
     {
         uint64 totalOperationsProcessed = 0;
         uint64 totalOperationsFailed = 0;
         uint64 totalOperationsSkipped = 0;
+        uint64 totalOperationsCoalesced = 0;
         uint32 currentQueueSize = 0;
         uint32 maxQueueSize = 0;
         uint32 averageExecutionTimeMs = 0;
+        uint32 batchSize = 0;
+        std::array<ClassStatistics, MAX_OPERATION_CLASS> classes;
     };
 
     Statistics GetStatistics() const;
 
+    /**
+     * @brief Print the statistics and queueing delay histograms (.playerbots debug worldops)
+     */
+    static bool HandleConsoleCommand(ChatHandler* handler, char const* args);
+
     /**
      * @brief Enable/disable operation processing
      *
@@ -108,12 +131,17 @@ public:
 private:
     PlayerbotWorldThreadProcessor()
     : m_enabled(true),
-    m_maxQueueSize(10000),
+    m_maxQueueSize(8192),  // Ring capacity of each class, must be a power of two
     m_batchSize(100),
+    m_minBatchSize(16),
+    m_maxBatchSize(4096),
+    m_updateBudgetUs(5000),  // Spend at most 5ms per world update
     m_queueWarningThreshold(80),
-    m_timeSinceLastUpdate(0),
-    m_updateInterval(50)  // Process at least every 50ms
+    m_queueSize(0)
     {
+        for (OperationRing& ring : m_rings)
+            ring.Init(m_maxQueueSize);
+
         LOG_INFO("playerbots", "PlayerbotWorldThreadProcessor initialized");
     }
     ~PlayerbotWorldThreadProcessor()
@@ -121,14 +149,58 @@ private:
         this->ClearQueue();
     }
 
+    struct QueuedOperation
+    {
+        PlayerbotOperation* operation = nullptr;
+        uint32 queuedTime = 0;  // getMSTime()
+        uint32 deadlineMs = 0;
+    };
+
+    // Bounded MPSC ring (Vyukov): a cell is free for the producer at position pos when its sequence is pos,
+    // and holds an operation for the consumer when its sequence is pos + 1.
+    class OperationRing
+    {
+    public:
+        void Init(uint32 capacity);
+        bool Push(QueuedOperation const& queued);
+        // Consumer only
+        QueuedOperation const* Peek() const;
+        bool Pop(QueuedOperation& queued);
+
+        std::atomic<uint32> size{0};
+
+    private:
+        struct Cell
+        {
+            std::atomic<uint64> sequence;
+            QueuedOperation queued;
+        };
+
+        std::unique_ptr<Cell[]> m_cells;
+        uint64 m_mask = 0;
+        alignas(64) std::atomic<uint64> m_enqueuePos{0};
+        alignas(64) uint64 m_dequeuePos = 0;
+    };
+
     /**
      * @brief Process a single batch of operations
      *
-     * Extracts operations from queue and executes them.
+     * Takes up to m_batchSize operations from the rings and executes them until the time budget is spent,
+     * then grows or shrinks m_batchSize for the next update.
      * Called internally by Update().
      */
     void ProcessBatch();
 
+    /**
+     * @brief Take the next operation to run (world thread only)
+     *
+     * The oldest late operation of the highest class with one, else the oldest operation of the highest
+     * non empty class.
+     *
+     * @return The operation, or nullptr if all rings are empty
+     */
+    std::unique_ptr<PlayerbotOperation> Dequeue();
+
     /**
      * @brief Check if queue is approaching capacity
      *
@@ -136,23 +208,39 @@ private:
      */
     void CheckQueueHealth();
 
-    // Thread-safe queue
-    mutable std::mutex m_queueMutex;
-    std::queue<std::unique_ptr<PlayerbotOperation>> m_operationQueue;
-
     // Configuration
     bool m_enabled;
-    uint32 m_maxQueueSize;           // Maximum operations in queue
-    uint32 m_batchSize;              // Operations to process per Update()
+    uint32 m_maxQueueSize;           // Maximum operations in the queue of each class
+    uint32 m_batchSize;              // Operations to process per Update(), adapted to the budget
+    uint32 m_minBatchSize;
+    uint32 m_maxBatchSize;
+    uint32 m_updateBudgetUs;         // Time budget of one Update() in microseconds
     uint32 m_queueWarningThreshold;  // Warn when queue reaches this percentage
 
+    std::array<OperationRing, MAX_OPERATION_CLASS> m_rings;
+    std::atomic<uint32> m_queueSize;
+
     // Statistics
-    mutable std::mutex m_statsMutex;
-    Statistics m_stats;
+    struct AtomicClassStatistics
+    {
+        std::atomic<uint64> operationsDequeued{0};
+        std::atomic<uint64> deadlineMisses{0};
+        std::atomic<uint32> maxLatencyMs{0};
+        std::array<std::atomic<uint64>, LATENCY_BUCKETS_MS.size()> latencyHistogram{};
+    };
+
+    struct AtomicStatistics
+    {
+        std::atomic<uint64> totalOperationsProcessed{0};
+        std::atomic<uint64> totalOperationsFailed{0};
+        std::atomic<uint64> totalOperationsSkipped{0};
+        std::atomic<uint64> totalOperationsCoalesced{0};
+        std::atomic<uint32> maxQueueSize{0};
+        std::atomic<uint32> averageExecutionTimeMs{0};
+        std::array<AtomicClassStatistics, MAX_OPERATION_CLASS> classes;
+    };
 
-    // Timing
-    uint32 m_timeSinceLastUpdate;
-    uint32 m_updateInterval;  // Minimum ms between updates
+    AtomicStatistics m_stats;
 };
 
 #endif
@@ -9,44 +9,83 @@
 #include "Log.h"
 #include "PlayerbotAIConfig.h"
 
-void Queue::Push(ActionBasket* action)
+Queue::Queue()
 {
+    heap.reserve(INITIAL_CAPACITY);
+    baskets.reserve(INITIAL_CAPACITY);
+    freeSlots.reserve(INITIAL_CAPACITY);
+}
+
+void Queue::Push(ActionBasket const& basket)
+{
+    ActionNode* action = basket.getAction();
     if (!action)
     {
         return;
     }
 
-    for (ActionBasket* basket : actions)
+    float relevance = basket.getRelevance();
+    SymbolId nameId = action->getNameId();
+
+    for (uint32 i = 0; i < heap.size(); ++i)
     {
-        if (action->getAction()->getName() == basket->getAction()->getName())
+        if (heap[i].nameId != nameId)
+        {
+            continue;
+        }
+
+        if (heap[i].relevance < relevance)
         {
-            updateExistingBasket(basket, action);
-            return;
+            heap[i].relevance = relevance;
+            baskets[heap[i].slot].setRelevance(relevance);
+            siftUp(i);
         }
+
+        return;
+    }
+
+    uint32 slot;
+    if (!freeSlots.empty())
+    {
+        slot = freeSlots.back();
+        freeSlots.pop_back();
+        baskets[slot] = basket;
+    }
+    else
+    {
+        slot = baskets.size();
+        baskets.push_back(basket);
     }
 
-    actions.push_back(action);
+    heap.push_back({nameId, relevance, pushCount++, slot});
+    siftUp(heap.size() - 1);
 }
 
 ActionNode* Queue::Pop()
 {
-    ActionBasket* highestRelevanceBasket = findHighestRelevanceBasket();
-    if (!highestRelevanceBasket)
+    if (heap.empty())
     {
         return nullptr;
     }
 
-    return extractAndDeleteBasket(highestRelevanceBasket);
+    ActionNode* action = baskets[heap.front().slot].getAction();
+    removeAt(0);
+    return action;
 }
 
 ActionBasket* Queue::Peek()
 {
-    return findHighestRelevanceBasket();
+    if (heap.empty())
+    {
+        return nullptr;
+    }
+
+    return &baskets[heap.front().slot];
 }
 
 uint32 Queue::Size()
 {
-    return actions.size();
+    return heap.size();
 }
 
 void Queue::RemoveExpired()
@@ -56,85 +95,107 @@ void Queue::RemoveExpired()
         return;
     }
 
-    std::list<ActionBasket*> expiredBaskets;
-    collectExpiredBaskets(expiredBaskets);
-    removeAndDeleteBaskets(expiredBaskets);
-}
+    uint32 expiryTime = sPlayerbotAIConfig.expireActionTime;
+    uint32 kept = 0;
+    for (uint32 i = 0; i < heap.size(); ++i)
+    {
+        if (baskets[heap[i].slot].isExpired(expiryTime))
+        {
+            freeSlots.push_back(heap[i].slot);
+            continue;
+        }
 
-// Private helper methods
-void Queue::updateExistingBasket(ActionBasket* existing, ActionBasket* newBasket)
-{
-    if (existing->getRelevance() < newBasket->getRelevance())
+        heap[kept++] = heap[i];
+    }
+
+    if (kept == heap.size())
     {
-        existing->setRelevance(newBasket->getRelevance());
+        return;
     }
 
-    if (ActionNode* actionNode = newBasket->getAction())
+    heap.resize(kept);
+    for (uint32 i = heap.size() / 2; i > 0; --i)
     {
-        delete actionNode;
+        siftDown(i - 1);
     }
+}
 
-    delete newBasket;
+void Queue::Clear()
+{
+    heap.clear();
+    baskets.clear();
+    freeSlots.clear();
+    pushCount = 0;
 }
 
-ActionBasket* Queue::findHighestRelevanceBasket() const
+// Private helper methods
+bool Queue::isBefore(HeapEntry const& a, HeapEntry const& b)
 {
-    if (actions.empty())
+    if (a.relevance != b.relevance)
     {
-        return nullptr;
+        return a.relevance > b.relevance;
     }
 
-    float maxRelevance = -1.0f;
-    ActionBasket* selection = nullptr;
+    return a.order < b.order;
+}
 
-    for (ActionBasket* basket : actions)
+void Queue::siftUp(uint32 index)
+{
+    HeapEntry entry = heap[index];
+    while (index > 0)
     {
-        if (!basket)
+        uint32 parent = (index - 1) / 2;
+        if (!isBefore(entry, heap[parent]))
         {
-            continue;
+            break;
         }
 
-        if (basket->getRelevance() > maxRelevance)
-        {
-            maxRelevance = basket->getRelevance();
-            selection = basket;
-        }
+        heap[index] = heap[parent];
+        index = parent;
     }
 
-    return selection;
-}
-
-ActionNode* Queue::extractAndDeleteBasket(ActionBasket* basket)
-{
-    ActionNode* action = basket->getAction();
-    actions.remove(basket);
-    delete basket;
-    return action;
+    heap[index] = entry;
 }
 
-void Queue::collectExpiredBaskets(std::list<ActionBasket*>& expiredBaskets)
+void Queue::siftDown(uint32 index)
 {
-    uint32 expiryTime = sPlayerbotAIConfig.expireActionTime;
-    for (ActionBasket* basket : actions)
+    HeapEntry entry = heap[index];
+    uint32 size = heap.size();
+    while (true)
     {
-        if (basket->isExpired(expiryTime))
+        uint32 child = index * 2 + 1;
+        if (child >= size)
+        {
+            break;
+        }
+
+        if (child + 1 < size && isBefore(heap[child + 1], heap[child]))
+        {
+            ++child;
+        }
+
+        if (!isBefore(heap[child], entry))
         {
-            expiredBaskets.push_back(basket);
+            break;
         }
+
+        heap[index] = heap[child];
+        index = child;
     }
+
+    heap[index] = entry;
 }
 
-void Queue::removeAndDeleteBaskets(std::list<ActionBasket*>& basketsToRemove)
+void Queue::removeAt(uint32 index)
 {
-    for (ActionBasket* basket : basketsToRemove)
-    {
-        actions.remove(basket);
+    freeSlots.push_back(heap[index].slot);
 
-        if (ActionNode* action = basket->getAction())
-        {
-            delete action;
-        }
+    heap[index] = heap.back();
+    heap.pop_back();
 
-        delete basket;
+    if (index < heap.size())
+    {
+        siftDown(index);
+        siftUp(index);
     }
 }
@@ -7,6 +7,8 @@
 #ifndef PLAYERBOTS_QUEUE_H
 #define PLAYERBOTS_QUEUE_H
 
+#include <vector>
+
 #include "Action.h"
 #include "Common.h"
 
@@ -14,37 +16,43 @@
  * @class Queue
  * @brief Manages a priority queue of actions for the playerbot system
  *
- * This queue maintains a list of ActionBasket objects, each containing an action
- * and its relevance score. Actions with higher relevance scores are prioritized.
+ * This queue maintains ActionBasket objects, each containing an action and its
+ * relevance score. Actions with higher relevance scores are prioritized; equal
+ * relevance is resolved in push order.
+ *
+ * Baskets are kept by value in a slot pool and ordered through a binary max-heap
+ * of small entries, so pushing and popping does not allocate once the pool has
+ * grown to the size of the bot's strategy set. The ActionNodes referenced by the
+ * baskets are owned by the Engine, not by the queue.
  */
 class Queue
 {
 public:
-    Queue() = default;
+    Queue();
     ~Queue() = default;
 
     /**
      * @brief Adds an action to the queue or updates existing action's relevance
-     * @param action Pointer to the ActionBasket to be added
+     * @param basket The ActionBasket to be added, copied into the queue
      *
      * If an action with the same name exists, updates its relevance if the new
-     * relevance is higher, then deletes the new action. Otherwise, adds the new
-     * action to the queue.
+     * relevance is higher. Otherwise, adds the new action to the queue.
      */
-    void Push(ActionBasket* action);
+    void Push(ActionBasket const& basket);
 
     /**
      * @brief Removes and returns the action with highest relevance
      * @return Pointer to the highest relevance ActionNode, or nullptr if queue is empty
      *
-     * Ownership of the returned ActionNode is transferred to the caller.
-     * The associated ActionBasket is deleted.
+     * The associated ActionBasket is released back to the pool.
      */
     ActionNode* Pop();
 
     /**
      * @brief Returns the action with highest relevance without removing it
      * @return Pointer to the ActionBasket with highest relevance, or nullptr if queue is empty
+     *
+     * The pointer stays valid until the queue is modified.
      */
     ActionBasket* Peek();
 
@@ -55,41 +63,58 @@ public:
     uint32 Size();
 
     /**
-     * @brief Removes and deletes expired actions from the queue
+     * @brief Removes expired actions from the queue
      *
      * Uses sPlayerbotAIConfig.expireActionTime to determine if actions have expired.
-     * Both the ActionNode and ActionBasket are deleted for expired actions.
      */
     void RemoveExpired();
 
+    /**
+     * @brief Removes all actions from the queue, keeping the pool capacity
+     */
+    void Clear();
+
 private:
     /**
-     * @brief Updates existing basket with new relevance and cleans up new basket
+     * @brief Heap entry pointing at a pooled basket
+     *
+     * Relevance and name id are duplicated from the basket so ordering and
+     * duplicate detection only touch the compact heap array.
      */
-    void updateExistingBasket(ActionBasket* existing, ActionBasket* newBasket);
+    struct HeapEntry
+    {
+        SymbolId nameId; /**< ActionNode::getNameId() of the basket's action */
+        float relevance;
+        uint32 order;    /**< Push sequence, breaks relevance ties */
+        uint32 slot;     /**< Index of the basket in the pool */
+    };
 
     /**
-     * @brief Finds the basket with the highest relevance score
-     * @return Pointer to the highest relevance basket, or nullptr if queue is empty
+     * @brief Returns true if entry a must be executed before entry b
      */
-    ActionBasket* findHighestRelevanceBasket() const;
+    static bool isBefore(HeapEntry const& a, HeapEntry const& b);
 
     /**
-     * @brief Extracts action from basket and handles basket cleanup
+     * @brief Moves the entry at index towards the root until the heap order holds
      */
-    ActionNode* extractAndDeleteBasket(ActionBasket* basket);
+    void siftUp(uint32 index);
 
     /**
-     * @brief Collects all expired baskets into the provided list
+     * @brief Moves the entry at index towards the leaves until the heap order holds
      */
-    void collectExpiredBaskets(std::list<ActionBasket*>& expiredBaskets);
+    void siftDown(uint32 index);
 
     /**
-     * @brief Removes and deletes all baskets in the provided list
+     * @brief Removes the heap entry at index and releases its basket slot
      */
-    void removeAndDeleteBaskets(std::list<ActionBasket*>& basketsToRemove);
+    void removeAt(uint32 index);
+
+    static constexpr uint32 INITIAL_CAPACITY = 64; /**< Pool size reserved up front */
 
-    std::list<ActionBasket*> actions; /**< Container for action baskets */
+    std::vector<HeapEntry> heap;       /**< Binary max-heap over the queued baskets */
+    std::vector<ActionBasket> baskets; /**< Basket pool, indexed by HeapEntry::slot */
+    std::vector<uint32> freeSlots;     /**< Pool slots available for reuse */
+    uint32 pushCount = 0;              /**< Source of HeapEntry::order */
 };
 
 #endif
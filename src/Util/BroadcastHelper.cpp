@@ -21,7 +21,7 @@ bool BroadcastHelper::BroadcastTest(PlayerbotAI* ai, Player* /* bot */)
     //return something to ignore the logic
     return false;
 
-    std::map<std::string, std::string> placeholders;
+    BotTextPlaceholders placeholders;
     placeholders["%rand1"] = std::to_string(urand(0, 1));
     placeholders["%rand2"] = std::to_string(urand(0, 1));
     placeholders["%rand3"] = std::to_string(urand(0, 1));
@@ -170,7 +170,7 @@ bool BroadcastHelper::BroadcastLootingItem(PlayerbotAI* ai, Player* bot, ItemTem
 {
     if (!sPlayerbotAIConfig.enableBroadcasts)
         return false;
-    std::map<std::string, std::string> placeholders;
+    BotTextPlaceholders placeholders;
     placeholders["%item_link"] = ai->GetChatHelper()->FormatItem(proto);
     AreaTableEntry const* current_area = ai->GetCurrentArea();
     AreaTableEntry const* current_zone = ai->GetCurrentZone();
@@ -265,7 +265,7 @@ bool BroadcastHelper::BroadcastQuestAccepted(PlayerbotAI* ai, Player* bot, const
         return false;
     if (urand(1, sPlayerbotAIConfig.broadcastChanceMaxValue) <= sPlayerbotAIConfig.broadcastChanceQuestAccepted)
     {
-        std::map<std::string, std::string> placeholders;
+        BotTextPlaceholders placeholders;
         placeholders["%quest_link"] = ai->GetChatHelper()->FormatQuest(quest);
         AreaTableEntry const* current_area = ai->GetCurrentArea();
         AreaTableEntry const* current_zone = ai->GetCurrentZone();
@@ -289,7 +289,7 @@ bool BroadcastHelper::BroadcastQuestUpdateAddKill(PlayerbotAI* ai, Player* bot,
 {
     if (!sPlayerbotAIConfig.enableBroadcasts)
         return false;
-    std::map<std::string, std::string> placeholders;
+    BotTextPlaceholders placeholders;
     AreaTableEntry const* current_area = ai->GetCurrentArea();
     AreaTableEntry const* current_zone = ai->GetCurrentZone();
     placeholders["%area_name"] = current_area ? ai->GetLocalizedAreaName(current_area) : PlayerbotTextMgr::instance().GetBotText("string_unknown_area");
@@ -330,7 +330,7 @@ bool BroadcastHelper::BroadcastQuestUpdateAddItem(PlayerbotAI* ai, Player* bot,
 {
     if (!sPlayerbotAIConfig.enableBroadcasts)
         return false;
-    std::map<std::string, std::string> placeholders;
+    BotTextPlaceholders placeholders;
     AreaTableEntry const* current_area = ai->GetCurrentArea();
     AreaTableEntry const* current_zone = ai->GetCurrentZone();
     placeholders["%area_name"] = current_area ? ai->GetLocalizedAreaName(current_area) : PlayerbotTextMgr::instance().GetBotText("string_unknown_area");
@@ -374,7 +374,7 @@ bool BroadcastHelper::BroadcastQuestUpdateFailedTimer(PlayerbotAI* ai, Player* b
         return false;
     if (urand(1, sPlayerbotAIConfig.broadcastChanceMaxValue) <= sPlayerbotAIConfig.broadcastChanceQuestUpdateFailedTimer)
     {
-        std::map<std::string, std::string> placeholders;
+        BotTextPlaceholders placeholders;
         placeholders["%quest_link"] = ai->GetChatHelper()->FormatQuest(quest);
         AreaTableEntry const* current_area = ai->GetCurrentArea();
         AreaTableEntry const* current_zone = ai->GetCurrentZone();
@@ -400,7 +400,7 @@ bool BroadcastHelper::BroadcastQuestUpdateComplete(PlayerbotAI* ai, Player* bot,
         return false;
     if (urand(1, sPlayerbotAIConfig.broadcastChanceMaxValue) <= sPlayerbotAIConfig.broadcastChanceQuestUpdateComplete)
     {
-        std::map<std::string, std::string> placeholders;
+        BotTextPlaceholders placeholders;
         placeholders["%quest_link"] = ai->GetChatHelper()->FormatQuest(quest);
         AreaTableEntry const* current_area = ai->GetCurrentArea();
         AreaTableEntry const* current_zone = ai->GetCurrentZone();
@@ -426,7 +426,7 @@ bool BroadcastHelper::BroadcastQuestTurnedIn(PlayerbotAI* ai, Player* bot, Quest
         return false;
     if (urand(1, sPlayerbotAIConfig.broadcastChanceMaxValue) <= sPlayerbotAIConfig.broadcastChanceQuestTurnedIn)
     {
-        std::map<std::string, std::string> placeholders;
+        BotTextPlaceholders placeholders;
         placeholders["%quest_link"] = ai->GetChatHelper()->FormatQuest(quest);
         AreaTableEntry const* current_area = ai->GetCurrentArea();
         AreaTableEntry const* current_zone = ai->GetCurrentZone();
@@ -450,7 +450,7 @@ bool BroadcastHelper::BroadcastKill(PlayerbotAI* ai, Player* bot, Creature *crea
 {
     if (!sPlayerbotAIConfig.enableBroadcasts)
         return false;
-    std::map<std::string, std::string> placeholders;
+    BotTextPlaceholders placeholders;
     placeholders["%victim_name"] = creature->GetName();
     AreaTableEntry const* current_area = ai->GetCurrentArea();
     AreaTableEntry const* current_zone = ai->GetCurrentZone();
@@ -568,7 +568,7 @@ bool BroadcastHelper::BroadcastLevelup(PlayerbotAI* ai, Player* bot)
         return false;
     uint32 level = bot->GetLevel();
 
-    std::map<std::string, std::string> placeholders;
+    BotTextPlaceholders placeholders;
     AreaTableEntry const* current_area = ai->GetCurrentArea();
     AreaTableEntry const* current_zone = ai->GetCurrentZone();
     placeholders["%area_name"] = current_area ? ai->GetLocalizedAreaName(current_area) : PlayerbotTextMgr::instance().GetBotText("string_unknown_area");
@@ -614,7 +614,7 @@ bool BroadcastHelper::BroadcastGuildMemberPromotion(PlayerbotAI* ai, Player* /*
         return false;
     if (urand(1, sPlayerbotAIConfig.broadcastChanceMaxValue) <= sPlayerbotAIConfig.broadcastChanceGuildManagement)
     {
-        std::map<std::string, std::string> placeholders;
+        BotTextPlaceholders placeholders;
         placeholders["%other_name"] = player->GetName();
         placeholders["%other_class"] = ai->GetChatHelper()->FormatClass(player->getClass());
         placeholders["%other_race"] = ai->GetChatHelper()->FormatRace(player->getRace());
@@ -630,7 +630,7 @@ bool BroadcastHelper::BroadcastGuildMemberDemotion(PlayerbotAI* ai, Player* /* b
 {
     if (urand(1, sPlayerbotAIConfig.broadcastChanceMaxValue) <= sPlayerbotAIConfig.broadcastChanceGuildManagement)
     {
-        std::map<std::string, std::string> placeholders;
+        BotTextPlaceholders placeholders;
         placeholders["%other_name"] = player->GetName();
         placeholders["%other_class"] = ai->GetChatHelper()->FormatClass(player->getClass());
         placeholders["%other_race"] = ai->GetChatHelper()->FormatRace(player->getRace());
@@ -646,7 +646,7 @@ bool BroadcastHelper::BroadcastGuildGroupOrRaidInvite(PlayerbotAI* ai, Player* /
 {
     if (!sPlayerbotAIConfig.enableBroadcasts)
         return false;
-    std::map<std::string, std::string> placeholders;
+    BotTextPlaceholders placeholders;
     placeholders["%name"] = player->GetName();
     AreaTableEntry const* current_area = ai->GetCurrentArea();
     AreaTableEntry const* current_zone = ai->GetCurrentZone();
@@ -687,7 +687,7 @@ bool BroadcastHelper::BroadcastSuggestInstance(PlayerbotAI* ai, std::vector<std:
         return false;
     if (urand(1, sPlayerbotAIConfig.broadcastChanceMaxValue) <= sPlayerbotAIConfig.broadcastChanceSuggestInstance)
     {
-        std::map<std::string, std::string> placeholders;
+        BotTextPlaceholders placeholders;
         placeholders["%my_role"] = ChatHelper::FormatClass(bot, AiFactory::GetPlayerSpecTab(bot));
 
         std::ostringstream itemout;
@@ -720,7 +720,7 @@ bool BroadcastHelper::BroadcastSuggestQuest(PlayerbotAI* ai, std::vector<uint32>
 
         Quest const* quest = sObjectMgr->GetQuestTemplate(quests[index]);
 
-        std::map<std::string, std::string> placeholders;
+        BotTextPlaceholders placeholders;
         placeholders["%my_role"] = ChatHelper::FormatClass(bot, AiFactory::GetPlayerSpecTab(bot));
         placeholders["%quest_link"] = ai->GetChatHelper()->FormatQuest(quest);
         placeholders["%quest_level"] = std::to_string(quest->GetQuestLevel());
@@ -745,7 +745,7 @@ bool BroadcastHelper::BroadcastSuggestGrindMaterials(PlayerbotAI* ai, std::strin
     if (urand(1, sPlayerbotAIConfig.broadcastChanceMaxValue) <= sPlayerbotAIConfig.broadcastChanceSuggestGrindMaterials)
     {
 
-        std::map<std::string, std::string> placeholders;
+        BotTextPlaceholders placeholders;
         placeholders["%my_role"] = ChatHelper::FormatClass(bot, AiFactory::GetPlayerSpecTab(bot));
         placeholders["%category"] = item;
 
@@ -770,7 +770,7 @@ bool BroadcastHelper::BroadcastSuggestGrindReputation(PlayerbotAI* ai, std::vect
     if (urand(1, sPlayerbotAIConfig.broadcastChanceMaxValue) <= sPlayerbotAIConfig.broadcastChanceSuggestGrindReputation)
     {
 
-        std::map<std::string, std::string> placeholders;
+        BotTextPlaceholders placeholders;
         placeholders["%my_role"] = ChatHelper::FormatClass(bot, AiFactory::GetPlayerSpecTab(bot));
         placeholders["%rep_level"] = levels[urand(0, 2)];
         std::ostringstream rnd; rnd << urand(1, 5) << "K";
@@ -802,7 +802,7 @@ bool BroadcastHelper::BroadcastSuggestSell(PlayerbotAI* ai, const ItemTemplate*
     if (urand(1, sPlayerbotAIConfig.broadcastChanceMaxValue) <= sPlayerbotAIConfig.broadcastChanceSuggestSell)
     {
 
-        std::map<std::string, std::string> placeholders;
+        BotTextPlaceholders placeholders;
         placeholders["%item_link"] = ai->GetChatHelper()->FormatItem(proto, 0);
         placeholders["%item_formatted_link"] = ai->GetChatHelper()->FormatItem(proto, count);
         placeholders["%item_count"] = std::to_string(count);
@@ -828,7 +828,7 @@ bool BroadcastHelper::BroadcastSuggestSomething(PlayerbotAI* ai, Player* bot)
         return false;
     if (urand(1, sPlayerbotAIConfig.broadcastChanceMaxValue) <= sPlayerbotAIConfig.broadcastChanceSuggestSomething)
     {
-        std::map<std::string, std::string> placeholders;
+        BotTextPlaceholders placeholders;
         placeholders["%my_role"] = ChatHelper::FormatClass(bot, AiFactory::GetPlayerSpecTab(bot));
 
         AreaTableEntry const* current_area = ai->GetCurrentArea();
@@ -858,7 +858,7 @@ bool BroadcastHelper::BroadcastSuggestSomethingToxic(PlayerbotAI* ai, Player* bo
         //items
         std::vector<Item*> botItems = ai->GetInventoryAndEquippedItems();
 
-        std::map<std::string, std::string> placeholders;
+        BotTextPlaceholders placeholders;
 
         placeholders["%random_inventory_item_link"] = botItems.size() > 0 ? ai->GetChatHelper()->FormatItem(botItems[rand() % botItems.size()]->GetTemplate()) : PlayerbotTextMgr::instance().GetBotText("string_empty_link");
 
@@ -906,7 +906,7 @@ bool BroadcastHelper::BroadcastSuggestToxicLinks(PlayerbotAI* ai, Player* bot)
         //spells
         //?
 
-        std::map<std::string, std::string> placeholders;
+        BotTextPlaceholders placeholders;
 
         placeholders["%random_inventory_item_link"] = botItems.size() > 0 ? ai->GetChatHelper()->FormatItem(botItems[rand() % botItems.size()]->GetTemplate()) : PlayerbotTextMgr::instance().GetBotText("string_empty_link");
         placeholders["%prefix"] = sPlayerbotAIConfig.toxicLinksPrefix;
@@ -918,7 +918,8 @@ bool BroadcastHelper::BroadcastSuggestToxicLinks(PlayerbotAI* ai, Player* bot)
         }
         else
         {
-            placeholders["%random_taken_quest_or_item_link"] = placeholders["%random_inventory_item_link"];
+            std::string const itemLink = placeholders["%random_inventory_item_link"];
+            placeholders["%random_taken_quest_or_item_link"] = itemLink;
         }
 
         placeholders["%my_role"] = ChatHelper::FormatClass(bot, AiFactory::GetPlayerSpecTab(bot));
@@ -944,7 +945,7 @@ bool BroadcastHelper::BroadcastSuggestThunderfury(PlayerbotAI* ai, Player* bot)
 {
     if (urand(1, sPlayerbotAIConfig.broadcastChanceMaxValue) <= sPlayerbotAIConfig.broadcastChanceSuggestThunderfury)
     {
-        std::map<std::string, std::string> placeholders;
+        BotTextPlaceholders placeholders;
         ItemTemplate const* thunderfuryProto = sObjectMgr->GetItemTemplate(19019);
         placeholders["%thunderfury_link"] = GET_PLAYERBOT_AI(bot)->GetChatHelper()->FormatItem(thunderfuryProto);
 